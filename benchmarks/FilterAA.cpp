@@ -0,0 +1,114 @@
+#include "filters/GdFilterAA.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <complex>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+
+static constexpr float kSampleRate = 44100;
+// the ratio of the edge of the stop band and the cutoff, in the analog
+// domain, for the elliptic design of order 8, with Rp=0.1dB and Rs=80dB
+static constexpr double kStopbandRatio = 1.4035;
+
+// measures the cost of the computation of the coefficients, which happens at
+// every k-rate update while a shift moves, and the accuracy of the filters
+// which it computes across the range of cutoffs, as the worst levels in the
+// stop band and beyond the ripple in the pass band, in decibels
+static void UpdateCoeffs(benchmark::State &state)
+{
+    GdFilterAA filter;
+    filter.setSampleRate(kSampleRate);
+
+    std::vector<float> cutoffs(1021);
+    for (size_t i = 0; i < cutoffs.size(); ++i)
+        cutoffs[i] = kSampleRate * (0.25f + 0.2f * (float)i / (float)(cutoffs.size() - 1));
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        filter.setCutoff(cutoffs[i++ % cutoffs.size()]);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    double worstStopband = -1000;
+    double worstPassband = -1000;
+    std::vector<float> impulse(4096);
+    for (size_t nthCutoff = 0; nthCutoff < cutoffs.size(); nthCutoff += 10) {
+        filter.clear();
+        filter.setCutoff(cutoffs[nthCutoff]);
+        for (size_t j = 0; j < impulse.size(); ++j)
+            impulse[j] = filter.processOne((j == 0) ? 1.0f : 0.0f);
+
+        double fc = cutoffs[nthCutoff] / kSampleRate;
+        double fs = std::atan(kStopbandRatio * std::tan(M_PI * fc)) / M_PI;
+        for (unsigned nthFrequency = 0; nthFrequency <= 256; ++nthFrequency) {
+            double f = 0.5 * nthFrequency / 256;
+            if (f > fc && f < fs)
+                continue;
+            std::complex<double> h = 0;
+            for (size_t j = 0; j < impulse.size(); ++j)
+                h += (double)impulse[j] * std::polar(1.0, -2 * M_PI * f * (double)j);
+            double level = 20 * std::log10(std::abs(h));
+            if (f >= fs)
+                worstStopband = std::max(worstStopband, level);
+            else
+                worstPassband = std::max(worstPassband, std::max(level, -0.1 - level));
+        }
+    }
+
+    state.counters["stopband_dB"] = worstStopband;
+    state.counters["passband_dB"] = worstPassband;
+}
+
+// measures the cost of a k-rate interval of many filters, with their cutoffs
+// jumping across the range, as the shifts of many taps under automation, so
+// that their coefficients come from anywhere in the table; optionally, other
+// work sweeps the cache between the intervals, as the rest of the processing
+static void UpdateAndProcess(benchmark::State &state)
+{
+    unsigned count = 32;
+    unsigned numFilters = (unsigned)state.range(0);
+    bool otherWork = state.range(1) != 0;
+
+    std::vector<GdFilterAA> filters(numFilters);
+    for (GdFilterAA &filter : filters)
+        filter.setSampleRate(kSampleRate);
+
+    std::vector<float> cutoffs(4096);
+    for (float &cutoff : cutoffs)
+        cutoff = kSampleRate * (0.25f + 0.2f * (float)std::rand() / (float)RAND_MAX);
+
+    std::vector<float> input(count);
+    std::vector<float> output(count);
+    for (float &x : input)
+        x = (float)std::rand() / (float)RAND_MAX - 0.5f;
+
+    std::vector<float> other(otherWork ? (256 * 1024 / sizeof(float)) : 0);
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        if (otherWork) {
+            state.PauseTiming();
+            for (float &x : other)
+                x += 1.0f;
+            benchmark::ClobberMemory();
+            state.ResumeTiming();
+        }
+        for (GdFilterAA &filter : filters) {
+            filter.setCutoff(cutoffs[i++ % cutoffs.size()]);
+            filter.process(input.data(), output.data(), count);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * numFilters * count);
+}
+
+BENCHMARK(UpdateCoeffs);
+// arguments: number of filters, other work between the intervals
+BENCHMARK(UpdateAndProcess)->ArgsProduct({{1, 4, 16, 64}, {0, 1}});
+BENCHMARK_MAIN();
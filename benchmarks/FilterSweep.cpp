@@ -0,0 +1,119 @@
+#include "Gd.h"
+#include "GdFilter.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <cstdlib>
+
+// measures the cost of a computation of the coefficients of a filter, which
+// happens at every k-rate update while its cutoff moves
+static void UpdateCoeffs(benchmark::State &state)
+{
+    GdFilter filter;
+    filter.setSampleRate(44100);
+    filter.setFilterType((int)state.range(0));
+    filter.setResonance(2);
+
+    std::vector<float> cutoffs(1024);
+    for (size_t i = 0; i < cutoffs.size(); ++i)
+        cutoffs[i] = 20.0f + 20000.0f * (float)i / (float)cutoffs.size();
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        filter.setCutoff(cutoffs[i++ % cutoffs.size()]);
+        filter.updateCoeffs();
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// measures the cost of a call to `GdProcess`, with the cutoffs of the taps
+// either fixed, or sweeping all the time as under automation, and with the
+// filters either biquads, or state-variable filters which glide per frame
+class FilterSweepFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(const benchmark::State &state)
+    {
+        unsigned count = 512;
+        unsigned numTaps = (unsigned)state.range(1);
+        bool stateVariable = state.range(2) != 0;
+
+        Gd *gd = GdNew(2, 2);
+        gd_.reset(gd);
+        GdSetSampleRate(gd, 44100);
+        GdSetBufferSize(gd, count);
+
+        GdSetParameter(gd, GDP_SYNC, 0);
+        for (unsigned tap = 0; tap < numTaps; ++tap) {
+            auto setTapParameter = [gd, tap](GdParameter p, float value) {
+                GdSetParameter(gd, GdRecomposeParameter(p, (int)tap), value);
+            };
+            setTapParameter(GDP_TAP_A_ENABLE, 1);
+            setTapParameter(GDP_TAP_A_DELAY, 0.1f + 0.05f * tap);
+            setTapParameter(GDP_TAP_A_LEVEL, -1.0f * tap);
+            setTapParameter(GDP_TAP_A_PAN, (tap & 1) ? 50 : -50);
+            setTapParameter(GDP_TAP_A_FILTER_ENABLE, 1);
+            setTapParameter(GDP_TAP_A_FILTER, stateVariable ? int(GdFilter12dBSVF) : int(tap & 1));
+            setTapParameter(GDP_TAP_A_LPF_CUTOFF, 8000 + 1000 * tap);
+            setTapParameter(GDP_TAP_A_HPF_CUTOFF, 100 + 20 * tap);
+            setTapParameter(GDP_TAP_A_RESONANCE, 6);
+        }
+        GdClear(gd);
+
+        for (unsigned c = 0; c < 2; ++c) {
+            inputs_[c].resize(count);
+            outputs_[c].resize(count);
+            for (float &x : inputs_[c])
+                x = (float)std::rand() / (float)RAND_MAX - 0.5f;
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state)
+    {
+        (void)state;
+        gd_.reset();
+    }
+
+    GdPtr gd_;
+    std::vector<float> inputs_[2];
+    std::vector<float> outputs_[2];
+};
+
+BENCHMARK_DEFINE_F(FilterSweepFixture, Process)(benchmark::State &state)
+{
+    Gd *gd = gd_.get();
+    const float *inputs[] = { inputs_[0].data(), inputs_[1].data() };
+    float *outputs[] = { outputs_[0].data(), outputs_[1].data() };
+    unsigned count = (unsigned)inputs_[0].size();
+    bool sweep = state.range(0) != 0;
+    unsigned numTaps = (unsigned)state.range(1);
+
+    unsigned iteration = 0;
+    for (auto _ : state)
+    {
+        // move the targets before the smoothers arrive, so the cutoffs
+        // never settle
+        if (sweep) {
+            for (unsigned tap = 0; tap < numTaps; ++tap) {
+                float lpf = ((iteration + tap) & 1) ? 2000 : 12000;
+                float hpf = ((iteration + tap) & 1) ? 500 : 50;
+                GdSetParameter(gd, GdRecomposeParameter(GDP_TAP_A_LPF_CUTOFF, (int)tap), lpf);
+                GdSetParameter(gd, GdRecomposeParameter(GDP_TAP_A_HPF_CUTOFF, (int)tap), hpf);
+            }
+        }
+        ++iteration;
+
+        GdProcess(gd, inputs, outputs, count);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// arguments: filter type (LPF6, HPF6, LPF12, HPF12, LPF12SVF, HPF12SVF)
+BENCHMARK(UpdateCoeffs)->DenseRange(1, 6);
+// arguments: sweeping cutoffs, number of enabled taps, state-variable filters
+BENCHMARK_REGISTER_F(FilterSweepFixture, Process)->ArgsProduct({{0, 1}, {1, 8}, {0, 1}});
+BENCHMARK_MAIN();
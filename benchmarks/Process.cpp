@@ -0,0 +1,74 @@
+#include "Gd.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+#include <cstdlib>
+
+// measures the cost of a call to `GdProcess`, for blocks of a few frames,
+// which are dominated by the work done once per call
+class ProcessFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(const benchmark::State &state)
+    {
+        unsigned count = (unsigned)state.range(0);
+        unsigned numTaps = (unsigned)state.range(1);
+
+        Gd *gd = GdNew(2, 2);
+        gd_.reset(gd);
+        GdSetSampleRate(gd, 44100);
+        GdSetBufferSize(gd, count);
+
+        GdSetParameter(gd, GDP_SYNC, 0);
+        for (unsigned tap = 0; tap < numTaps; ++tap) {
+            auto setTapParameter = [gd, tap](GdParameter p, float value) {
+                GdSetParameter(gd, GdRecomposeParameter(p, (int)tap), value);
+            };
+            setTapParameter(GDP_TAP_A_ENABLE, 1);
+            setTapParameter(GDP_TAP_A_DELAY, 0.1f + 0.05f * tap);
+            setTapParameter(GDP_TAP_A_LEVEL, -1.0f * tap);
+            setTapParameter(GDP_TAP_A_PAN, (tap & 1) ? 50 : -50);
+            setTapParameter(GDP_TAP_A_FILTER_ENABLE, 1);
+            setTapParameter(GDP_TAP_A_FILTER, tap & 1);
+            setTapParameter(GDP_TAP_A_LPF_CUTOFF, 4000 + 1000 * tap);
+            setTapParameter(GDP_TAP_A_HPF_CUTOFF, 100 + 20 * tap);
+        }
+        GdClear(gd);
+
+        for (unsigned c = 0; c < 2; ++c) {
+            inputs_[c].resize(count);
+            outputs_[c].resize(count);
+            for (float &x : inputs_[c])
+                x = (float)std::rand() / (float)RAND_MAX - 0.5f;
+        }
+    }
+
+    void TearDown(const ::benchmark::State &state)
+    {
+        (void)state;
+        gd_.reset();
+    }
+
+    GdPtr gd_;
+    std::vector<float> inputs_[2];
+    std::vector<float> outputs_[2];
+};
+
+BENCHMARK_DEFINE_F(ProcessFixture, Process)(benchmark::State &state)
+{
+    Gd *gd = gd_.get();
+    const float *inputs[] = { inputs_[0].data(), inputs_[1].data() };
+    float *outputs[] = { outputs_[0].data(), outputs_[1].data() };
+    unsigned count = (unsigned)inputs_[0].size();
+
+    for (auto _ : state)
+    {
+        GdProcess(gd, inputs, outputs, count);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+// arguments: number of frames per call, number of enabled taps
+BENCHMARK_REGISTER_F(ProcessFixture, Process)->ArgsProduct({{1, 8, 16, 32, 64}, {0, 8}});
+BENCHMARK_MAIN();
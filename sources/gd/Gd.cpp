@@ -19,11 +19,17 @@
 
 #include "Gd.h"
 #include "GdNetwork.h"
+#include "GdConvolutionEngine.h"
+#include "GdState.h"
+#include "GdDenormals.h"
 #include "utility/LinearSmoother.h"
 #include "utility/NextPowerOfTwo.h"
 #include "utility/Volume.h"
 #include "utility/StdcLocale.h"
+#include "utility/MemoryPool.h"
+#include "utility/ScopedNoDenormals.h"
 #include <vector>
+#include <thread>
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
@@ -31,45 +37,76 @@
 #include <cassert>
 
 struct Gd {
+    // the pool of an instance in caller memory, which keeps the sample rate
+    // and the buffer size it was made with
+    MemoryPool *pool_ = MemoryPool::getCurrent();
     unsigned numinputs_ = 0;
-    std::unique_ptr<GdNetwork> network_;
+    std::unique_ptr<GdNetwork, PoolDelete> network_;
+    std::unique_ptr<GdConvolutionEngine, PoolDelete> convolution_;
     float samplerate_ = 0;
+    float tempo_ = 120;
     unsigned bufsize_ = 0;
 
     LinearSmoother smoothMixDryLinear_;
     LinearSmoother smoothMixWetLinear_;
 
-    std::vector<float> temp_[4];
+    PoolVector<float> temp_[2 + GdMaxChannels];
 
     float parameters_[GD_PARAMETER_COUNT] {};
 };
 
+static constexpr float kDefaultSampleRate = 44100;
+static constexpr unsigned kDefaultBufferSize = 128;
+
+static Gd *GdNewWithSettings(unsigned numinputs, unsigned numoutputs, float samplerate, unsigned bufsize);
+static Gd *GdNewWithNetwork(GdNetwork *network, unsigned numinputs, float samplerate, unsigned bufsize);
+
 Gd *GdNew(unsigned numinputs, unsigned numoutputs)
+{
+    return GdNewWithSettings(numinputs, numoutputs, kDefaultSampleRate, kDefaultBufferSize);
+}
+
+static Gd *GdNewWithSettings(unsigned numinputs, unsigned numoutputs, float samplerate, unsigned bufsize)
 {
     if (numoutputs != 2)
         return nullptr;
 
-    Gd *gd = new Gd;
-    gd->numinputs_ = numinputs;
-
+    GdNetwork *network;
     if (numinputs == 1)
-        gd->network_.reset(new GdNetwork(GdNetwork::Mono));
+        network = poolNew<GdNetwork>(GdNetwork::Mono);
     else if (numinputs == 2)
-        gd->network_.reset(new GdNetwork(GdNetwork::Stereo));
+        network = poolNew<GdNetwork>(GdNetwork::Stereo);
     else
         return nullptr;
 
+    return GdNewWithNetwork(network, numinputs, samplerate, bufsize);
+}
+
+Gd *GdNewMultichannel(unsigned numpairs, unsigned numsingles)
+{
+    unsigned numchannels = 2 * numpairs + numsingles;
+    if (numchannels == 0 || numchannels > GdMaxChannels)
+        return nullptr;
+
+    GdNetwork *network = poolNew<GdNetwork>(numpairs, numsingles);
+    return GdNewWithNetwork(network, numchannels, kDefaultSampleRate, kDefaultBufferSize);
+}
+
+static Gd *GdNewWithNetwork(GdNetwork *network, unsigned numinputs, float samplerate, unsigned bufsize)
+{
+    Gd *gd = poolNew<Gd>();
+    gd->numinputs_ = numinputs;
+    gd->network_.reset(network);
+    gd->convolution_.reset(poolNew<GdConvolutionEngine>(*network));
+
     gd->smoothMixDryLinear_.setTimeConstant(GdParamSmoothTime);
     gd->smoothMixWetLinear_.setTimeConstant(GdParamSmoothTime);
 
-    const float defaultSampleRate = 44100;
-    const unsigned defaultBlockSize = 128;
+    GdSetSampleRate(gd, samplerate);
+    GdSetBufferSize(gd, bufsize);
 
-    GdSetSampleRate(gd, defaultSampleRate);
-    GdSetBufferSize(gd, defaultBlockSize);
-
-    gd->smoothMixDryLinear_.setSampleRate(defaultSampleRate);
-    gd->smoothMixWetLinear_.setSampleRate(defaultSampleRate);
+    gd->smoothMixDryLinear_.setSampleRate(samplerate);
+    gd->smoothMixWetLinear_.setSampleRate(samplerate);
 
     float *parameters = gd->parameters_;
     for (unsigned i = 0; i < GD_PARAMETER_COUNT; ++i)
@@ -83,9 +120,73 @@ Gd *GdNew(unsigned numinputs, unsigned numoutputs)
     return gd;
 }
 
+// makes an instance with the same channels, sample rate, tempo and parameters
+static Gd *GdNewCopy(const Gd *gd)
+{
+    const GdNetwork &network = *gd->network_;
+    unsigned numpairs = network.getNumPairs();
+
+    Gd *copy = (network.getChannelMode() == GdNetwork::Multichannel) ?
+        GdNewMultichannel(numpairs, network.getNumInputs() - 2 * numpairs) :
+        GdNew(gd->numinputs_, 2);
+
+    GdSetSampleRate(copy, gd->samplerate_);
+    GdSetBufferSize(copy, gd->bufsize_);
+    GdSetTempo(copy, gd->tempo_);
+
+    for (unsigned i = 0; i < GD_PARAMETER_COUNT; ++i) {
+        bool force = true;
+        GdSetParameterEx(copy, (GdParameter)i, gd->parameters_[i], force);
+    }
+
+    GdClear(copy);
+    return copy;
+}
+
+//==============================================================================
+size_t GdQueryMemoryRequirements(unsigned numinputs, float samplerate, unsigned maxblock, unsigned flags)
+{
+    if (flags != 0 || !(samplerate > 0) || maxblock == 0)
+        return 0;
+
+    // the instance is made on the heap, in a pool which measures its size;
+    // it's made with its final settings from the start, since the memory of
+    // the earlier settings would not be released
+    MemoryPool pool;
+    MemoryPool::Scope scope(&pool);
+    Gd *gd = GdNewWithSettings(numinputs, 2, samplerate, maxblock);
+    if (!gd)
+        return 0;
+
+    GdFree(gd);
+    return MemoryPool::getSizeToCreate(pool.getSizeInUse());
+}
+
+Gd *GdNewInPlace(void *memory, size_t size, unsigned numinputs, float samplerate, unsigned maxblock, unsigned flags)
+{
+    if (flags != 0 || !(samplerate > 0) || maxblock == 0)
+        return nullptr;
+
+    MemoryPool *pool = MemoryPool::createIn(memory, size);
+    if (!pool)
+        return nullptr;
+
+    MemoryPool::Scope scope(pool);
+    try {
+        return GdNewWithSettings(numinputs, 2, samplerate, maxblock);
+    }
+    catch (std::bad_alloc &) {
+        // the memory is smaller than the requirements
+        return nullptr;
+    }
+}
+
+//==============================================================================
 void GdFree(Gd *gd)
 {
-    delete gd;
+    PoolDelete deleter;
+    deleter.pool = gd->pool_;
+    deleter(gd);
 }
 
 void GdClear(Gd *gd)
@@ -94,34 +195,82 @@ void GdClear(Gd *gd)
     gd->smoothMixWetLinear_.clearToTarget();
 
     gd->network_->clear();
+    gd->convolution_->clear();
 }
 
 void GdSetSampleRate(Gd *gd, float samplerate)
 {
     if (gd->samplerate_ == samplerate)
         return;
+    if (gd->pool_ && gd->samplerate_ != 0)
+        return;
 
     gd->samplerate_ = samplerate;
 
     gd->network_->setSampleRate(samplerate);
+    gd->convolution_->setSampleRate(samplerate);
 }
 
 void GdSetBufferSize(Gd *gd, unsigned bufsize)
 {
     if (gd->bufsize_ == bufsize)
         return;
+    if (gd->pool_ && gd->bufsize_ != 0)
+        return;
 
     gd->bufsize_ = bufsize;
 
-    for (std::vector<float> &temp : gd->temp_)
-        temp.resize(bufsize);
+    for (unsigned i = 0; i < 2 + gd->numinputs_; ++i)
+        gd->temp_[i].resize(bufsize);
 
     gd->network_->setBufferSize(bufsize);
+    gd->convolution_->setBufferSize(bufsize);
 }
 
 void GdProcess(Gd *gd, const float *inputs[], float *outputs[], unsigned count)
 {
+    GdProcessWithTapOutputs(gd, inputs, outputs, nullptr, count);
+}
+
+// processes a block which is longer than the buffer size, for an instance
+// which cannot resize its buffers
+static void GdProcessInPieces(Gd *gd, const float *inputs[], float *outputs[], float **tapoutputs[], unsigned count)
+{
+    unsigned numinputs = gd->numinputs_;
+    unsigned numoutputs = gd->network_->getNumOutputs();
+
+    const float *pieceinputs[GdMaxChannels];
+    float *pieceoutputs[GdMaxChannels];
+    float *piecetapchannels[GdMaxLines][GdMaxChannels];
+    float **piecetapoutputs[GdMaxLines];
+
+    for (unsigned index = 0; index < count; ) {
+        unsigned piece = std::min(count - index, gd->bufsize_);
+        for (unsigned i = 0; i < numinputs; ++i)
+            pieceinputs[i] = inputs[i] + index;
+        for (unsigned i = 0; i < numoutputs; ++i)
+            pieceoutputs[i] = outputs[i] + index;
+        for (unsigned t = 0; tapoutputs && t < GdMaxLines; ++t) {
+            piecetapoutputs[t] = tapoutputs[t] ? piecetapchannels[t] : nullptr;
+            for (unsigned i = 0; tapoutputs[t] && i < numoutputs; ++i)
+                piecetapchannels[t][i] = tapoutputs[t][i] + index;
+        }
+        GdProcessWithTapOutputs(gd, pieceinputs, pieceoutputs, tapoutputs ? piecetapoutputs : nullptr, piece);
+        index += piece;
+    }
+}
+
+void GdProcessWithTapOutputs(Gd *gd, const float *inputs[], float *outputs[], float **tapoutputs[], unsigned count)
+{
+    // the recursions of the filters and the feedback decay into the range
+    // under normal, which is much slower on some processors
+    ScopedNoDenormals noDenormals;
+
     if (count > gd->bufsize_) { // safety measure
+        if (gd->pool_) {
+            GdProcessInPieces(gd, inputs, outputs, tapoutputs, count);
+            return;
+        }
         GdSetBufferSize(gd, nextPowerOfTwo(count));
     }
 
@@ -134,19 +283,242 @@ void GdProcess(Gd *gd, const float *inputs[], float *outputs[], unsigned count)
 
     ///
     unsigned numinputs = gd->numinputs_;
-    float *intermediates[] = { gd->temp_[2].data(), gd->temp_[3].data() };
+    float *intermediates[GdMaxChannels];
 
-    for (unsigned i = 0; i < numinputs; ++i)
+    for (unsigned i = 0; i < numinputs; ++i) {
+        intermediates[i] = gd->temp_[2 + i].data();
         std::copy_n(inputs[i], count, intermediates[i]);
+    }
 
-    gd->network_->process(intermediates, dry, wet, outputs, count);
+    gd->convolution_->process(*gd->network_, gd->parameters_, gd->tempo_, intermediates, dry, wet, outputs, tapoutputs, count);
+}
+
+//==============================================================================
+// frames per call of the offline render
+static constexpr unsigned kOfflineBlockSize = 512;
+// time for the effects of a chunk to settle in their groups, in their rates,
+// and in the tails of their filters
+static constexpr float kOfflineSettleTime = 1.0f;
+
+// renders the frames from `start` to `end`, after running from `preroll` with
+// the output discarded
+static void GdRenderChunk(const Gd *gd, const float *inputs[], float *outputs[], unsigned preroll, unsigned start, unsigned end)
+{
+    GdPtr chunk(GdNewCopy(gd));
+    GdSetBufferSize(chunk.get(), kOfflineBlockSize);
+
+    // the convolution switches at times which depend on its worker
+    GdSetParameter(chunk.get(), GDP_CONVOLUTION, 0);
+
+    unsigned numinputs = gd->numinputs_;
+    unsigned numoutputs = gd->network_->getNumOutputs();
+
+    std::vector<float> discarded(numoutputs * kOfflineBlockSize);
+
+    unsigned frame = preroll;
+    while (frame < end) {
+        // a block does not straddle the start
+        unsigned limit = (frame < start) ? start : end;
+        unsigned count = std::min(kOfflineBlockSize, limit - frame);
+
+        const float *blockinputs[GdMaxChannels];
+        float *blockoutputs[GdMaxChannels];
+        for (unsigned i = 0; i < numinputs; ++i)
+            blockinputs[i] = inputs[i] + frame;
+        for (unsigned i = 0; i < numoutputs; ++i)
+            blockoutputs[i] = (frame < start) ? &discarded[i * kOfflineBlockSize] : (outputs[i] + frame);
+
+        GdProcess(chunk.get(), blockinputs, blockoutputs, count);
+        frame += count;
+    }
+}
+
+void GdRenderOffline(Gd *gd, const float *inputs[], float *outputs[], unsigned count, float threshold, unsigned numthreads)
+{
+    const GdNetwork &network = *gd->network_;
+
+    // the grains of the shifter follow all the time since the start, which a
+    // pre-roll cannot reproduce, and a feedback which does not decay has no
+    // bound at all
+    float memorytime = network.getMemoryTime(threshold);
+    bool isbounded = !network.isShifting() && std::isfinite(memorytime);
+    unsigned prerollframes = !isbounded ? ~0u :
+        (unsigned)std::ceil((memorytime + kOfflineSettleTime) * gd->samplerate_);
+
+    if (numthreads == 0)
+        numthreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // a chunk shorter than its pre-roll would cost more than it saves
+    unsigned numchunks = 1;
+    if (isbounded)
+        numchunks = std::max(1u, std::min(numthreads, count / std::max(prerollframes, kOfflineBlockSize)));
+
+    std::vector<unsigned> starts(numchunks + 1);
+    for (unsigned k = 0; k <= numchunks; ++k)
+        starts[k] = (unsigned)((unsigned long long)count * k / numchunks);
+
+    auto renderChunk = [gd, inputs, outputs, prerollframes, &starts](unsigned k) {
+        unsigned start = starts[k];
+        unsigned preroll = start - std::min(start, prerollframes);
+        GdRenderChunk(gd, inputs, outputs, preroll, start, starts[k + 1]);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numchunks - 1);
+    for (unsigned k = 1; k < numchunks; ++k)
+        threads.emplace_back(renderChunk, k);
+    renderChunk(0);
+    for (std::thread &thread : threads)
+        thread.join();
+}
+
+//==============================================================================
+// identifies a state, and its format which changes with the version
+static constexpr uint32_t kStateMagic = 0x53644447; // 'GDdS'
+static constexpr uint32_t kStateVersion = 3;
+// the limits of the settings in a state
+static constexpr float kMinStateSampleRate = 1000;
+static constexpr float kMaxStateSampleRate = 768000;
+static constexpr unsigned kMaxStateBufferSize = 1u << 16;
+
+// the configuration which the instance that loads must have in common
+struct GdStateHeader {
+    uint32_t magic = kStateMagic;
+    uint32_t version = kStateVersion;
+    uint32_t numinputs = 0;
+    uint32_t channelmode = 0;
+    uint32_t numpairs = 0;
+    uint32_t numparameters = GD_PARAMETER_COUNT;
+};
+
+static GdStateHeader GdMakeStateHeader(const Gd *gd)
+{
+    const GdNetwork &network = *gd->network_;
+
+    GdStateHeader header;
+    header.numinputs = gd->numinputs_;
+    header.channelmode = (uint32_t)network.getChannelMode();
+    header.numpairs = network.getNumPairs();
+    return header;
+}
+
+size_t GdSaveState(Gd *gd, void *data, size_t size, bool compress)
+{
+    GdStateWriter writer(data, size, compress);
+
+    GdStateHeader header = GdMakeStateHeader(gd);
+    writer.value(header);
+    writer.value(gd->samplerate_);
+    writer.value(gd->bufsize_);
+    writer.value(gd->tempo_);
+    writer.value(gd->parameters_);
+
+    gd->smoothMixDryLinear_.archiveState(writer);
+    gd->smoothMixWetLinear_.archiveState(writer);
+    gd->network_->saveState(writer);
+
+    return writer.getSize();
+}
+
+// reads a state into `gd`, for loading it into `target`, which is either `gd`
+// or an instance with the same configuration; `gd` is only valid afterwards if
+// this returns true
+static bool GdReadState(Gd *gd, const Gd *target, const void *data, size_t size)
+{
+    GdStateReader reader(data, size);
+
+    // the header is checked before anything changes
+    GdStateHeader expected = GdMakeStateHeader(target);
+    GdStateHeader header;
+    reader.value(header);
+    if (!reader.isValid() || std::memcmp(&header, &expected, sizeof(GdStateHeader)) != 0)
+        return false;
+
+    float samplerate = 0;
+    unsigned bufsize = 0;
+    float tempo = 0;
+    float parameters[GD_PARAMETER_COUNT];
+    reader.value(samplerate);
+    reader.value(bufsize);
+    reader.value(tempo);
+    reader.value(parameters);
+    if (!reader.isValid())
+        return false;
+
+    // the settings are in the limits of a real instance, and the instance in
+    // caller memory cannot change them
+    if (!(samplerate >= kMinStateSampleRate && samplerate <= kMaxStateSampleRate) ||
+        bufsize == 0 || bufsize > kMaxStateBufferSize || !(tempo > 0 && std::isfinite(tempo)))
+        return false;
+    if (target->pool_ && (samplerate != target->samplerate_ || bufsize != target->bufsize_))
+        return false;
+    for (float value : parameters) {
+        if (!std::isfinite(value))
+            return false;
+    }
+
+    GdSetSampleRate(gd, samplerate);
+    GdSetBufferSize(gd, bufsize);
+    GdSetTempo(gd, tempo);
+    for (unsigned i = 0; i < GD_PARAMETER_COUNT; ++i) {
+        bool force = true;
+        GdSetParameterEx(gd, (GdParameter)i, parameters[i], force);
+    }
+
+    // the convolution starts over, from the taps of the network
+    GdClear(gd);
+
+    gd->smoothMixDryLinear_.archiveState(reader);
+    gd->smoothMixWetLinear_.archiveState(reader);
+    gd->network_->loadState(reader);
+
+    return reader.isValid() && reader.isAtEnd();
+}
+
+bool GdLoadState(Gd *gd, const void *data, size_t size)
+{
+    // the whole state is validated in a copy, before the instance changes
+    GdPtr copy(GdNewCopy(gd));
+    if (!GdReadState(copy.get(), gd, data, size))
+        return false;
+
+    bool loaded = GdReadState(gd, gd, data, size);
+    assert(loaded);
+    (void)loaded;
+
+    return true;
+}
+
+Gd *GdClone(Gd *gd)
+{
+    bool compress = true;
+    std::vector<uint8_t> state(GdSaveState(gd, nullptr, 0, compress));
+    GdSaveState(gd, state.data(), state.size(), compress);
+
+    // the state is valid, so it reads directly into the new instance
+    Gd *clone = GdNewCopy(gd);
+    bool loaded = GdReadState(clone, clone, state.data(), state.size());
+    assert(loaded);
+    (void)loaded;
+
+    return clone;
 }
 
 void GdSetTempo(Gd *gd, float tempo)
 {
+    if (gd->tempo_ != tempo) {
+        gd->tempo_ = tempo;
+        gd->convolution_->invalidate();
+    }
+
     gd->network_->setTempo(tempo);
 }
 
+unsigned GdGetLatency(Gd *gd)
+{
+    return gd->network_->getLatency();
+}
+
 void GdSetParameter(Gd *gd, GdParameter p, float value)
 {
     bool force = false;
@@ -172,6 +544,12 @@ void GdSetParameterEx(Gd *gd, GdParameter p, float value, bool force)
         gd->smoothMixWetLinear_.setTarget((value <= GdMinMixGainDB) ? 0.0f :
             db2linear(value));
         break;
+    case GDP_CONVOLUTION:
+        gd->convolution_->setEnabled(value != 0);
+        break;
+    default:
+        gd->convolution_->invalidate();
+        break;
     }
 
     gd->network_->setParameter((unsigned)p, value);
@@ -319,6 +697,13 @@ static char const* const GdTapLabels[GdMaxLines + 1] = {
 static char const* const GdFilterLabels[GdNumFilterTypes + 1] = {
     "6 dB/oct",
     "12 dB/oct",
+    "12 dB/oct SVF",
+    nullptr
+};
+static char const* const GdOversamplingLabels[GdNumOversamplingFactors + 1] = {
+    "Off",
+    "2x",
+    "4x",
     nullptr
 };
 
@@ -332,6 +717,8 @@ const char *const *GdParameterChoices(GdParameter p)
         return GdTapLabels;
     case GDP_TAP_A_FILTER:
         return GdFilterLabels;
+    case GDP_OVERSAMPLING:
+        return GdOversamplingLabels;
     default:
         return nullptr;
     }
@@ -425,3 +812,43 @@ void GdFormatParameterValue(GdParameter p, float value, char *text, unsigned tex
     }
     GdDefaultFormatParameterValue(p, value, text, textsize);
 }
+
+//==============================================================================
+#if GD_DENORMAL_COUNTERS
+std::atomic<unsigned long> gdDenormalCounts[GdNumDenormalStages] {};
+#endif
+
+unsigned long GdGetDenormalCount(GdDenormalStage stage)
+{
+#if GD_DENORMAL_COUNTERS
+    if ((unsigned)stage < GdNumDenormalStages)
+        return gdDenormalCounts[stage].load(std::memory_order_relaxed);
+#else
+    (void)stage;
+#endif
+    return 0;
+}
+
+void GdResetDenormalCounts()
+{
+#if GD_DENORMAL_COUNTERS
+    for (std::atomic<unsigned long> &count : gdDenormalCounts)
+        count.store(0, std::memory_order_relaxed);
+#endif
+}
+
+const char *GdDenormalStageName(GdDenormalStage stage)
+{
+    switch (stage) {
+    case GdDenormalsInFilters:
+        return "Filters";
+    case GdDenormalsInShifterAA:
+        return "Shifter AA";
+    case GdDenormalsInShifter:
+        return "Shifter";
+    case GdDenormalsInFeedback:
+        return "Feedback";
+    default:
+        return nullptr;
+    }
+}
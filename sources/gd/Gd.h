@@ -19,6 +19,7 @@
 
 #pragma once
 #include "GdDefs.h"
+#include <stddef.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -31,12 +32,48 @@ extern "C" {
 typedef struct Gd Gd;
 
 GD_API Gd *GdNew(unsigned numinputs, unsigned numoutputs);
+// the channels are the left and right of each pair, followed by the single
+// channels; the outputs are in the same order as the inputs
+GD_API Gd *GdNewMultichannel(unsigned numpairs, unsigned numsingles);
+// the size of the memory for `GdNewInPlace`, or 0 if the settings are not
+// valid; the query itself makes an instance on the heap to measure it, and no
+// flags are defined yet, so `flags` must be 0
+GD_API size_t GdQueryMemoryRequirements(unsigned numinputs, float samplerate, unsigned maxblock, unsigned flags);
+// makes an instance like `GdNew`, with 2 outputs, entirely in `memory`; it
+// returns null if the memory is smaller than the requirements. The sample rate
+// and the buffer size of this instance cannot change, longer blocks are split,
+// and the memory is released by the caller after `GdFree`.
+GD_API Gd *GdNewInPlace(void *memory, size_t size, unsigned numinputs, float samplerate, unsigned maxblock, unsigned flags);
 GD_API void GdFree(Gd *gd);
 GD_API void GdClear(Gd *gd);
 GD_API void GdSetSampleRate(Gd *gd, float samplerate);
 GD_API void GdSetBufferSize(Gd *gd, unsigned bufsize);
 GD_API void GdProcess(Gd *gd, const float *inputs[], float *outputs[], unsigned count);
+// processes like `GdProcess`, except that each tap which has non-null outputs in
+// `tapoutputs` goes to these instead of the main outputs; they have as many
+// channels as the main outputs, and they are overwritten
+GD_API void GdProcessWithTapOutputs(Gd *gd, const float *inputs[], float *outputs[], float **tapoutputs[], unsigned count);
+// renders a whole signal offline, with the parameters and the tempo of `gd`,
+// like a new instance would render it with `GdProcess`; the signal is split
+// into chunks which render in parallel, each one after a pre-roll which is
+// long enough for the responses of the earlier input to fall under
+// `threshold`, relative to their level; `numthreads` may be 0 to use all the
+// processors, and the state of `gd` itself does not change
+GD_API void GdRenderOffline(Gd *gd, const float *inputs[], float *outputs[], unsigned count, float threshold, unsigned numthreads);
+// saves the state of the processing with the parameters, at most `size` bytes
+// in `data`, which can be null, and returns the whole size of the state; the
+// silence in the lines is compressed if `compress` is true. The state only
+// loads on the same platform, into an instance which has the same channels.
+GD_API size_t GdSaveState(Gd *gd, void *data, size_t size, bool compress);
+// loads a state which `GdSaveState` has saved, and continues the processing
+// from there; it returns false if the state is not valid for this instance,
+// which then stays unchanged
+GD_API bool GdLoadState(Gd *gd, const void *data, size_t size);
+// makes an instance which continues the processing exactly like `gd`
+GD_API Gd *GdClone(Gd *gd);
 GD_API void GdSetTempo(Gd *gd, float tempo);
+// the latency of the processing in frames, which depends on the oversampling
+GD_API unsigned GdGetLatency(Gd *gd);
 GD_API void GdSetParameter(Gd *gd, GdParameter p, float value);
 GD_API void GdSetParameterEx(Gd *gd, GdParameter p, float value, bool force);
 GD_API float GdGetParameter(Gd *gd, GdParameter p);
@@ -56,6 +93,12 @@ GD_API int GdParameterGroup(GdParameter p);
 GD_API const char *GdGroupName(GdParameter p);
 GD_API const char *GdGroupLabel(GdParameter p);
 GD_API void GdFormatParameterValue(GdParameter p, float value, char *text, unsigned textsize);
+// the runs of a stage which have made results under the normal range, since
+// the start or the last reset, over all the instances; it is always 0 unless
+// the library is built with `GD_DENORMAL_COUNTERS`
+GD_API unsigned long GdGetDenormalCount(GdDenormalStage stage);
+GD_API void GdResetDenormalCounts();
+GD_API const char *GdDenormalStageName(GdDenormalStage stage);
 
 #if defined(__cplusplus)
 } // extern "C"
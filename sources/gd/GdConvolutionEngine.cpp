@@ -0,0 +1,383 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "GdConvolutionEngine.h"
+#include "utility/ScopedNoDenormals.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cassert>
+
+// time for which the network must be static, before its response is rendered
+static constexpr float kSettleTime = 1.0f;
+// duration of the crossfade between the taps and the convolution
+static constexpr float kFadeTime = 0.02f;
+
+// size of the blocks which render the response
+static constexpr unsigned kRenderBlockSize = 1024;
+// time which the network runs before the impulse, for its taps to settle in
+// their groups and their rates
+static constexpr float kRenderPrerollTime = 1.0f;
+// longest time for which the response continues after the longest delay,
+// and the level relative to the peak under which it counts as ended
+static constexpr float kMaxTailTime = 2.0f;
+static constexpr float kTailThreshold = 1e-5f;
+
+// interval at which the worker checks for work, if it missed a wake-up
+static constexpr int kWorkerPollMilliseconds = 100;
+
+GdConvolutionEngine::GdConvolutionEngine(const GdNetwork &network)
+    : channelMode_(network.getChannelMode()),
+      numPairs_(network.getNumPairs()),
+      numInputs_(network.getNumInputs()),
+      numOutputs_(network.getNumOutputs())
+{
+}
+
+GdConvolutionEngine::~GdConvolutionEngine()
+{
+    if (worker_.joinable()) {
+        std::unique_lock<std::mutex> lock(workerMutex_);
+        quit_ = true;
+        lock.unlock();
+        workerCondition_.notify_one();
+        worker_.join();
+    }
+
+    delete response_;
+    delete readyResponse_.exchange(nullptr);
+    for (std::atomic<Response *> &retired : retiredResponses_)
+        delete retired.exchange(nullptr);
+}
+
+void GdConvolutionEngine::setEnabled(bool enabled)
+{
+    enabled_ = enabled;
+
+    // the worker starts with the first use, not with every instance
+    if (enabled && !worker_.joinable())
+        startWorker();
+}
+
+void GdConvolutionEngine::clear()
+{
+    retire(response_);
+    response_ = nullptr;
+    state_ = kLive;
+    requestedVersion_ = ~0u;
+    staticFrames_ = 0;
+    fadeWeight_ = 0;
+    invalidate();
+}
+
+void GdConvolutionEngine::setSampleRate(float sampleRate)
+{
+    sampleRate_ = sampleRate;
+    clear();
+}
+
+void GdConvolutionEngine::setBufferSize(unsigned bufferSize)
+{
+    bufferSize_ = bufferSize;
+
+    networkWet_.resize(bufferSize);
+    convolutionWet_.resize(bufferSize);
+    for (unsigned chanIndex = 0; chanIndex < numOutputs_; ++chanIndex)
+        convolutionOutputs_[chanIndex].resize(bufferSize);
+}
+
+void GdConvolutionEngine::invalidate()
+{
+    version_.fetch_add(1);
+}
+
+void GdConvolutionEngine::process(GdNetwork &network, const float *parameters, float tempo, const float *const inputs[], const float *dry, const float *wet, float *const outputs[], float *const *const directOutputs[], unsigned count)
+{
+    unsigned version = version_.load();
+
+    // the convolution cannot route the taps one by one
+    bool isStatic = enabled_ && !directOutputs && network.isStatic();
+    staticFrames_ = isStatic ? std::min(staticFrames_ + count, ~0u - count) : 0;
+
+    // take the response which is ready, if it's still valid
+    if (Response *ready = readyResponse_.exchange(nullptr)) {
+        if (state_ == kLive && isStatic && ready->version == version) {
+            response_ = ready;
+            state_ = kPriming;
+            primedFrames_ = 0;
+        }
+        else {
+            retire(ready);
+            requestedVersion_ = ~0u;
+        }
+    }
+
+    // request the response of the current parameters
+    if (state_ == kLive && staticFrames_ >= (unsigned)(kSettleTime * sampleRate_) &&
+        requestedVersion_ != version && !isJobPending_.load())
+    {
+        Job &job = job_;
+        std::copy_n(parameters, GD_PARAMETER_COUNT, job.parameters);
+        job.tempo = tempo;
+        job.sampleRate = sampleRate_;
+        job.bufferSize = bufferSize_;
+        job.version = version;
+        requestedVersion_ = version;
+        isJobPending_.store(true);
+        workerCondition_.notify_one();
+    }
+
+    // return to the taps, once the response is not valid anymore; they
+    // were silent, so the convolution continues until they are warm
+    if (response_ && (!isStatic || response_->version != version)) {
+        if (state_ == kPriming) {
+            retire(response_);
+            response_ = nullptr;
+            state_ = kLive;
+            requestedVersion_ = ~0u;
+        }
+        else if (state_ != kFadingOut)
+            state_ = kWaking;
+    }
+
+    network.setKeepWarm(state_ == kWaking);
+
+    if (!response_) {
+        network.process(inputs, dry, wet, outputs, directOutputs, count);
+        return;
+    }
+
+    GdConvolver &convolver = response_->convolver;
+    float *convolutionOutputs[GdMaxChannels];
+    for (unsigned chanIndex = 0; chanIndex < numOutputs_; ++chanIndex) {
+        convolutionOutputs[chanIndex] = convolutionOutputs_[chanIndex].data();
+        std::fill_n(convolutionOutputs[chanIndex], count, 0.0f);
+    }
+
+    // the convolution fills its history, and it needs to compute its output
+    // only for the partitions which end after
+    if (state_ == kPriming) {
+        network.process(inputs, dry, wet, outputs, directOutputs, count);
+
+        unsigned length = convolver.getLength();
+        bool needsOutput = primedFrames_ + count + convolver.getLookahead() >= length;
+        convolver.process(inputs, needsOutput ? convolutionOutputs : nullptr, count);
+
+        primedFrames_ = std::min(primedFrames_ + count, length);
+        if (primedFrames_ == length)
+            state_ = kFadingIn;
+        return;
+    }
+
+    // crossfade the taps and the convolution
+    float *networkWet = networkWet_.data();
+    float *convolutionWet = convolutionWet_.data();
+    float weight = fadeWeight_;
+    float step = (state_ == kFadingIn) ? (1.0f / (kFadeTime * sampleRate_)) :
+        (state_ == kFadingOut) ? (-1.0f / (kFadeTime * sampleRate_)) : 0.0f;
+    for (unsigned i = 0; i < count; ++i) {
+        weight = std::max(0.0f, std::min(1.0f, weight + step));
+        networkWet[i] = wet[i] * (1.0f - weight);
+        convolutionWet[i] = wet[i] * weight;
+    }
+    fadeWeight_ = weight;
+
+    // once the taps are off, the network only writes their lines, unless
+    // they are waking
+    network.process(inputs, dry, networkWet, outputs, directOutputs, count);
+
+    convolver.process(inputs, convolutionOutputs, count);
+    for (unsigned chanIndex = 0; chanIndex < numOutputs_; ++chanIndex) {
+        float *output = outputs[chanIndex];
+        const float *convolutionOutput = convolutionOutputs[chanIndex];
+        for (unsigned i = 0; i < count; ++i)
+            output[i] += convolutionWet[i] * convolutionOutput[i];
+    }
+
+    if (state_ == kFadingIn && weight == 1.0f)
+        state_ = kActive;
+    else if (state_ == kWaking && network.isWarm())
+        state_ = kFadingOut;
+    else if (state_ == kFadingOut && weight == 0.0f) {
+        retire(response_);
+        response_ = nullptr;
+        state_ = kLive;
+        requestedVersion_ = ~0u;
+    }
+}
+
+void GdConvolutionEngine::retire(Response *response)
+{
+    if (!response)
+        return;
+
+    for (std::atomic<Response *> &retired : retiredResponses_) {
+        Response *expected = nullptr;
+        if (retired.compare_exchange_strong(expected, response)) {
+            workerCondition_.notify_one();
+            return;
+        }
+    }
+
+    // the worker frees them much faster than they are made, so this is
+    // not expected to happen
+    assert(false);
+    delete response;
+}
+
+//==============================================================================
+void GdConvolutionEngine::startWorker()
+{
+    quit_ = false;
+    worker_ = std::thread([this]() { runWorker(); });
+}
+
+void GdConvolutionEngine::runWorker()
+{
+    std::unique_lock<std::mutex> lock(workerMutex_);
+
+    while (!quit_) {
+        workerCondition_.wait_for(lock, std::chrono::milliseconds(kWorkerPollMilliseconds));
+
+        for (std::atomic<Response *> &retired : retiredResponses_)
+            delete retired.exchange(nullptr);
+
+        if (quit_ || !isJobPending_.load())
+            continue;
+
+        Job job = job_;
+        isJobPending_.store(false);
+
+        lock.unlock();
+        Response *response = renderResponse(job);
+        delete readyResponse_.exchange(response);
+        lock.lock();
+    }
+}
+
+GdConvolutionEngine::Response *GdConvolutionEngine::renderResponse(const Job &job)
+{
+    // the worker renders the tail like the processing, in its own thread
+    ScopedNoDenormals noDenormals;
+
+    unsigned numInputs = numInputs_;
+    unsigned numOutputs = numOutputs_;
+    unsigned numPairs = numPairs_;
+    float sampleRate = job.sampleRate;
+
+    std::unique_ptr<GdNetwork> network((channelMode_ == GdNetwork::Multichannel) ?
+        new GdNetwork(numPairs, numInputs - 2 * numPairs) : new GdNetwork(channelMode_));
+
+    network->setTempo(job.tempo);
+    for (unsigned p = 0; p < GD_PARAMETER_COUNT; ++p)
+        network->setParameter(p, job.parameters[p]);
+
+    // the lines only need to reach the longest delay, after the latency
+    float longestDelay = network->getLongestTapDelay() + (float)network->getLatency() / sampleRate;
+    network->setMaxDelay(std::min((float)GdMaxDelay, longestDelay) + 2.0f / sampleRate);
+    network->setSampleRate(sampleRate);
+    network->setBufferSize(kRenderBlockSize);
+
+    unsigned prerollFrames = (unsigned)std::ceil(kRenderPrerollTime * sampleRate);
+    unsigned longestFrames = (unsigned)std::ceil(longestDelay * sampleRate) + 1;
+    unsigned maxFrames = longestFrames + (unsigned)std::ceil(kMaxTailTime * sampleRate);
+
+    std::vector<float> dry(kRenderBlockSize, 0.0f);
+    std::vector<float> wet(kRenderBlockSize, 1.0f);
+    std::vector<float> silence(kRenderBlockSize, 0.0f);
+    std::vector<float> impulse(kRenderBlockSize, 0.0f);
+    impulse[0] = 1.0f;
+    std::vector<float> blockOutputs[GdMaxChannels];
+    float *outputs[GdMaxChannels];
+    for (unsigned o = 0; o < numOutputs; ++o) {
+        blockOutputs[o].resize(kRenderBlockSize);
+        outputs[o] = blockOutputs[o].data();
+    }
+
+    // the responses from each input to each output
+    std::vector<std::vector<float>> responses(numOutputs * numInputs);
+    unsigned length = 0;
+
+    // the channels mix only within their pair, so a render can measure the
+    // left channels of all the pairs together with the single channels,
+    // and another render the right channels
+    unsigned numRenders = (numPairs > 0) ? 2 : 1;
+    for (unsigned render = 0; render < numRenders; ++render) {
+        network->clear();
+
+        const float *inputs[GdMaxChannels];
+        for (unsigned i = 0; i < numInputs; ++i)
+            inputs[i] = silence.data();
+        for (unsigned frame = 0; frame < prerollFrames; frame += kRenderBlockSize)
+            network->process(inputs, dry.data(), wet.data(), outputs, nullptr, kRenderBlockSize);
+
+        // the input to which each output responds
+        int sources[GdMaxChannels];
+        for (unsigned o = 0; o < numOutputs; ++o) {
+            if (channelMode_ == GdNetwork::Mono)
+                sources[o] = 0;
+            else if (o < 2 * numPairs)
+                sources[o] = (int)(2 * (o / 2) + render);
+            else
+                sources[o] = (render == 0) ? (int)o : -1;
+        }
+
+        float peak = 0;
+        unsigned frame = 0;
+        while (frame < maxFrames) {
+            for (unsigned i = 0; i < numInputs; ++i) {
+                bool isSource = (i < 2 * numPairs) ? (i % 2 == render) : (render == 0);
+                inputs[i] = (frame == 0 && isSource) ? impulse.data() : silence.data();
+            }
+            network->process(inputs, dry.data(), wet.data(), outputs, nullptr, kRenderBlockSize);
+
+            float blockPeak = 0;
+            for (unsigned o = 0; o < numOutputs; ++o) {
+                if (sources[o] == -1)
+                    continue;
+                std::vector<float> &response = responses[o * numInputs + (unsigned)sources[o]];
+                response.insert(response.end(), outputs[o], outputs[o] + kRenderBlockSize);
+                for (unsigned j = 0; j < kRenderBlockSize; ++j)
+                    blockPeak = std::max(blockPeak, std::fabs(outputs[o][j]));
+            }
+            peak = std::max(peak, blockPeak);
+            frame += kRenderBlockSize;
+
+            // after the longest delay, wait until the effects have decayed
+            if (frame >= longestFrames && blockPeak <= kTailThreshold * peak)
+                break;
+        }
+
+        length = std::max(length, frame);
+    }
+
+    const float *irs[GdMaxChannels * GdMaxChannels] {};
+    for (unsigned k = 0; k < numOutputs * numInputs; ++k) {
+        std::vector<float> &response = responses[k];
+        if (!response.empty()) {
+            response.resize(length);
+            irs[k] = response.data();
+        }
+    }
+
+    std::unique_ptr<Response> result(new Response);
+    result->convolver.init(numInputs, numOutputs, irs, length, job.bufferSize);
+    result->version = job.version;
+    return result.release();
+}
@@ -0,0 +1,117 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+#include "GdConvolver.h"
+#include "GdNetwork.h"
+#include "GdDefs.h"
+#include "utility/MemoryPool.h"
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+/**
+ * @brief Replaces the taps of a static network by the convolution with its response
+ *
+ * Once the network has been static for a while, a worker renders its response
+ * with a copy of the parameters, and prepares a convolver. The convolver takes
+ * the input in the background, until it has the history of a whole response,
+ * and then it fades in, while the taps of the network fade out. The lines of
+ * the network continue to be written. Once the parameters change, the
+ * convolution continues while the taps warm up again, unheard, and then the
+ * taps fade back in.
+ */
+class GdConvolutionEngine {
+public:
+    explicit GdConvolutionEngine(const GdNetwork &network);
+    ~GdConvolutionEngine();
+    void setEnabled(bool enabled);
+    void clear();
+    void setSampleRate(float sampleRate);
+    void setBufferSize(unsigned bufferSize);
+    // the parameters have changed, so the response is not valid anymore
+    void invalidate();
+    // processes the network, with the parameters of which it would render the response
+    void process(GdNetwork &network, const float *parameters, float tempo, const float *const inputs[], const float *dry, const float *wet, float *const outputs[], float *const *const directOutputs[], unsigned count);
+
+private:
+    struct Response {
+        GdConvolver convolver;
+        unsigned version = 0;
+    };
+
+    struct Job {
+        float parameters[GD_PARAMETER_COUNT] {};
+        float tempo = 0;
+        float sampleRate = 0;
+        unsigned bufferSize = 0;
+        unsigned version = 0;
+    };
+
+    void startWorker();
+    void runWorker();
+    Response *renderResponse(const Job &job);
+    void retire(Response *response);
+
+    enum State {
+        kLive,
+        kPriming,
+        kFadingIn,
+        kActive,
+        kWaking,
+        kFadingOut,
+    };
+
+    // configuration of the network
+    GdNetwork::ChannelMode channelMode_;
+    unsigned numPairs_ = 0;
+    unsigned numInputs_ = 0;
+    unsigned numOutputs_ = 0;
+
+    // audio thread
+    bool enabled_ = false;
+    float sampleRate_ = 0;
+    unsigned bufferSize_ = 0;
+    State state_ = kLive;
+    Response *response_ = nullptr;
+    std::atomic<unsigned> version_{0};
+    unsigned requestedVersion_ = ~0u;
+    unsigned staticFrames_ = 0;
+    unsigned primedFrames_ = 0;
+    float fadeWeight_ = 0;
+    PoolVector<float> networkWet_;
+    PoolVector<float> convolutionWet_;
+    PoolVector<float> convolutionOutputs_[GdMaxChannels];
+
+    // exchanges with the worker
+    Job job_;
+    std::atomic<bool> isJobPending_{false};
+    std::atomic<Response *> readyResponse_{nullptr};
+    enum { kMaxRetiredResponses = 4 };
+    std::atomic<Response *> retiredResponses_[kMaxRetiredResponses] {};
+
+    // worker
+    std::thread worker_;
+    std::mutex workerMutex_;
+    std::condition_variable workerCondition_;
+    bool quit_ = false;
+};
@@ -0,0 +1,462 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "GdConvolver.h"
+#include "GdDefs.h"
+#include "utility/NextPowerOfTwo.h"
+#include <simde/x86/sse.h>
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+
+// size of the smallest partitions, and of the steps of the processing
+static constexpr unsigned kMinBlockSize = 64;
+// size of the largest partitions, of which the transforms are the largest
+// work which does not divide
+static constexpr unsigned kMaxBlockSize = 16384;
+
+namespace {
+
+struct LevelPlan {
+    unsigned blockSize;
+    unsigned offset;
+    unsigned numPartitions;
+};
+
+} // namespace
+
+// cuts the response from `start` to `length` into partitions, which double in
+// size once they start late enough to have the time to compute, over a whole
+// block of their size
+static void planLevels(unsigned start, unsigned length, unsigned maxBlockSize, std::vector<LevelPlan> &plan)
+{
+    plan.clear();
+
+    unsigned blockSize = kMinBlockSize;
+    unsigned offset = std::max(start, kMinBlockSize);
+
+    while (offset < length) {
+        while (2 * blockSize <= maxBlockSize && offset >= 4 * blockSize)
+            blockSize *= 2;
+        if (plan.empty() || plan.back().blockSize != blockSize)
+            plan.push_back(LevelPlan{blockSize, offset, 0});
+        ++plan.back().numPartitions;
+        offset += blockSize;
+    }
+}
+
+// an estimate of the operations of a transform, for a block of the size
+static float estimateTransformCost(unsigned blockSize)
+{
+    return 5.0f * (float)blockSize * std::log2(2.0f * (float)blockSize);
+}
+
+// an estimate of the operations per frame, with the transforms of every input
+// and output, and the products of the spectra of every path
+static float estimateCost(const std::vector<LevelPlan> &plan, unsigned numPaths, unsigned numInputs, unsigned numOutputs)
+{
+    float cost = 0;
+    for (const LevelPlan &level : plan) {
+        float transformCost = estimateTransformCost(level.blockSize) / (float)level.blockSize;
+        cost += (float)(numInputs + numOutputs) * transformCost + 8.0f * (float)(level.numPartitions * numPaths);
+    }
+    return cost;
+}
+
+// an estimate of the operations of the heaviest call, which does the share of
+// its frames in the work, except for a transform, which runs at once
+static float estimatePeakCost(const std::vector<LevelPlan> &plan, unsigned numPaths, unsigned numInputs, unsigned numOutputs, unsigned bufferSize)
+{
+    float transformCost = 0;
+    for (const LevelPlan &level : plan)
+        transformCost = std::max(transformCost, estimateTransformCost(level.blockSize));
+    float frames = (float)std::max(bufferSize, kMinBlockSize);
+    return frames * estimateCost(plan, numPaths, numInputs, numOutputs) + transformCost;
+}
+
+// accumulates the product of spectra in split form, of which the first bin
+// holds the real DC and Nyquist frequency
+static void multiplyAccumulate(float *accReal, float *accImag, const float *aReal, const float *aImag, const float *bReal, const float *bImag, unsigned numBins)
+{
+    assert(numBins % 4 == 0);
+
+    float dc = accReal[0] + aReal[0] * bReal[0];
+    float nyquist = accImag[0] + aImag[0] * bImag[0];
+
+    for (unsigned k = 0; k < numBins; k += 4) {
+        simde__m128 ar = simde_mm_loadu_ps(&aReal[k]);
+        simde__m128 ai = simde_mm_loadu_ps(&aImag[k]);
+        simde__m128 br = simde_mm_loadu_ps(&bReal[k]);
+        simde__m128 bi = simde_mm_loadu_ps(&bImag[k]);
+        simde__m128 re = simde_mm_sub_ps(simde_mm_mul_ps(ar, br), simde_mm_mul_ps(ai, bi));
+        simde__m128 im = simde_mm_add_ps(simde_mm_mul_ps(ar, bi), simde_mm_mul_ps(ai, br));
+        simde_mm_storeu_ps(&accReal[k], simde_mm_add_ps(simde_mm_loadu_ps(&accReal[k]), re));
+        simde_mm_storeu_ps(&accImag[k], simde_mm_add_ps(simde_mm_loadu_ps(&accImag[k]), im));
+    }
+
+    accReal[0] = dc;
+    accImag[0] = nyquist;
+}
+
+//==============================================================================
+void GdConvolver::init(unsigned numInputs, unsigned numOutputs, const float *const irs[], unsigned length, unsigned bufferSize)
+{
+    numInputs_ = numInputs;
+    numOutputs_ = numOutputs;
+
+    // find the paths which are not silent, and where the responses start and end
+    pathInputs_.clear();
+    pathOutputs_.clear();
+    std::vector<const float *> pathResponses;
+
+    unsigned start = length;
+    unsigned end = 0;
+    for (unsigned o = 0; o < numOutputs; ++o) {
+        for (unsigned i = 0; i < numInputs; ++i) {
+            const float *ir = irs[o * numInputs + i];
+            if (!ir)
+                continue;
+            unsigned first = 0;
+            while (first < length && ir[first] == 0)
+                ++first;
+            if (first == length)
+                continue;
+            unsigned last = length;
+            while (ir[last - 1] == 0)
+                --last;
+            start = std::min(start, first);
+            end = std::max(end, last);
+            pathInputs_.push_back(i);
+            pathOutputs_.push_back(o);
+            pathResponses.push_back(ir);
+        }
+    }
+
+    unsigned numPaths = (unsigned)pathResponses.size();
+    if (numPaths == 0)
+        start = end = 0;
+    length_ = end;
+
+    // take the size of the largest partitions which costs the least, in the
+    // heaviest call rather than on average
+    std::vector<LevelPlan> plan;
+    {
+        float bestCost = 0;
+        unsigned bestBlockSize = kMinBlockSize;
+        for (unsigned maxBlockSize = kMinBlockSize; maxBlockSize <= kMaxBlockSize; maxBlockSize *= 2) {
+            planLevels(start, end, maxBlockSize, plan);
+            float cost = estimatePeakCost(plan, numPaths, numInputs, numOutputs, bufferSize);
+            if (maxBlockSize == kMinBlockSize || cost < bestCost) {
+                bestCost = cost;
+                bestBlockSize = maxBlockSize;
+            }
+        }
+        planLevels(start, end, bestBlockSize, plan);
+    }
+
+    // the start of the response, before the first partition
+    headStart_ = std::min(start, kMinBlockSize);
+    headLength_ = std::min(end, kMinBlockSize) - headStart_;
+    head_.assign(numPaths * headLength_, 0.0f);
+    for (unsigned p = 0; p < numPaths; ++p) {
+        // reversed, to run along the input
+        for (unsigned j = 0; j < headLength_; ++j)
+            head_[p * headLength_ + j] = pathResponses[p][headStart_ + headLength_ - 1 - j];
+    }
+
+    // the partitions
+    unsigned maxBlockSize = kMinBlockSize;
+    unsigned maxExtent = kMinBlockSize;
+    lookahead_ = 0;
+
+    levels_.clear();
+    levels_.resize(plan.size());
+    for (size_t l = 0; l < plan.size(); ++l) {
+        Level &level = levels_[l];
+        unsigned blockSize = plan[l].blockSize;
+        unsigned numPartitions = plan[l].numPartitions;
+        level.blockSize = blockSize;
+        level.offset = plan[l].offset;
+        level.numPartitions = numPartitions;
+        level.fft.setSize(2 * blockSize);
+        level.partitions.assign((size_t)numPartitions * numPaths * 2 * blockSize, 0.0f);
+        level.isActive.assign((size_t)numPartitions * numPaths, 0);
+        level.history.assign((size_t)numPartitions * numInputs * 2 * blockSize, 0.0f);
+        level.historySlot = 0;
+
+        // the partitions include the normalization of the inverse transform
+        std::vector<float> frames(2 * blockSize);
+        float gain = 1.0f / (float)(2 * blockSize);
+        for (unsigned k = 0; k < numPartitions; ++k) {
+            unsigned segmentStart = level.offset + k * blockSize;
+            unsigned segmentEnd = std::min(end, segmentStart + blockSize);
+            for (unsigned p = 0; p < numPaths; ++p) {
+                const float *ir = pathResponses[p];
+                bool isActive = false;
+                std::fill(frames.begin(), frames.end(), 0.0f);
+                for (unsigned j = segmentStart; j < segmentEnd; ++j) {
+                    frames[j - segmentStart] = gain * ir[j];
+                    isActive = isActive || ir[j] != 0;
+                }
+                float *spectrum = &level.partitions[((size_t)k * numPaths + p) * 2 * blockSize];
+                level.fft.forward(frames.data(), spectrum, spectrum + blockSize);
+                level.isActive[(size_t)k * numPaths + p] = isActive;
+            }
+        }
+
+        // the costs of the tasks, in the order they run
+        level.hasOutput.assign(numOutputs, 0);
+        std::vector<float> taskCosts;
+        float transformCost = estimateTransformCost(blockSize);
+        taskCosts.assign(numInputs, transformCost);
+        for (unsigned o = 0; o < numOutputs; ++o) {
+            for (unsigned k = 0; k < numPartitions; ++k) {
+                unsigned numActive = 0;
+                for (unsigned p = 0; p < numPaths; ++p)
+                    numActive += pathOutputs_[p] == o && level.isActive[(size_t)k * numPaths + p];
+                taskCosts.push_back(8.0f * (float)(blockSize * numActive));
+                level.hasOutput[o] = level.hasOutput[o] || numActive > 0;
+            }
+            taskCosts.push_back(level.hasOutput[o] ? transformCost : 0.0f);
+        }
+
+        // the steps until the output is due, which must end before the next
+        // block; the first step is at the boundary, so there is at least one
+        unsigned slack = std::min(level.offset - blockSize, blockSize);
+        unsigned numSteps = std::max(1u, slack / kMinBlockSize);
+        float totalCost = 0;
+        for (float cost : taskCosts)
+            totalCost += cost;
+
+        // share the costs evenly, with each task in the step where most of it falls
+        level.stepTasks.resize(numSteps);
+        unsigned numTasks = (unsigned)taskCosts.size();
+        unsigned task = 0;
+        float doneCost = 0;
+        for (unsigned s = 0; s + 1 < numSteps; ++s) {
+            float stepCost = totalCost * (float)(s + 1) / (float)numSteps;
+            while (task < numTasks && doneCost + 0.5f * taskCosts[task] <= stepCost)
+                doneCost += taskCosts[task++];
+            level.stepTasks[s] = task;
+        }
+        level.stepTasks[numSteps - 1] = numTasks;
+        level.step = numSteps;
+        level.task = 0;
+        level.accumulators.assign((size_t)numOutputs * 2 * blockSize, 0.0f);
+
+        maxBlockSize = std::max(maxBlockSize, blockSize);
+        maxExtent = std::max(maxExtent, level.offset + blockSize);
+        lookahead_ = std::max(lookahead_, level.offset);
+    }
+
+    // the last two blocks of input remain until the end of the steps
+    inputSize_ = nextPowerOfTwo(3 * maxBlockSize);
+    inputs_.assign((size_t)numInputs * 2 * inputSize_, 0.0f);
+    outputSize_ = nextPowerOfTwo(maxExtent + kMinBlockSize);
+    outputs_.assign((size_t)numOutputs * outputSize_, 0.0f);
+
+    blockFrames_.resize(2 * maxBlockSize);
+
+    frameCount_ = 0;
+}
+
+void GdConvolver::clear()
+{
+    std::fill(inputs_.begin(), inputs_.end(), 0.0f);
+    std::fill(outputs_.begin(), outputs_.end(), 0.0f);
+    for (Level &level : levels_) {
+        std::fill(level.history.begin(), level.history.end(), 0.0f);
+        level.historySlot = 0;
+        level.step = (unsigned)level.stepTasks.size();
+        level.task = 0;
+    }
+    frameCount_ = 0;
+}
+
+void GdConvolver::process(const float *const inputs[], float *const outputs[], unsigned count)
+{
+    unsigned numInputs = numInputs_;
+    unsigned numOutputs = numOutputs_;
+    unsigned inputMask = inputSize_ - 1;
+    unsigned outputMask = outputSize_ - 1;
+
+    unsigned index = 0;
+    while (index < count) {
+        // go until the next block boundary
+        unsigned phase = frameCount_ & (kMinBlockSize - 1);
+        unsigned chunk = std::min(count - index, kMinBlockSize - phase);
+
+        for (unsigned i = 0; i < numInputs; ++i) {
+            float *history = &inputs_[(size_t)i * 2 * inputSize_];
+            const float *input = inputs[i] + index;
+            for (unsigned j = 0; j < chunk; ++j) {
+                unsigned position = (frameCount_ + j) & inputMask;
+                history[position] = input[j];
+                history[position + inputSize_] = input[j];
+            }
+        }
+
+        if (outputs) {
+            // the sums of the partitions
+            for (unsigned o = 0; o < numOutputs; ++o) {
+                float *sums = &outputs_[(size_t)o * outputSize_];
+                float *output = outputs[o] + index;
+                for (unsigned j = 0; j < chunk; ++j) {
+                    unsigned position = (frameCount_ + j) & outputMask;
+                    output[j] += sums[position];
+                    sums[position] = 0;
+                }
+            }
+
+            // the start of the responses
+            float *chunkOutputs[GdMaxChannels];
+            for (unsigned o = 0; o < numOutputs; ++o)
+                chunkOutputs[o] = outputs[o] + index;
+            computeHead(chunkOutputs, chunk);
+        }
+
+        frameCount_ += chunk;
+        index += chunk;
+
+        if ((frameCount_ & (kMinBlockSize - 1)) == 0)
+            processBlocks(outputs != nullptr);
+    }
+}
+
+void GdConvolver::computeHead(float *const outputs[], unsigned count)
+{
+    unsigned headLength = headLength_;
+    if (headLength == 0)
+        return;
+
+    unsigned inputMask = inputSize_ - 1;
+    unsigned numPaths = (unsigned)pathInputs_.size();
+
+    for (unsigned p = 0; p < numPaths; ++p) {
+        const float *history = &inputs_[(size_t)pathInputs_[p] * 2 * inputSize_];
+        const float *head = &head_[(size_t)p * headLength];
+        float *output = outputs[pathOutputs_[p]];
+
+        for (unsigned j = 0; j < count; ++j) {
+            // the frames which meet the reversed response, in a contiguous range
+            unsigned last = (frameCount_ + j - headStart_) & inputMask;
+            const float *frames = &history[last + inputSize_ + 1 - headLength];
+
+            simde__m128 sum = simde_mm_setzero_ps();
+            unsigned m = 0;
+            for (; m + 3 < headLength; m += 4)
+                sum = simde_mm_add_ps(sum, simde_mm_mul_ps(simde_mm_loadu_ps(&head[m]), simde_mm_loadu_ps(&frames[m])));
+            float y = ((float *)&sum)[0] + ((float *)&sum)[1] + ((float *)&sum)[2] + ((float *)&sum)[3];
+            for (; m < headLength; ++m)
+                y += head[m] * frames[m];
+
+            output[j] += y;
+        }
+    }
+}
+
+void GdConvolver::processBlocks(bool computeOutput)
+{
+    unsigned boundary = frameCount_;
+
+    for (Level &level : levels_) {
+        unsigned blockSize = level.blockSize;
+
+        // a new block, after the previous one is done
+        if ((boundary & (blockSize - 1)) == 0) {
+            assert(level.step == level.stepTasks.size());
+            unsigned numPartitions = level.numPartitions;
+            level.historySlot = (level.historySlot + 1 < numPartitions) ? (level.historySlot + 1) : 0;
+            level.boundary = boundary;
+            level.computesOutput = computeOutput;
+            level.step = 0;
+            level.task = 0;
+        }
+
+        if (level.step < level.stepTasks.size())
+            runTasks(level, level.stepTasks[level.step++]);
+    }
+}
+
+void GdConvolver::runTasks(Level &level, unsigned endTask)
+{
+    unsigned numInputs = numInputs_;
+    unsigned numPaths = (unsigned)pathInputs_.size();
+    unsigned inputMask = inputSize_ - 1;
+    unsigned outputMask = outputSize_ - 1;
+    unsigned blockSize = level.blockSize;
+    unsigned numPartitions = level.numPartitions;
+    unsigned slot = level.historySlot;
+    unsigned spectrumSize = 2 * blockSize;
+    unsigned boundary = level.boundary;
+
+    // without output, only the spectra of the input
+    if (!level.computesOutput)
+        endTask = std::min(endTask, numInputs);
+
+    for (unsigned task = level.task; task < endTask; ++task) {
+        // the spectra of the last two blocks of input
+        if (task < numInputs) {
+            unsigned i = task;
+            const float *history = &inputs_[(size_t)i * 2 * inputSize_];
+            unsigned last = (boundary - 1) & inputMask;
+            const float *frames = &history[last + inputSize_ + 1 - 2 * blockSize];
+            float *spectrum = &level.history[((size_t)slot * numInputs + i) * spectrumSize];
+            level.fft.forward(frames, spectrum, spectrum + blockSize);
+            continue;
+        }
+
+        unsigned o = (task - numInputs) / (numPartitions + 1);
+        unsigned k = (task - numInputs) % (numPartitions + 1);
+        float *accReal = &level.accumulators[(size_t)o * spectrumSize];
+        float *accImag = accReal + blockSize;
+
+        // the products with a partition, of the input which is as late as
+        // the start of the partition
+        if (k < numPartitions) {
+            if (k == 0) {
+                std::fill_n(accReal, blockSize, 0.0f);
+                std::fill_n(accImag, blockSize, 0.0f);
+            }
+            unsigned inputSlot = (slot >= k) ? (slot - k) : (slot + numPartitions - k);
+            for (unsigned p = 0; p < numPaths; ++p) {
+                if (pathOutputs_[p] != o || !level.isActive[(size_t)k * numPaths + p])
+                    continue;
+                const float *x = &level.history[((size_t)inputSlot * numInputs + pathInputs_[p]) * spectrumSize];
+                const float *h = &level.partitions[((size_t)k * numPaths + p) * spectrumSize];
+                multiplyAccumulate(accReal, accImag, x, x + blockSize, h, h + blockSize, blockSize);
+            }
+            continue;
+        }
+
+        if (!level.hasOutput[o])
+            continue;
+
+        // the second half is the linear part of the circular convolution
+        float *frames = blockFrames_.data();
+        level.fft.inverse(accReal, accImag, frames);
+
+        float *sums = &outputs_[(size_t)o * outputSize_];
+        unsigned position = boundary - blockSize + level.offset;
+        for (unsigned j = 0; j < blockSize; ++j)
+            sums[(position + j) & outputMask] += frames[blockSize + j];
+    }
+
+    level.task = endTask;
+}
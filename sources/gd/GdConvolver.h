@@ -0,0 +1,112 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+#include "utility/RealFFT.h"
+#include <vector>
+
+/**
+ * @brief A convolution of several inputs into several outputs, without latency
+ *
+ * The responses are cut into partitions which grow with the time at which they
+ * start, and each size of partition runs in the frequency domain, once per
+ * block of its size. A partition can start only after its size, which leaves
+ * the start of the response to a direct convolution, if it's not silent.
+ *
+ * The work of a block does not run all at once at the boundary: it spreads
+ * over the steps of the smallest size which come until its output is due,
+ * which is a whole block later for all the partitions but the smallest ones.
+ */
+class GdConvolver {
+public:
+    // prepares the convolution with the responses, of which `irs[o * numInputs + i]`
+    // goes from the input `i` to the output `o`, or is null if it's silent,
+    // for the processing by calls of up to `bufferSize` frames; it allocates
+    // memory, and it runs outside of the processing
+    void init(unsigned numInputs, unsigned numOutputs, const float *const irs[], unsigned length, unsigned bufferSize);
+    void clear();
+    unsigned getLength() const noexcept { return length_; }
+    // number of frames of output which are computed ahead of the input
+    unsigned getLookahead() const noexcept { return lookahead_; }
+    // adds the output into `outputs`, or if null, only takes the input,
+    // which is the cheaper way to fill the history
+    void process(const float *const inputs[], float *const outputs[], unsigned count);
+
+private:
+    struct Level;
+    void processBlocks(bool computeOutput);
+    void runTasks(Level &level, unsigned endTask);
+    void computeHead(float *const outputs[], unsigned count);
+
+private:
+    // the partitions of the same size, which start one after the other
+    struct Level {
+        unsigned blockSize = 0;
+        unsigned offset = 0;
+        unsigned numPartitions = 0;
+        RealFFT fft;
+        // spectra of the partitions: [partition][path][real then imaginary]
+        std::vector<float> partitions;
+        // whether a partition of a path has any signal: [partition][path]
+        std::vector<char> isActive;
+        // spectra of the recent input blocks: [slot][input][real then imaginary]
+        std::vector<float> history;
+        unsigned historySlot = 0;
+        // whether any partition of an output has signal: [output]
+        std::vector<char> hasOutput;
+
+        // the work of a block is a list of tasks: the transforms of the
+        // inputs, then for each output the products with the partitions one
+        // by one and the inverse transform; the tasks done by each step
+        std::vector<unsigned> stepTasks;
+        unsigned step = 0;
+        unsigned task = 0;
+        // the block in progress, and whether it computes its output
+        unsigned boundary = 0;
+        bool computesOutput = false;
+        // sums of the products of the block: [output][real then imaginary]
+        std::vector<float> accumulators;
+    };
+
+    unsigned numInputs_ = 0;
+    unsigned numOutputs_ = 0;
+    unsigned length_ = 0;
+    unsigned lookahead_ = 0;
+    // the paths of input to output which are not silent
+    std::vector<unsigned> pathInputs_;
+    std::vector<unsigned> pathOutputs_;
+
+    // direct convolution of the start of the responses: [path][frame]
+    unsigned headStart_ = 0;
+    unsigned headLength_ = 0;
+    std::vector<float> head_;
+
+    std::vector<Level> levels_;
+
+    // the frames since the start, which determine the block boundaries
+    unsigned frameCount_ = 0;
+    // input of each channel, written twice for contiguous reads of the recent frames
+    unsigned inputSize_ = 0;
+    std::vector<float> inputs_;
+    // sums of output of each channel, which the partitions add ahead
+    unsigned outputSize_ = 0;
+    std::vector<float> outputs_;
+    // work area of an inverse transform
+    std::vector<float> blockFrames_;
+};
@@ -32,6 +32,16 @@ enum {
     GdMaxLines = 26,
     // maximum delay length in seconds
     GdMaxDelay = 10,
+    // maximum number of channels of a multichannel network
+    GdMaxChannels = 12,
+};
+
+enum GdOversamplingFactor {
+    GdOversampling1x,
+    GdOversampling2x,
+    GdOversampling4x,
+    //
+    GdNumOversamplingFactors,
 };
 
 enum GdFilterType {
@@ -39,10 +49,22 @@ enum GdFilterType {
     //
     GdFilter6dB,
     GdFilter12dB,
+    GdFilter12dBSVF,
     //
     GdNumFilterTypes,
 };
 
+// the stages of the processing, of which the library can count the runs which
+// make results under the normal range, in a build with `GD_DENORMAL_COUNTERS`
+typedef enum GdDenormalStage {
+    GdDenormalsInFilters,
+    GdDenormalsInShifterAA,
+    GdDenormalsInShifter,
+    GdDenormalsInFeedback,
+    //
+    GdNumDenormalStages,
+} GdDenormalStage;
+
 ///
 struct GdRange {
     float start;
@@ -71,6 +93,7 @@ Ignorable static constexpr float GdParamSmoothTime = 50e-3f;
 // smallest gain setting
 Ignorable static constexpr float GdMinMixGainDB = -64.0f;
 Ignorable static constexpr float GdMinFeedbackGainDB = -64.0f;
+Ignorable static constexpr float GdMinTapLevelDB = -64.0f;
 
 #define GD_EACH_PARAMETER(_)                                                   \
     /* Name, Range, Def, Flags, Label, Unit, Group */                          \
@@ -82,6 +105,8 @@ Ignorable static constexpr float GdMinFeedbackGainDB = -64.0f;
     _(FEEDBACK_GAIN, (GdMinFeedbackGainDB, 6.0, 0, -6, GDR_MIDPOINT), GdMinFeedbackGainDB, GDP_FLOAT, "Feedback Gain", "dB", -1) \
     _(MIX_DRY, (GdMinMixGainDB, 0, 0, -10, GDR_MIDPOINT), -6, GDP_FLOAT, "Dry Mix", "dB", -1) \
     _(MIX_WET, (GdMinMixGainDB, 0, 0, -10, GDR_MIDPOINT), -6, GDP_FLOAT, "Wet Mix", "dB", -1) \
+    _(OVERSAMPLING, (0, GdNumOversamplingFactors - 1), 0, GDP_CHOICE, "Oversampling", "", -1) \
+    _(CONVOLUTION, (false, true), false, GDP_BOOLEAN, "Static Convolution", "", -1) \
     GD_EACH_LINE_PARAMETER(_, A, 0)                                            \
     GD_EACH_LINE_PARAMETER(_, B, 1)                                            \
     GD_EACH_LINE_PARAMETER(_, C, 2)                                            \
@@ -115,13 +140,14 @@ Ignorable static constexpr float GdMinFeedbackGainDB = -64.0f;
     /* NOTE: Tap Enable must always appear first */                            \
     _(TAP_##X##_ENABLE, (false, true), false, GDP_BOOLEAN, "Tap " #X " Enable", "", I) \
     _(TAP_##X##_DELAY, (0, GdMaxDelay), 0, GDP_FLOAT, "Tap " #X " Delay", "s", I) \
-    _(TAP_##X##_LEVEL, (-64, 6, 0, -6, GDR_MIDPOINT), 0, GDP_FLOAT, "Tap " #X " Level", "dB", I) \
+    _(TAP_##X##_LEVEL, (GdMinTapLevelDB, 6, 0, -6, GDR_MIDPOINT), 0, GDP_FLOAT, "Tap " #X " Level", "dB", I) \
     _(TAP_##X##_MUTE, (false, true), false, GDP_BOOLEAN, "Tap " #X " Mute", "", I) \
     _(TAP_##X##_FILTER_ENABLE, (false, true), false, GDP_BOOLEAN, "Tap " #X " Filter Enable", "", I) \
     _(TAP_##X##_FILTER, (0, GdNumFilterTypes - 1), 0, GDP_CHOICE, "Tap " #X " Filter", "", I) \
     _(TAP_##X##_LPF_CUTOFF, (10, 22000, 0, 800, GDR_MIDPOINT), 22000, GDP_FLOAT, "Tap " #X " LPF Cutoff", "Hz", I) \
     _(TAP_##X##_HPF_CUTOFF, (10, 22000, 0, 800, GDR_MIDPOINT), 0, GDP_FLOAT, "Tap " #X " HPF Cutoff", "Hz", I) \
     _(TAP_##X##_RESONANCE, (0, 20), 0, GDP_FLOAT, "Tap " #X " Resonance", "dB", I) \
+    _(TAP_##X##_ANALOG, (false, true), false, GDP_BOOLEAN, "Tap " #X " Analog", "", I) \
     _(TAP_##X##_TUNE_ENABLE, (false, true), false, GDP_BOOLEAN, "Tap " #X " Tune Enable", "", I) \
     _(TAP_##X##_TUNE, (-1200, 1200), 0, GDP_FLOAT, "Tap " #X " Tune", "cts", I) \
     _(TAP_##X##_PAN, (-100, 100), 0, GDP_FLOAT, "Tap " #X " Pan", "%", I)       \
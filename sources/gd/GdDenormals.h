@@ -0,0 +1,61 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+#include "GdDefs.h"
+
+#if !defined(GD_DENORMAL_COUNTERS)
+#   define GD_DENORMAL_COUNTERS 0
+#endif
+
+#if GD_DENORMAL_COUNTERS
+#include <atomic>
+#include <cfenv>
+
+// the counts of each stage, over all the instances
+extern std::atomic<unsigned long> gdDenormalCounts[GdNumDenormalStages];
+
+// counts a run of a stage, if any of its results fell under the normal range
+// between the construction and the destruction, whether flushed to zero or
+// not; the scopes do not nest, as each clears the flag of underflow
+class GdDenormalScope {
+public:
+    explicit GdDenormalScope(GdDenormalStage stage) noexcept
+        : stage_(stage)
+    {
+        std::feclearexcept(FE_UNDERFLOW);
+    }
+
+    ~GdDenormalScope() noexcept
+    {
+        if (std::fetestexcept(FE_UNDERFLOW))
+            gdDenormalCounts[stage_].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    GdDenormalScope(const GdDenormalScope &) = delete;
+    GdDenormalScope &operator=(const GdDenormalScope &) = delete;
+
+private:
+    GdDenormalStage stage_;
+};
+
+#   define GD_COUNT_DENORMALS(stage) GdDenormalScope denormalScope(stage)
+#else
+#   define GD_COUNT_DENORMALS(stage) do {} while (0)
+#endif
@@ -18,61 +18,102 @@
  */
 
 #include "GdFilter.h"
+#include <array>
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
+// the tangent of the half angle of the cutoff, tan(π fc/fs), from which all
+// the coefficients derive, at regular steps of the cutoff up to a quarter of
+// the sample rate; it's smooth enough to interpolate linearly, and it spares
+// the trigonometry of every update while the cutoff moves
+static constexpr unsigned kTanTableSize = 1024;
+
+static const double *const tanTable = []() -> const double * {
+    static std::array<double, kTanTableSize + 1> table;
+    for (unsigned i = 0; i <= kTanTableSize; ++i)
+        table[i] = std::tan(M_PI * 0.25 * i / kTanTableSize);
+    return table.data();
+}();
+
+// the cutoff stays below the Nyquist frequency, where the tangent diverges
+static constexpr double kMaxRelativeCutoff = 0.4999;
+
+static double interpolateTan(double relativeCutoff)
+{
+    // above a quarter of the sample rate, the tangent is the inverse of
+    // that of the cutoff mirrored around it
+    double x = std::max(0.0, std::min(relativeCutoff, kMaxRelativeCutoff));
+    bool mirror = x > 0.25;
+    if (mirror)
+        x = 0.5 - x;
+
+    double position = x * (4 * kTanTableSize);
+    unsigned index = std::min((unsigned)position, kTanTableSize - 1);
+    double mu = position - index;
+    double k = tanTable[index] + mu * (tanTable[index + 1] - tanTable[index]);
+
+    return mirror ? (1 / k) : k;
+}
+
 void GdFilter::updateCoeffs()
 {
+    glideCoeffs(0);
+}
+
+void GdFilter::glideCoeffs(unsigned frames)
+{
+    // the coefficients are computed in double precision in any case
     Coeff1 c1;
     Coeff2 c2;
 
-    Real fs = sampleRate_;
-    Real fc = cutoff_;
-    Real q = resonance_;
-    Real pi = (Real)M_PI;
+    double q = resonance_;
+
+    // the tangent of the half angle w/2 = π fc/fs
+    double k = interpolateTan(cutoff_ / sampleRate_);
+
+    // the second order, by its damping and the gains of its mix
+    auto secondOrder = [k](double damping, double m0, double m1, double m2) -> Coeff2 {
+        Coeff2 c;
+        double a1 = 1 / (1 + k * (k + damping));
+        c.a1 = a1;
+        c.a2 = k * a1;
+        c.a3 = k * k * a1;
+        c.m0 = m0;
+        c.m1 = m1;
+        c.m2 = m2;
+        return c;
+    };
 
     switch (filter_) {
     case kFilterOff:
+    // the state-variable filters have coefficients of their own, below
+    case kFilterLPF12SVF:
+    case kFilterHPF12SVF:
         // Pass through
         c1.u0 = 1;
         c1.u1 = 0;
         c1.v1 = 0;
 
         // Pass through
-        c2.b0 = 1;
-        c2.b1 = 0;
-        c2.b2 = 0;
-        c2.a1 = 0;
-        c2.a2 = 0;
+        c2 = secondOrder(0, 1, 0, 0);
         break;
     case kFilterLPF6:
     {
         // LPF 6dB/oct
         {
-            Real c = 1/std::tan(fc*pi/fs);
-            c1.u0 = 1/(1+c);
+            // with c = 1/k
+            c1.u0 = k/(k+1);
             c1.u1 = c1.u0;
-            c1.v1 = (1-c)/(1+c);
+            c1.v1 = (k-1)/(k+1);
         }
 
         // Peak
         {
         peak:
-            Real w = 2*(fc*pi/fs);
-            Real A = std::sqrt(q);
-            Real S = std::sin(w);
-            Real C = std::cos(w);
-            Real b0 = 1+S*A;
-            Real b1 = -2*C;
-            Real b2 = 1-S*A;
-            Real a0 = 1+S/A;
-            Real a1 = -2*C;
-            Real a2 = 1-S/A;
-            c2.b0 = b0/a0;
-            c2.b1 = b1/a0;
-            c2.b2 = b2/a0;
-            c2.a1 = a1/a0;
-            c2.a2 = a2/a0;
+            // the bell of Q 1/2, with a gain of A² = q at the cutoff
+            double A = std::sqrt(q);
+            c2 = secondOrder(2/A, 1, 2*A - 2/A, 0);
         }
         break;
     }
@@ -80,10 +121,10 @@ void GdFilter::updateCoeffs()
     {
         // HPF 6dB/oct
         {
-            Real c = 1/std::tan(fc*pi/fs);
-            c1.u0 = c/(1+c);
+            // with c = 1/k
+            c1.u0 = 1/(k+1);
             c1.u1 = -c1.u0;
-            c1.v1 = (1-c)/(1+c);
+            c1.v1 = (k-1)/(k+1);
         }
 
         // Peak
@@ -97,21 +138,7 @@ void GdFilter::updateCoeffs()
         c1.v1 = 0;
 
         // LPF 12dB/oct
-        {
-            Real w = 2*(fc*pi/fs);
-            Real a = std::sin(w)/(2*q);
-            Real b0 = (1-std::cos(w))/2;
-            Real b1 = 1-std::cos(w);
-            Real b2 = (1-std::cos(w))/2;
-            Real a0 = 1+a;
-            Real a1 = -2*std::cos(w);
-            Real a2 = 1-a;
-            c2.b0 = b0/a0;
-            c2.b1 = b1/a0;
-            c2.b2 = b2/a0;
-            c2.a1 = a1/a0;
-            c2.a2 = a2/a0;
-        }
+        c2 = secondOrder(1/q, 0, 0, 1);
         break;
     }
     case kFilterHPF12:
@@ -122,25 +149,31 @@ void GdFilter::updateCoeffs()
         c1.v1 = 0;
 
         // HPF 12dB/oct
-        {
-            Real w = 2*(fc*pi/fs);
-            Real a = std::sin(w)/(2*q);
-            Real b0 = (1+std::cos(w))/2;
-            Real b1 = -1-std::cos(w);
-            Real b2 = (1+std::cos(w))/2;
-            Real a0 = 1+a;
-            Real a1 = -2*std::cos(w);
-            Real a2 = 1-a;
-            c2.b0 = b0/a0;
-            c2.b1 = b1/a0;
-            c2.b2 = b2/a0;
-            c2.a1 = a1/a0;
-            c2.a2 = a2/a0;
-        }
+        c2 = secondOrder(1/q, 1, -1/q, -1);
         break;
     }
     }
 
     coeff1_ = c1;
     coeff2_ = c2;
+
+    // the state-variable filter moves from where its glide is at present
+    if (filter_ == kFilterLPF12SVF || filter_ == kFilterHPF12SVF) {
+        CoeffSVF &svf = coeffSVF_;
+        Real g = (Real)k;
+        Real damping = (Real)(1 / q);
+        if (frames == 0) {
+            svf.gStep = 0;
+            svf.kStep = 0;
+        }
+        else {
+            Real g0 = svf.g - svf.glideFrames * svf.gStep;
+            Real k0 = svf.k - svf.glideFrames * svf.kStep;
+            svf.gStep = (g - g0) / frames;
+            svf.kStep = (damping - k0) / frames;
+        }
+        svf.g = g;
+        svf.k = damping;
+        svf.glideFrames = frames;
+    }
 }
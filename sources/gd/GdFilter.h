@@ -19,9 +19,18 @@
 
 #pragma once
 
+// the filters run in single precision, unless double is requested
+#if !defined(GD_FILTER_DOUBLE_PRECISION)
+#   define GD_FILTER_DOUBLE_PRECISION 0
+#endif
+
 class GdFilter {
 public:
+#if GD_FILTER_DOUBLE_PRECISION
     using Real = double;
+#else
+    using Real = float;
+#endif
 
     enum FilterType {
         kFilterOff,
@@ -29,6 +38,8 @@ public:
         kFilterHPF6,
         kFilterLPF12,
         kFilterHPF12,
+        kFilterLPF12SVF,
+        kFilterHPF12SVF,
     };
 
     void clear();
@@ -42,6 +53,11 @@ public:
     bool isAnalog() const;
     void setAnalog(bool analog);
     void updateCoeffs();
+    // updates like the above, except that the state-variable filter glides
+    // to its new coefficients over the frames to come, instead of jumping
+    void glideCoeffs(unsigned frames);
+    void copyCoeffs(const GdFilter &other);
+    template <class Archive> void archiveState(Archive &archive);
     template <class T> void process(const T *input, T *output, unsigned count);
     Real processOne(Real input);
 
@@ -61,22 +77,51 @@ public:
         Real v1;
     };
     struct Coeff2 {
-        // the second order component
-        Real b0, b1, b2;
-        Real a1, a2;
+        // the second order component, a state-variable filter of which the
+        // output mixes the input, the band-pass and the low-pass; unlike a
+        // direct form, it keeps its precision in float at low cutoffs
+        Real a1, a2, a3;
+        Real m0, m1, m2;
+    };
+    struct CoeffSVF {
+        // the state-variable filter: the tangent of the cutoff and the
+        // damping 1/q at the end of the glide, and their steps per frame
+        Real g, k;
+        Real gStep, kStep;
+        unsigned glideFrames;
     };
 
 private:
+    friend class GdFilterBank;
+
     // the first order filter
     struct Mem1 { Real x1, y1; };
     Mem1 mem1_{};
     Coeff1 coeff1_{};
 
-    // the second order filter (transposed form II)
+    // the second order filter, by its integrators: s1 (band-pass) and s2
+    // (low-pass)
     struct Mem2 { Real s1, s2; };
     Mem2 mem2_{};
     Coeff2 coeff2_{};
 
+    // the state-variable filter (zero-delay feedback, trapezoidal), which
+    // glides, and keeps its integrators in the memory of the second order
+    CoeffSVF coeffSVF_{};
+    struct GainsSVF { Real a1, a2, a3, k; };
+    static GainsSVF getGainsSVF(Real g, Real k);
+    GainsSVF nextGainsSVF();
+
+    // the kernels of each type, which leave out the sections that are a pass
+    // through: the 6 dB filters are a first order with a peak, the 12 dB
+    // filters are a second order only
+    template <int Type> static constexpr bool hasFirstOrder();
+    template <int Type> static constexpr bool hasSecondOrder();
+    template <int Type, class NL> static Real tick(const Coeff1 &c1, const Coeff2 &c2, Mem1 &m1, Mem2 &m2, Real input);
+    template <int Type, class T, class NL> void processKernel(const T *input, T *output, unsigned count);
+    template <int Type, class NL> static Real tickSVF(const GainsSVF &gains, Mem2 &m, Real input);
+    template <int Type, class T, class NL> void processKernelSVF(const T *input, T *output, unsigned count);
+
     // controls
     int filter_ = kFilterOff;
     Real sampleRate_ = 0;
@@ -84,7 +129,7 @@ private:
     Real resonance_ = 0;
 
     // digital/analog
-    Real (GdFilter:: *processOneFunction_)(Real) = &GdFilter::processOneNL<Linearity>;
+    bool analog_ = false;
 };
 
 #include "GdFilter.hpp"
@@ -19,6 +19,7 @@
 
 #include "GdFilter.h"
 #include "utility/RsqrtNL.h"
+#include <algorithm>
 #include <cmath>
 
 inline GdFilter::Real GdFilter::Linearity::operator()(Real x) const
@@ -74,30 +75,63 @@ inline void GdFilter::setResonance(Real resonance)
 
 inline bool GdFilter::isAnalog() const
 {
-    return processOneFunction_ == &GdFilter::processOneNL<SaturatingNonLinearity>;
+    return analog_;
 }
 
 inline void GdFilter::setAnalog(bool analog)
 {
-    Real (GdFilter:: *function)(Real) = analog ?
-        &GdFilter::processOneNL<SaturatingNonLinearity> :
-        &GdFilter::processOneNL<Linearity>;
-
-    if (processOneFunction_ == function)
+    if (analog_ == analog)
         return;
 
-    processOneFunction_ = function;
-    clear();
+    // the kernels share their memory, so the output continues
+    analog_ = analog;
+}
+
+inline void GdFilter::copyCoeffs(const GdFilter &other)
+{
+    if (filter_ != other.filter_) {
+        filter_ = other.filter_;
+        clear();
+    }
+
+    setAnalog(other.analog_);
+
+    cutoff_ = other.cutoff_;
+    resonance_ = other.resonance_;
+    coeff1_ = other.coeff1_;
+    coeff2_ = other.coeff2_;
+    coeffSVF_ = other.coeffSVF_;
+}
+
+template <class Archive> inline void GdFilter::archiveState(Archive &archive)
+{
+    bool analog = isAnalog();
+    archive.value(analog);
+    setAnalog(analog);
+
+    archive.value(filter_);
+    archive.value(cutoff_);
+    archive.value(resonance_);
+    archive.check(filter_ >= kFilterOff && filter_ <= kFilterHPF12SVF);
+    archive.check(std::isfinite(cutoff_) && std::isfinite(resonance_));
+    archive.value(coeff1_);
+    archive.value(coeff2_);
+    archive.value(coeffSVF_);
+    archive.value(mem1_);
+    archive.value(mem2_);
 }
 
 inline GdFilter::Real GdFilter::processOne(Real input)
 {
-    return (this->*processOneFunction_)(input);
+    if (analog_)
+        return processOneNL<SaturatingNonLinearity>(input);
+    else
+        return processOneNL<Linearity>(input);
 }
 
 template <class T> inline void GdFilter::process(const T *input, T *output, unsigned count)
 {
-    if (isAnalog())
+    if (analog_)
         processNL<T, SaturatingNonLinearity>(input, output, count);
     else
         processNL<T, Linearity>(input, output, count);
@@ -105,41 +139,165 @@ template <class T> inline void GdFilter::process(const T *input, T *output, unsi
 
 template <class NL> inline GdFilter::Real GdFilter::processOneNL(Real input)
 {
-    Real output;
+    switch (filter_) {
+    default:
+        return input;
+    case kFilterLPF6:
+        return tick<kFilterLPF6, NL>(coeff1_, coeff2_, mem1_, mem2_, input);
+    case kFilterHPF6:
+        return tick<kFilterHPF6, NL>(coeff1_, coeff2_, mem1_, mem2_, input);
+    case kFilterLPF12:
+        return tick<kFilterLPF12, NL>(coeff1_, coeff2_, mem1_, mem2_, input);
+    case kFilterHPF12:
+        return tick<kFilterHPF12, NL>(coeff1_, coeff2_, mem1_, mem2_, input);
+    case kFilterLPF12SVF:
+        return tickSVF<kFilterLPF12SVF, NL>(nextGainsSVF(), mem2_, input);
+    case kFilterHPF12SVF:
+        return tickSVF<kFilterHPF12SVF, NL>(nextGainsSVF(), mem2_, input);
+    }
+}
+
+template <class T, class NL> inline void GdFilter::processNL(const T *input, T *output, unsigned count)
+{
+    switch (filter_) {
+    default:
+        if (input != output)
+            std::copy_n(input, count, output);
+        break;
+    case kFilterLPF6:
+        processKernel<kFilterLPF6, T, NL>(input, output, count);
+        break;
+    case kFilterHPF6:
+        processKernel<kFilterHPF6, T, NL>(input, output, count);
+        break;
+    case kFilterLPF12:
+        processKernel<kFilterLPF12, T, NL>(input, output, count);
+        break;
+    case kFilterHPF12:
+        processKernel<kFilterHPF12, T, NL>(input, output, count);
+        break;
+    case kFilterLPF12SVF:
+        processKernelSVF<kFilterLPF12SVF, T, NL>(input, output, count);
+        break;
+    case kFilterHPF12SVF:
+        processKernelSVF<kFilterHPF12SVF, T, NL>(input, output, count);
+        break;
+    }
+}
+
+template <int Type> constexpr bool GdFilter::hasFirstOrder()
+{
+    return Type == kFilterLPF6 || Type == kFilterHPF6;
+}
+
+template <int Type> constexpr bool GdFilter::hasSecondOrder()
+{
+    return Type != kFilterOff;
+}
+
+template <int Type, class NL> inline GdFilter::Real GdFilter::tick(const Coeff1 &c1, const Coeff2 &c2, Mem1 &m1, Mem2 &m2, Real input)
+{
+    Real output = input;
     NL nl;
 
     // First order part
-    {
-        const Coeff1 c = coeff1_;
-        Mem1 m = mem1_;
-        output = c.u0 * input + nl(c.u1 * m.x1 - c.v1 * m.y1);
-        m.x1 = input;
-        m.y1 = output;
-        mem1_ = m;
+    if (hasFirstOrder<Type>()) {
+        output = c1.u0 * input + nl(c1.u1 * m1.x1 - c1.v1 * m1.y1);
+        m1.x1 = input;
+        m1.y1 = output;
     }
 
     input = output;
 
     // Second order part
-    {
-        const Coeff2 c = coeff2_;
-        Mem2 m = mem2_;
-        output = m.s1 + c.b0 * input;
-        m.s1 = nl(m.s2 + c.b1 * input - c.a1 * output);
-        m.s2 = nl(c.b2 * input - c.a2 * output);
-        mem2_ = m;
+    if (hasSecondOrder<Type>()) {
+        Real v3 = input - m2.s2;
+        Real v1 = c2.a1 * m2.s1 + c2.a2 * v3;
+        Real v2 = m2.s2 + c2.a2 * m2.s1 + c2.a3 * v3;
+        m2.s1 = nl(2 * v1 - m2.s1);
+        m2.s2 = nl(2 * v2 - m2.s2);
+
+        // the mix of each type, in the order of the general one of the bank
+        if (Type == kFilterLPF12)
+            output = v2;
+        else if (Type == kFilterHPF12)
+            output = input + c2.m1 * v1 - v2;
+        else
+            output = input + c2.m1 * v1;
     }
 
     return output;
 }
 
-template <class T, class NL> inline void GdFilter::processNL(const T *input, T *output, unsigned count)
+template <int Type, class T, class NL> inline void GdFilter::processKernel(const T *input, T *output, unsigned count)
 {
-    GdFilter filter = *this;
+    const Coeff1 c1 = coeff1_;
+    const Coeff2 c2 = coeff2_;
+    Mem1 m1 = mem1_;
+    Mem2 m2 = mem2_;
 
     for (unsigned i = 0; i < count; ++i)
-        output[i] = filter.processOneNL<NL>((Real)input[i]);
+        output[i] = (T)tick<Type, NL>(c1, c2, m1, m2, (Real)input[i]);
+
+    mem1_ = m1;
+    mem2_ = m2;
+}
+
+inline GdFilter::GainsSVF GdFilter::getGainsSVF(Real g, Real k)
+{
+    GainsSVF gains;
+    gains.a1 = 1 / (1 + g * (g + k));
+    gains.a2 = g * gains.a1;
+    gains.a3 = g * gains.a2;
+    gains.k = k;
+    return gains;
+}
+
+inline GdFilter::GainsSVF GdFilter::nextGainsSVF()
+{
+    CoeffSVF &c = coeffSVF_;
+    if (c.glideFrames > 0)
+        --c.glideFrames;
+    return getGainsSVF(c.g - c.glideFrames * c.gStep, c.k - c.glideFrames * c.kStep);
+}
+
+template <int Type, class NL> inline GdFilter::Real GdFilter::tickSVF(const GainsSVF &gains, Mem2 &m, Real input)
+{
+    NL nl;
+
+    // the integrators are s1 (band-pass) and s2 (low-pass)
+    Real v3 = input - m.s2;
+    Real v1 = gains.a1 * m.s1 + gains.a2 * v3;
+    Real v2 = m.s2 + gains.a2 * m.s1 + gains.a3 * v3;
+    m.s1 = nl(2 * v1 - m.s1);
+    m.s2 = nl(2 * v2 - m.s2);
+
+    if (Type == kFilterLPF12SVF)
+        return v2;
+    else
+        return input - gains.k * v1 - v2;
+}
+
+template <int Type, class T, class NL> inline void GdFilter::processKernelSVF(const T *input, T *output, unsigned count)
+{
+    CoeffSVF c = coeffSVF_;
+    Mem2 m = mem2_;
+
+    // the coefficients change at every frame of the glide, after which they
+    // stay at the target
+    unsigned glideCount = std::min(c.glideFrames, count);
+    unsigned i = 0;
+
+    for (; i < glideCount; ++i) {
+        --c.glideFrames;
+        GainsSVF gains = getGainsSVF(c.g - c.glideFrames * c.gStep, c.k - c.glideFrames * c.kStep);
+        output[i] = (T)tickSVF<Type, NL>(gains, m, (Real)input[i]);
+    }
+
+    const GainsSVF gains = getGainsSVF(c.g, c.k);
+    for (; i < count; ++i)
+        output[i] = (T)tickSVF<Type, NL>(gains, m, (Real)input[i]);
 
-    mem1_ = filter.mem1_;
-    mem2_ = filter.mem2_;
+    coeffSVF_ = c;
+    mem2_ = m;
 }
@@ -77,6 +77,47 @@ void GdLine::process(const float *input, const float *delay, float *output, unsi
     lineIndex_ = lineIndex;
 }
 
+void GdLine::write(const float *input, unsigned count)
+{
+    float *lineData = lineData_.data();
+    unsigned lineIndex = lineIndex_;
+    unsigned lineCapacity = (unsigned)lineData_.size();
+
+    for (unsigned i = 0; i < count; ++i) {
+        lineData[lineIndex] = input[i];
+        lineIndex = (lineIndex + 1 < lineCapacity) ? (lineIndex + 1) : 0;
+    }
+
+    ///
+    lineIndex_ = lineIndex;
+}
+
+void GdLine::read(unsigned lineIndex, const float *delay, float *output, unsigned count) const
+{
+    const float *lineData = lineData_.data();
+    unsigned lineCapacity = (unsigned)lineData_.size();
+    float sampleRate = sampleRate_;
+
+    // the index where the first frame was written
+    lineIndex %= lineCapacity;
+
+    for (unsigned i = 0; i < count; ++i) {
+        float sampleDelay = sampleRate * delay[i];
+        float fractionalPosition = sampleDelay - (unsigned)sampleDelay;
+        unsigned decimalPosition = lineIndex + lineCapacity - (unsigned)sampleDelay;
+        decimalPosition -= (decimalPosition < lineCapacity) ? 0 : lineCapacity;
+
+        ///
+        unsigned i1 = decimalPosition;
+        unsigned i2 = decimalPosition + 1;
+        i2 = (i2 < lineCapacity) ? i2 : 0;
+        output[i] = lineData[i1] + fractionalPosition * (lineData[i2] - lineData[i1]);
+
+        ///
+        lineIndex = (lineIndex + 1 < lineCapacity) ? (lineIndex + 1) : 0;
+    }
+}
+
 void GdLine::allocateLineBuffer(unsigned capacity)
 {
     lineData_.clear();
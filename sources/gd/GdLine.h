@@ -18,7 +18,7 @@
  */
 
 #pragma once
-#include <vector>
+#include "utility/MemoryPool.h"
 
 class GdLine {
 public:
@@ -28,8 +28,17 @@ public:
     void process(const float *input, const float *delay, float *output, unsigned count);
     float processOne(float input, float delay);
 
+    // separate write and read, for lines which have multiple read heads
+    unsigned getLineIndex() const;
+    unsigned getCapacity() const;
+    void write(const float *input, unsigned count);
+    void read(unsigned lineIndex, const float *delay, float *output, unsigned count) const;
+
+    // the contents, the line has the same capacity when it loads
+    template <class Archive> void archiveState(Archive &archive);
+
 private:
-    std::vector<float> lineData_;
+    PoolVector<float> lineData_;
     unsigned lineIndex_ = 0;
     float maxDelay_ = 0;
     float sampleRate_ = 0;
@@ -37,6 +46,23 @@ private:
 };
 
 //==============================================================================
+inline unsigned GdLine::getLineIndex() const
+{
+    return lineIndex_;
+}
+
+inline unsigned GdLine::getCapacity() const
+{
+    return (unsigned)lineData_.size();
+}
+
+template <class Archive> inline void GdLine::archiveState(Archive &archive)
+{
+    archive.frames(lineData_.data(), lineData_.size());
+    archive.value(lineIndex_);
+    archive.check(lineIndex_ < lineData_.size() || lineIndex_ == 0);
+}
+
 inline float GdLine::processOne(float input, float delay)
 {
     float *lineData = lineData_.data();
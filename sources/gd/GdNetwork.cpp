@@ -18,25 +18,58 @@
  */
 
 #include "GdNetwork.h"
+#include "GdDenormals.h"
 #include "utility/Volume.h"
 #include <simde/x86/sse.h>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <cstdio>
 #include <cassert>
 
+// time for which taps must be stable before they can share their effects
+static constexpr float kFxGroupSettleTime = 0.5f;
+
+// attenuation which the low-pass must have at the edge of the passband of the
+// resamplers, for the effects of a tap to run at a reduced rate
+static constexpr float kReducedRateAttenuationDB = 30.0f;
+// margin on the cutoff, which prevents a tap from changing rates repeatedly
+static constexpr float kReducedRateHysteresis = 1.25f;
+// time for which the effects at the next rate settle, before they fade in
+static constexpr float kReducedRateWarmTime = 0.01f;
+
+// largest difference of the channels of an input which counts as mono
+static constexpr float kMonoThreshold = 1e-5f;
+// time for which the effects of both channels must receive the same input,
+// before their states can be considered the same
+static constexpr float kMonoSettleTime = 1.0f;
+
+// length of the history which runs through the effects of a silent tap,
+// before it's heard again
+static constexpr float kSilentWarmUpTime = 0.05f;
+// the history of the warm-ups which run in a call, in blocks of the call; a
+// warm-up which does not fit continues in the next calls, while its tap stays
+// silent, so that the cost of a call stays bounded when many restart at once
+static constexpr unsigned kWarmUpBlocksPerCall = 16;
+
 GdNetwork::GdNetwork(ChannelMode channelMode)
+    : GdNetwork((channelMode == Stereo) ? 1 : 0, (channelMode == Mono) ? 1 : 0)
 {
-    switch (channelMode) {
-    case Mono:
-        channels_.resize(1);
-        break;
-    case Stereo:
-        channels_.resize(2);
-        break;
-    default:
-        assert(false);
-    }
+    assert(channelMode == Mono || channelMode == Stereo);
+    channelMode_ = channelMode;
+    latencyLines_.resize(2);
+    directLatencyLines_.resize(2);
+}
+
+GdNetwork::GdNetwork(unsigned numPairs, unsigned numSingles)
+{
+    assert(2 * numPairs + numSingles > 0 && 2 * numPairs + numSingles <= GdMaxChannels);
+
+    channelMode_ = Multichannel;
+    channels_.resize(2 * numPairs + numSingles);
+    numPairs_ = numPairs;
+    latencyLines_.resize(2 * numPairs + numSingles);
+    directLatencyLines_.resize(2 * numPairs + numSingles);
 
     smoothFbGainLinear_.setTimeConstant(GdParamSmoothTime);
 
@@ -53,6 +86,7 @@ GdNetwork::~GdNetwork()
 void GdNetwork::clear()
 {
     smoothFbGainLinear_.clearToTarget();
+    keepWarm_ = false;
 
 #if GD_SHIFTER_CAN_REPORT_LATENCY
     for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
@@ -66,10 +100,38 @@ void GdNetwork::clear()
 
     for (TapControl &tapControl : tapControls_)
         tapControl.clear();
+
+    for (GdLine &line : latencyLines_)
+        line.clear();
+    for (GdLine &line : directLatencyLines_)
+        line.clear();
+
+    for (FxGroupControl &groupControl : fxGroupControls_)
+        groupControl = FxGroupControl{};
+
+    controlPhase_ = 0;
+    bookkeepingFrames_ = 0;
+    bookkeepingFbTapIndex_ = ~0u;
+
+    isMono_ = false;
+    monoFrames_ = 0;
+    monoFeedbackFrames_ = 0;
+}
+
+void GdNetwork::setMaxDelay(float maxDelay)
+{
+    for (ChannelDsp &chan : channels_) {
+        for (TapDsp &tap : chan.taps_)
+            tap.line_.setMaxDelay(maxDelay);
+        for (FxGroupDsp &group : chan.fxGroups_)
+            group.line_.setMaxDelay(maxDelay);
+    }
 }
 
 void GdNetwork::setSampleRate(float sampleRate)
 {
+    sampleRate_ = sampleRate;
+
     smoothFbGainLinear_.setSampleRate(sampleRate);
 
     for (ChannelDsp &chan : channels_)
@@ -77,12 +139,26 @@ void GdNetwork::setSampleRate(float sampleRate)
 
     for (TapControl &tapControl : tapControls_)
         tapControl.setSampleRate(sampleRate);
+
+    // the lines hold the largest latency, and the frame which is written
+    unsigned maxLatencyFrames = (unsigned)std::ceil(getOversamplingLatency(kMaxOversampling));
+    for (GdLine &line : latencyLines_) {
+        line.setSampleRate(sampleRate);
+        line.setMaxDelay((float)(maxLatencyFrames + 1) / sampleRate);
+    }
+    for (GdLine &line : directLatencyLines_) {
+        line.setSampleRate(sampleRate);
+        line.setMaxDelay((float)(maxLatencyFrames + 1) / sampleRate);
+    }
 }
 
 void GdNetwork::setBufferSize(unsigned bufferSize)
 {
-    for (TempBuffer &temp : temp_)
-        temp.resize(bufferSize);
+    bufferSize_ = bufferSize;
+
+    ScratchArena::Layout layout;
+    allocateTempBuffers(layout, (unsigned)channels_.size(), bufferSize);
+    arena_.reserve(layout.getSize());
 
     for (ChannelDsp &chan : channels_)
         chan.setBufferSize(bufferSize);
@@ -120,6 +196,24 @@ void GdNetwork::setParameter(unsigned parameter, float value)
                 (fbTapGainDB_ <= GdMinFeedbackGainDB) ? 0.0f :
                 db2linear(fbTapGainDB_));
             break;
+        case GDP_OVERSAMPLING:
+            {
+                unsigned oversampling = (unsigned)value;
+                if (oversampling_ == oversampling)
+                    break;
+                oversampling_ = oversampling;
+                latencyFrames_ = (unsigned)std::ceil(getOversamplingLatency(oversampling));
+                // restart the effects at the full rate, and the delayed signal
+                for (ChannelDsp &chan : channels_) {
+                    for (TapDsp &tap : chan.taps_)
+                        tap.clearFx(0, oversampling);
+                }
+                for (GdLine &line : latencyLines_)
+                    line.clear();
+                for (GdLine &line : directLatencyLines_)
+                    line.clear();
+            }
+            break;
         }
     }
     else {
@@ -149,7 +243,9 @@ void GdNetwork::setParameter(unsigned parameter, float value)
         case GDP_TAP_A_LEVEL:
             tapControl.levelDB_ = value;
         tap_level:
-            tapControl.smoothLevelLinear_.setTarget(tapControl.mute_ ? 0.0f : db2linear(tapControl.levelDB_));
+            tapControl.smoothLevelLinear_.setTarget(tapControl.mute_ ? 0.0f :
+                (tapControl.levelDB_ <= GdMinTapLevelDB) ? 0.0f :
+                db2linear(tapControl.levelDB_));
             break;
         case GDP_TAP_A_MUTE:
             tapControl.mute_ = (bool)value;
@@ -172,6 +268,9 @@ void GdNetwork::setParameter(unsigned parameter, float value)
             tapControl.resonanceDB_ = value;
             tapControl.smoothResonanceLinear_.setTarget(db2linear(tapControl.resonanceDB_));
             break;
+        case GDP_TAP_A_ANALOG:
+            tapControl.analog_ = (bool)value;
+            break;
         case GDP_TAP_A_TUNE_ENABLE:
             tapControl.shiftEnable_ = (bool)value;
             goto tap_tune;
@@ -204,69 +303,320 @@ void GdNetwork::setTempo(float tempo)
     bpm_ = tempo;
 }
 
-void GdNetwork::process(const float *const inputs[], const float *dry, const float *wet, float *const outputs[], unsigned count)
+unsigned GdNetwork::getLatency() const
+{
+    return latencyFrames_;
+}
+
+static bool isSettled(const LinearSmoother &smoother)
+{
+    return smoother.getCurrentValue() == smoother.getTarget();
+}
+
+bool GdNetwork::isStatic() const
+{
+    if (smoothFbGainLinear_.getTarget() != 0.0f || smoothFbGainLinear_.getCurrentValue() != 0.0f)
+        return false;
+    if (isShifting())
+        return false;
+
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        const TapControl &tapControl = tapControls_[tapIndex];
+
+        if (!tapControl.enable_)
+            continue;
+
+        if (tapControl.fxGroupStep_ != 0 || tapControl.reducedRateStep_ != 0)
+            return false;
+        // the saturation of the analog filters depends on the level
+        if (tapControl.filterEnable_ && tapControl.analog_)
+            return false;
+
+        const LinearSmoother *smoothers[] = {
+            &tapControl.smoothDelay_, &tapControl.smoothLevelLinear_,
+            &tapControl.smoothLpfCutoff_, &tapControl.smoothHpfCutoff_,
+            &tapControl.smoothResonanceLinear_, &tapControl.smoothShiftLinear_,
+            &tapControl.smoothPanNormalized_, &tapControl.smoothWidth_,
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+            &smoothTapLatency_[tapIndex],
+#endif
+        };
+        for (const LinearSmoother *smoother : smoothers) {
+            if (!isSettled(*smoother))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void GdNetwork::setKeepWarm(bool keepWarm)
+{
+    keepWarm_ = keepWarm;
+}
+
+bool GdNetwork::isWarm() const
+{
+    for (const TapControl &tapControl : tapControls_) {
+        if (tapControl.enable_ && tapControl.isSilent_ && !isSilent(tapControl, false))
+            return false;
+    }
+
+    return true;
+}
+
+bool GdNetwork::isShifting() const
+{
+    for (const TapControl &tapControl : tapControls_) {
+        if (tapControl.enable_ && tapControl.smoothShiftLinear_.getTarget() != 1.0f)
+            return true;
+    }
+    return false;
+}
+
+float GdNetwork::getLongestTapDelay() const
+{
+    float longestDelay = 0;
+    for (const TapControl &tapControl : tapControls_) {
+        if (tapControl.enable_)
+            longestDelay = std::max(longestDelay, tapControl.smoothDelay_.getTarget());
+    }
+    return longestDelay;
+}
+
+float GdNetwork::getMemoryTime(float threshold) const
+{
+    float memoryTime = getLongestTapDelay() + (float)latencyFrames_ / sampleRate_;
+
+    const TapControl &fbTapControl = tapControls_[fbTapIndex_];
+    float fbGain = smoothFbGainLinear_.getTarget();
+    if (!fbTapControl.enable_ || fbGain == 0.0f)
+        return memoryTime;
+
+    // the loop passes through the effects of the tap; the resonance of the
+    // low-pass and the high-pass can amplify at most by its square
+    float loopGain = fbGain;
+    bool hasPeak = fbTapControl.filter_ == GdFilter12dB || fbTapControl.filter_ == GdFilter12dBSVF;
+    if (fbTapControl.filterEnable_ && hasPeak) {
+        float resonance = std::max(1.0f, fbTapControl.smoothResonanceLinear_.getTarget());
+        loopGain *= resonance * resonance;
+    }
+    if (loopGain >= 1.0f)
+        return std::numeric_limits<float>::infinity();
+
+    float loopDelay = std::max(fbTapControl.smoothDelay_.getTarget(), 1.0f / sampleRate_);
+    float numLoops = std::ceil(std::log(threshold) / std::log(loopGain));
+    return memoryTime + numLoops * loopDelay;
+}
+
+// updates the controls of the effects of all the channels, which compute
+// their coefficients once
+static void performKRateUpdates(GdTapFx *const fxs[], unsigned numFx, GdTapFx::Control control, unsigned index)
+{
+    fxs[0]->performKRateUpdates(control, index);
+    for (unsigned fxIndex = 1; fxIndex < numFx; ++fxIndex)
+        fxs[fxIndex]->followKRateUpdates(*fxs[0], control, index);
+}
+
+// runs the effects of several taps at the sample rate in chunks of the
+// control interval, with their filters in the lanes of the bank, and the rest
+// of the effects one by one; the lanes are the channels of every tap in turn
+static void processFxInFilterBank(GdFilterBank &bank, GdTapFx *const fxs[], float *const frames[], unsigned numTaps, unsigned numChannels, const GdTapFx::Control controls[], unsigned index, unsigned count, unsigned firstUpdate)
+{
+    const unsigned interval = GdTapFx::kControlUpdateInterval;
+    unsigned numLanes = numTaps * numChannels;
+
+    for (unsigned lane = 0; lane < numLanes; ++lane) {
+        bank.loadCoeffs(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+        bank.loadState(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+    }
+
+    bool mustUpdate[GdFilterBank::kNumLanes];
+    for (unsigned tapIndex = 0; tapIndex < numTaps; ++tapIndex)
+        mustUpdate[tapIndex] = !controls[tapIndex].isConstant || index == 0;
+
+    unsigned i = 0;
+    unsigned nextUpdate = firstUpdate;
+
+    while (i < count) {
+        if (i == nextUpdate) {
+            for (unsigned tapIndex = 0; tapIndex < numTaps; ++tapIndex) {
+                if (mustUpdate[tapIndex]) {
+                    // the update may clear the filters, so they take back
+                    // their state from the bank around it
+                    unsigned firstLane = tapIndex * numChannels;
+                    for (unsigned lane = firstLane; lane < firstLane + numChannels; ++lane)
+                        bank.storeState(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+                    performKRateUpdates(&fxs[firstLane], numChannels, controls[tapIndex], index + i);
+                    for (unsigned lane = firstLane; lane < firstLane + numChannels; ++lane) {
+                        bank.loadCoeffs(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+                        bank.loadState(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+                    }
+                }
+                mustUpdate[tapIndex] = !controls[tapIndex].isConstant;
+            }
+            nextUpdate += interval;
+        }
+        unsigned j = std::min(nextUpdate, count);
+        float *chunkFrames[GdFilterBank::kNumLanes];
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+            chunkFrames[lane] = frames[lane] + i;
+        {
+            GD_COUNT_DENORMALS(GdDenormalsInFilters);
+            bank.process(chunkFrames, numLanes, j - i);
+        }
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+            fxs[lane]->processShifter(chunkFrames[lane], chunkFrames[lane], controls[lane / numChannels], j - i);
+        i = j;
+    }
+
+    for (unsigned lane = 0; lane < numLanes; ++lane)
+        bank.storeState(lane, fxs[lane]->lpf_, fxs[lane]->hpf_);
+}
+
+// the largest difference between the frames of two signals
+static float maxAbsDifference(const float *a, const float *b, unsigned count)
+{
+    simde__m128 maxDiff = simde_mm_setzero_ps();
+    simde__m128 signMask = simde_mm_set1_ps(-0.0f);
+
+    unsigned i = 0;
+    for (; i + 3 < count; i += 4) {
+        simde__m128 diff = simde_mm_sub_ps(simde_mm_loadu_ps(&a[i]), simde_mm_loadu_ps(&b[i]));
+        maxDiff = simde_mm_max_ps(maxDiff, simde_mm_andnot_ps(signMask, diff));
+    }
+
+    float result = std::max(
+        std::max(((float *)&maxDiff)[0], ((float *)&maxDiff)[1]),
+        std::max(((float *)&maxDiff)[2], ((float *)&maxDiff)[3]));
+    for (; i < count; ++i)
+        result = std::max(result, std::fabs(a[i] - b[i]));
+
+    return result;
+}
+
+void GdNetwork::process(const float *const inputs[], const float *dry, const float *wet, float *const outputs[], float *const *const directOutputs[], unsigned count)
 {
-    const ChannelDsp *channels = channels_.data();
     unsigned numInputs = (unsigned)channels_.size();
+    unsigned numOutputs = (channelMode_ == Mono) ? 2 : numInputs;
 
     unsigned fbTapIndex = fbTapIndex_;
 
-    const float *leftInput = inputs[0];
-    const float *rightInput = (numInputs == 2) ? inputs[1] : inputs[0];
-    float *leftOutput = outputs[0];
-    float *rightOutput = outputs[1];
-
-    size_t iTemp = 0;
-    auto allocateTemp = [this, &iTemp]() -> float * {
-        assert(iTemp < kNumTempBuffers);
-        return temp_[iTemp++].data();
-    };
+    ScratchArena::Scope scope(arena_);
+    TempBuffers temp = allocateTempBuffers(arena_, numInputs, count);
 
-    float *delays = allocateTemp();
-    float *feedbackGain = allocateTemp();
-    float *level = allocateTemp();
-    float *pan = allocateTemp();
-    float *width = allocateTemp();
-    float *feedbackTapOutputs[2] = { allocateTemp(), allocateTemp() };
-    float *ordinaryTapOutputs[2] = { allocateTemp(), allocateTemp() };
-    float *inputAndFeedbackSums[2] = { allocateTemp(), allocateTemp() };
+    float *delays = temp.delays;
+    float *feedbackGain = temp.feedbackGain;
+    float *level = temp.level;
+    float *pan = temp.pan;
+    float *width = temp.width;
+    float *const *feedbackTapOutputs = temp.feedbackTapOutputs;
+    float *const *ordinaryTapOutputs = temp.ordinaryTapOutputs;
+    float *const *inputAndFeedbackSums = temp.inputAndFeedbackSums;
+    float *const *sharedTapOutputs = temp.sharedTapOutputs;
+    float *sharedFxWeights = temp.sharedFxWeights;
 
     GdTapFx::Control fxControl;
-    fxControl.lpfCutoff = allocateTemp();
-    fxControl.hpfCutoff = allocateTemp();
-    fxControl.resonance = allocateTemp();
-    fxControl.shift = allocateTemp();
+    fxControl.lpfCutoff = temp.lpfCutoff;
+    fxControl.hpfCutoff = temp.hpfCutoff;
+    fxControl.resonance = temp.resonance;
+    fxControl.shift = temp.shift;
 
 #if GD_SHIFTER_CAN_REPORT_LATENCY
-    float *latency = allocateTemp();
+    float *latency = temp.latency;
 #endif
 
-    const float *tapInputs[2] = { leftInput, rightInput };
+    const float *tapInputs[GdMaxChannels];
+    std::copy_n(inputs, numInputs, tapInputs);
 
     // fill outputs with dry signal
-    for (unsigned i = 0; i < count; ++i) {
-        float gain = dry[i];
-        leftOutput[i] = gain * leftInput[i];
-        rightOutput[i] = gain * rightInput[i];
+    for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex) {
+        const float *input = inputs[std::min(chanIndex, numInputs - 1)];
+        float *output = outputs[chanIndex];
+        for (unsigned i = 0; i < count; ++i)
+            output[i] = dry[i] * input[i];
+    }
+
+    // the direct outputs receive nothing else, except their taps
+    if (directOutputs) {
+        for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+            if (float *const *tapOutputs = directOutputs[tapIndex]) {
+                for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex)
+                    std::fill_n(tapOutputs[chanIndex], count, 0.0f);
+            }
+        }
     }
 
+    // the outputs in which a tap is mixed
+    auto getMixOutputs = [outputs, directOutputs](unsigned tapIndex) -> float *const * {
+        float *const *tapOutputs = directOutputs ? directOutputs[tapIndex] : nullptr;
+        return tapOutputs ? tapOutputs : outputs;
+    };
+
     // skip processing the feedback if disabled
     if (smoothFbGainLinear_.getTarget() == 0.0f && smoothFbGainLinear_.getCurrentValue() == 0.0f) {
         fbTapIndex = ~0u;
     }
 
+    // the wet gain moves in a line, so it's off if it's zero at both ends
+    bool isWetOff = !keepWarm_ && (count == 0 || (wet[0] == 0.0f && wet[count - 1] == 0.0f));
+
+    // run a single channel, if the stereo input has been mono for long enough
+    bool isMono = updateMonoMode(inputs, fbTapIndex, count);
+    unsigned numChannels = isMono ? 1 : numInputs;
+
+    // a small block continues the grid of k-rate updates of the previous
+    // blocks, instead of updating at its start
+    const unsigned controlInterval = GdTapFx::kControlUpdateInterval;
+    bool isSmallBlock = count <= kSmallBlockSize;
+    unsigned firstUpdate = !isSmallBlock ? 0 : (controlInterval - controlPhase_) % controlInterval;
+    controlPhase_ = ((isSmallBlock ? controlPhase_ : 0) + count) % controlInterval;
+
+    // update the groups and the rates at most once per tile, unless the
+    // feedback tap changes, which must run its own effects at once
+    bookkeepingFrames_ += count;
+    if (!isSmallBlock || bookkeepingFrames_ >= kTileSize || fbTapIndex != bookkeepingFbTapIndex_) {
+        // find which taps can share their effects
+        updateFxGroups(fbTapIndex, bookkeepingFrames_);
+
+        // find which taps can run their effects at a reduced rate
+        updateReducedRates(fbTapIndex);
+
+        // the feedback tap runs its effects at the sample rate, so a tap
+        // which changes its role restarts the effects which it runs next
+        if (oversampling_ != 0 && fbTapIndex != bookkeepingFbTapIndex_) {
+            for (ChannelDsp &chan : channels_) {
+                if (fbTapIndex != ~0u)
+                    chan.taps_[fbTapIndex].clearFx(0, 0);
+                if (bookkeepingFbTapIndex_ != ~0u)
+                    chan.taps_[bookkeepingFbTapIndex_].clearFx(0, oversampling_);
+            }
+        }
+
+        bookkeepingFrames_ = 0;
+        bookkeepingFbTapIndex_ = fbTapIndex;
+    }
+
     //--------------------------------------------------------------------------
 
     auto prepareTapControls = [
 #if GD_SHIFTER_CAN_REPORT_LATENCY
                                latency,
 #endif
-        this, numInputs, delays, level, pan, width](int tapIndex, TapControl &tapControl, unsigned count) {
+        this, fbTapIndex](unsigned tapIndex, TapControl &tapControl, unsigned count, float *delays, float *level, float *pan, float *width) {
         // compute the line delays
         tapControl.smoothDelay_.nextBlock(delays, count);
+        // the ordinary taps come after the latency of the oversampling,
+        // like the dry signal, except at the longest delays
+        unsigned oversampling = (tapIndex == fbTapIndex) ? 0 : oversampling_;
+        if (oversampling != 0) {
+            float latencyTime = (float)latencyFrames_ / sampleRate_;
+            for (unsigned i = 0; i < count; ++i)
+                delays[i] = std::min((float)GdMaxDelay, delays[i] + latencyTime);
+        }
 #if GD_SHIFTER_CAN_REPORT_LATENCY
         // compute tap latency
-        smoothTapLatency_[tapIndex].setTarget(channels_[0].taps_[tapIndex].fx_.getLatency());
+        smoothTapLatency_[tapIndex].setTarget(channels_[0].taps_[tapIndex].getFullRateFx(oversampling).getLatency());
         smoothTapLatency_[tapIndex].nextBlock(latency, count);
         // compensate delays according to latency
         for (unsigned i = 0; i < count; ++i)
@@ -276,19 +626,81 @@ void GdNetwork::process(const float *const inputs[], const float *dry, const flo
         tapControl.smoothLevelLinear_.nextBlock(level, count);
         // calculate pan
         tapControl.smoothPanNormalized_.nextBlock(pan, count);
-        // calculate width (stereo only)
-        if (numInputs == 2)
+        // calculate width (pairs only)
+        if (numPairs_ > 0)
             tapControl.smoothWidth_.nextBlock(width, count);
     };
 
-    auto prepareFXControls = [&fxControl](TapControl &tapControl, unsigned count) {
+    auto prepareFXControls = [](TapControl &tapControl, unsigned count, GdTapFx::Control &fxControl) {
         fxControl.filter = tapControl.filterEnable_ ? tapControl.filter_ : GdFilterOff;
+        fxControl.analog = tapControl.analog_;
+        fxControl.isConstant = isSettled(tapControl.smoothLpfCutoff_) && isSettled(tapControl.smoothHpfCutoff_) &&
+            isSettled(tapControl.smoothResonanceLinear_) && isSettled(tapControl.smoothShiftLinear_);
         tapControl.smoothLpfCutoff_.nextBlock(fxControl.lpfCutoff, count);
         tapControl.smoothHpfCutoff_.nextBlock(fxControl.hpfCutoff, count);
         tapControl.smoothResonanceLinear_.nextBlock(fxControl.resonance, count);
         tapControl.smoothShiftLinear_.nextBlock(fxControl.shift, count);
     };
 
+    // the effects did not follow the line of a tap while it was silent, so
+    // restart them from the recent history, with the current controls; the
+    // history runs from a budget of frames per call, and the tap is heard
+    // again once its effects have caught up with its line
+    unsigned warmUpFrames = (unsigned)std::ceil(kSilentWarmUpTime * sampleRate_);
+    unsigned warmUpBudget = kWarmUpBlocksPerCall * count;
+
+    auto warmUpFx = [this, &temp, numChannels, warmUpFrames, &warmUpBudget](unsigned tapIndex, TapControl &tapControl) -> bool {
+        // a tap in a group, which does not run its own effects, is ready
+        if (tapControl.fxGroup_ != -1 && tapControl.fxGroupStep_ == 0) {
+            tapControl.warmUpLag_ = 0;
+            return true;
+        }
+
+        unsigned rate = tapControl.reducedRate_;
+        float delay = tapControl.smoothDelay_.getCurrentValue();
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+        delay -= smoothTapLatency_[tapIndex].getCurrentValue();
+#endif
+        delay = std::max(0.0f, delay - getFxLatency(rate) / sampleRate_);
+        unsigned delayFrames = (unsigned)std::ceil(delay * sampleRate_);
+
+        TapDsp *taps[GdMaxChannels];
+        for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+            taps[chanIndex] = &channels_[chanIndex].taps_[tapIndex];
+
+        // the history must not reach past the capacity of the line, so a
+        // warm-up which falls too far behind starts over
+        unsigned capacity = taps[0]->line_.getCapacity();
+        unsigned maxLag = capacity - std::min(capacity, delayFrames + 2);
+        if (tapControl.warmUpLag_ == 0 || tapControl.warmUpLag_ > maxLag) {
+            tapControl.warmUpLag_ = 0;
+            if (warmUpBudget == 0)
+                return false;
+            for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+                taps[chanIndex]->clearFx(rate, oversampling_);
+            tapControl.warmUpLag_ = std::min(warmUpFrames, maxLag);
+        }
+
+        GdTapFx::Control warmUpControl;
+        warmUpControl.filter = tapControl.filterEnable_ ? tapControl.filter_ : GdFilterOff;
+        warmUpControl.analog = tapControl.analog_;
+        warmUpControl.lpfCutoff = temp.warmUpLpfCutoff;
+        warmUpControl.hpfCutoff = temp.warmUpHpfCutoff;
+        warmUpControl.resonance = temp.warmUpResonance;
+        warmUpControl.shift = temp.warmUpShift;
+        warmUpControl.isConstant = true;
+        std::fill_n(warmUpControl.lpfCutoff, kTileSize, tapControl.smoothLpfCutoff_.getCurrentValue());
+        std::fill_n(warmUpControl.hpfCutoff, kTileSize, tapControl.smoothHpfCutoff_.getCurrentValue());
+        std::fill_n(warmUpControl.resonance, kTileSize, tapControl.smoothResonanceLinear_.getCurrentValue());
+        std::fill_n(warmUpControl.shift, kTileSize, tapControl.smoothShiftLinear_.getCurrentValue());
+
+        unsigned frames = std::min(tapControl.warmUpLag_, warmUpBudget);
+        TapDsp::warmUpFx(taps, numChannels, rate, oversampling_, delay, tapControl.warmUpLag_, frames, warmUpControl, temp.ordinaryTapOutputs, temp.reducedRateDelays[0], temp.reducedRateFrames, temp.oversampledFrames);
+        warmUpBudget -= frames;
+        tapControl.warmUpLag_ -= frames;
+        return tapControl.warmUpLag_ == 0;
+    };
+
     //--------------------------------------------------------------------------
 
     // if there is a feedback line, process it first
@@ -301,162 +713,966 @@ void GdNetwork::process(const float *const inputs[], const float *dry, const flo
 
         if (tapControl.enable_) {
             // compute tap parameters
-            prepareTapControls(fbTapIndex, tapControl, count);
+            prepareTapControls(fbTapIndex, tapControl, count, delays, level, pan, width);
 
             // compute FX parameters
-            prepareFXControls(tapControl, count);
+            prepareFXControls(tapControl, count, fxControl);
 
             // compute the feedback gain
             smoothFbGainLinear_.nextBlock(feedbackGain, count);
 
-            for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex) {
+            GdTapFx *fxs[GdMaxChannels];
+            float feedbacks[GdMaxChannels];
+            for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
                 ChannelDsp &chan = channels_[chanIndex];
-                TapDsp &tap = chan.taps_[fbTapIndex];
-                float feedback = chan.feedback_;
-
-                // compute the line and its effects
-                const float *input = inputs[chanIndex];
-                float *inputAndFeedbackSum = inputAndFeedbackSums[chanIndex];
-                float *feedbackTapOutput = feedbackTapOutputs[chanIndex];
-
-                unsigned i = 0;
-                GdTapFx &fx = tap.fx_;
-
-                while (i + GdTapFx::kControlUpdateInterval < count) {
-                    fx.performKRateUpdates(fxControl, i);
-                    for (unsigned j = i + GdTapFx::kControlUpdateInterval; i < j; ++i) {
-                        float in = input[i] + feedback * feedbackGain[i];
-                        inputAndFeedbackSum[i] = in;
-                        float out = tap.line_.processOne(in, delays[i]);
-                        out = fx.processOne(out, fxControl, i);
-                        //out = cubicNL(out); // saturate feedback
-                        feedbackTapOutput[i] = out;
-                        feedback = out;
-                    }
+                fxs[chanIndex] = &chan.taps_[fbTapIndex].fx_;
+                feedbacks[chanIndex] = chan.feedback_;
+            }
+
+            // compute the lines and their effects, one control interval at
+            // a time, for which all the channels update their controls once
+            unsigned i = 0;
+            unsigned nextUpdate = firstUpdate;
+            bool mustUpdate = true;
+
+            GD_COUNT_DENORMALS(GdDenormalsInFeedback);
+            while (i < count) {
+                if (i == nextUpdate) {
+                    if (mustUpdate)
+                        performKRateUpdates(fxs, numChannels, fxControl, i);
+                    mustUpdate = !fxControl.isConstant;
+                    nextUpdate += controlInterval;
                 }
-                if (i < count) {
-                    fx.performKRateUpdates(fxControl, i);
-                    for (; i < count; ++i) {
-                        float in = input[i] + feedback * feedbackGain[i];
-                        inputAndFeedbackSum[i] = in;
-                        float out = tap.line_.processOne(in, delays[i]);
-                        out = fx.processOne(out, fxControl, i);
+
+                unsigned chunkEnd = std::min(nextUpdate, count);
+
+                for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+                    TapDsp &tap = channels_[chanIndex].taps_[fbTapIndex];
+                    GdTapFx &fx = tap.fx_;
+                    float feedback = feedbacks[chanIndex];
+
+                    const float *input = inputs[chanIndex];
+                    float *inputAndFeedbackSum = inputAndFeedbackSums[chanIndex];
+                    float *feedbackTapOutput = feedbackTapOutputs[chanIndex];
+
+                    for (unsigned j = i; j < chunkEnd; ++j) {
+                        float in = input[j] + feedback * feedbackGain[j];
+                        inputAndFeedbackSum[j] = in;
+                        float out = tap.line_.processOne(in, delays[j]);
+                        out = fx.processOne(out, fxControl, j);
                         //out = cubicNL(out); // saturate feedback
-                        feedbackTapOutput[i] = out;
+                        feedbackTapOutput[j] = out;
                         feedback = out;
                     }
+
+                    feedbacks[chanIndex] = feedback;
                 }
 
+                i = chunkEnd;
+            }
+
+            for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
                 // use this as input to the rest of taps
-                tapInputs[chanIndex] = inputAndFeedbackSum;
+                tapInputs[chanIndex] = inputAndFeedbackSums[chanIndex];
+
+                channels_[chanIndex].feedback_ = feedbacks[chanIndex];
+            }
+
+            if (isMono) {
+                // the other channel follows the line of the first
+                channels_[1].taps_[fbTapIndex].line_.write(inputAndFeedbackSums[0], count);
+            }
+            else if (channelMode_ == Stereo) {
+                // the channels become the same only once the feedback is the same
+                if (maxAbsDifference(feedbackTapOutputs[0], feedbackTapOutputs[1], count) > kMonoThreshold)
+                    monoFeedbackFrames_ = 0;
+            }
+        }
+    }
+
+    // mix the feedback tap at once, while its controls are in the buffers
+    float *const *fbMixOutputs = outputs;
+    if (fbTapIndex != ~0u) {
+        TapControl &tapControl = tapControls_[fbTapIndex];
+        fbMixOutputs = getMixOutputs(fbTapIndex);
+        if (tapControl.enable_ && !isSilent(tapControl, isWetOff)) {
+            const float *tapOutputs[GdMaxChannels];
+            for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex)
+                tapOutputs[chanIndex] = feedbackTapOutputs[std::min(chanIndex, numChannels - 1)];
+            mixToOutputs(fbTapIndex, tapOutputs, level, pan, width, wet, fbMixOutputs, count);
+        }
+    }
+
+    // the dry signal and the feedback tap do not pass through the resamplers,
+    // so they are delayed to come along with the oversampled taps
+    if (latencyFrames_ != 0) {
+        float *latencyDelays = temp.latencyDelays;
+        std::fill_n(latencyDelays, count, (float)latencyFrames_ / sampleRate_);
+        for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex)
+            latencyLines_[chanIndex].process(outputs[chanIndex], latencyDelays, outputs[chanIndex], count);
+        if (fbMixOutputs != outputs) {
+            for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex)
+                directLatencyLines_[chanIndex].process(fbMixOutputs[chanIndex], latencyDelays, fbMixOutputs[chanIndex], count);
+        }
+    }
+
+    // run the effects of the groups, and write them into the shared lines
+    for (unsigned groupIndex = 0; groupIndex < kMaxFxGroups; ++groupIndex) {
+        FxGroupControl &groupControl = fxGroupControls_[groupIndex];
+
+        if (!groupControl.inUse_)
+            continue;
 
-                chan.feedback_ = feedback;
+        FxGroupKey key = groupControl.key_;
+        float *shift = temp.sharedFxShift;
+        std::fill_n(shift, kTileSize, 1.0f);
+
+        GdTapFx::Control groupFxControl;
+        groupFxControl.filter = key.filter;
+        groupFxControl.lpfCutoff = &key.lpfCutoff;
+        groupFxControl.hpfCutoff = &key.hpfCutoff;
+        groupFxControl.resonance = &key.resonance;
+        groupFxControl.shift = shift;
+
+        GdTapFx *fxs[GdMaxChannels];
+        for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+            fxs[chanIndex] = &channels_[chanIndex].fxGroups_[groupIndex].fx_;
+        performKRateUpdates(fxs, numChannels, groupFxControl, 0);
+
+        for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+            FxGroupDsp &group = channels_[chanIndex].fxGroups_[groupIndex];
+            float *groupTile = sharedTapOutputs[chanIndex];
+
+            group.lineIndex_ = group.line_.getLineIndex();
+
+            for (unsigned tileStart = 0; tileStart < count; tileStart += kTileSize) {
+                unsigned tileCount = std::min(count - tileStart, (unsigned)kTileSize);
+                group.fx_.process(tapInputs[chanIndex] + tileStart, groupTile, groupFxControl, tileCount);
+                group.line_.write(groupTile, tileCount);
+                if (isMono)
+                    channels_[1].fxGroups_[groupIndex].line_.write(groupTile, tileCount);
             }
         }
+
+        groupControl.warmFrames_ = std::min(groupControl.warmFrames_ + count, ~0u - count);
+    }
+
+    // the ordinary taps which filter at the sample rate wait in a batch, which
+    // runs their filters together in the bank; it runs before the next tap
+    // which is mixed, so the taps add up in the outputs in the same order
+    unsigned maxBankTaps = getMaxBankTaps(numInputs);
+    unsigned bankTapIndices[kMaxBankTaps];
+    GdTapFx::Control bankFxControls[kMaxBankTaps];
+    unsigned numBankTaps = 0;
+
+    for (unsigned bankIndex = 0; bankIndex < maxBankTaps; ++bankIndex) {
+        bankFxControls[bankIndex].lpfCutoff = temp.bankLpfCutoff[bankIndex];
+        bankFxControls[bankIndex].hpfCutoff = temp.bankHpfCutoff[bankIndex];
+        bankFxControls[bankIndex].resonance = temp.bankResonance[bankIndex];
+        bankFxControls[bankIndex].shift = temp.bankShift[bankIndex];
     }
 
+    auto runBankTaps = [&]() {
+        if (numBankTaps == 0)
+            return;
+
+        GdTapFx *fxs[GdFilterBank::kNumLanes];
+        float *const *bankTapOutputs = temp.bankTapOutputs;
+        for (unsigned bankIndex = 0; bankIndex < numBankTaps; ++bankIndex) {
+            for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+                fxs[bankIndex * numChannels + chanIndex] = &channels_[chanIndex].taps_[bankTapIndices[bankIndex]].fx_;
+        }
+
+        for (unsigned tileStart = 0; tileStart < count; tileStart += kTileSize) {
+            unsigned tileCount = std::min(count - tileStart, (unsigned)kTileSize);
+
+            // compute the lines
+            for (unsigned bankIndex = 0; bankIndex < numBankTaps; ++bankIndex) {
+                unsigned tapIndex = bankTapIndices[bankIndex];
+                for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+                    TapDsp &tap = channels_[chanIndex].taps_[tapIndex];
+                    const float *tapInput = tapInputs[chanIndex] + tileStart;
+
+                    // the other channel follows the line of the first
+                    if (isMono)
+                        channels_[1].taps_[tapIndex].line_.write(tapInput, tileCount);
+
+                    tap.line_.process(tapInput, temp.bankDelays[bankIndex] + tileStart, bankTapOutputs[bankIndex * numChannels + chanIndex], tileCount);
+                }
+            }
+
+            // compute the effects of all the taps together
+            processFxInFilterBank(filterBank_, fxs, bankTapOutputs, numBankTaps, numChannels, bankFxControls, tileStart, tileCount, firstUpdate);
+
+            // add to mix
+            for (unsigned bankIndex = 0; bankIndex < numBankTaps; ++bankIndex) {
+                unsigned tapIndex = bankTapIndices[bankIndex];
+                const float *tapOutputs[GdMaxChannels];
+                for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex)
+                    tapOutputs[chanIndex] = bankTapOutputs[bankIndex * numChannels + std::min(chanIndex, numChannels - 1)];
+                float *const *mixOutputs = getMixOutputs(tapIndex);
+                float *tileOutputs[GdMaxChannels];
+                for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex)
+                    tileOutputs[chanIndex] = mixOutputs[chanIndex] + tileStart;
+                mixToOutputs(tapIndex, tapOutputs, temp.bankLevel[bankIndex] + tileStart, temp.bankPan[bankIndex] + tileStart, temp.bankWidth[bankIndex] + tileStart, wet + tileStart, tileOutputs, tileCount);
+            }
+        }
+
+        numBankTaps = 0;
+    };
+
     for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
         TapControl &tapControl = tapControls_[tapIndex];
 
         if (!tapControl.enable_)
             continue;
 
+        // the feedback tap is already mixed, and its effects run in every call
         if (tapIndex == fbTapIndex) {
-            // add to stereo mix
-            if (numInputs == 2)
-                mixStereoToStereo(tapIndex, feedbackTapOutputs, level, pan, width, wet, outputs, count);
+            tapControl.isSilent_ = false;
+            tapControl.warmUpLag_ = 0;
+            continue;
+        }
+
+        // a silent tap only writes its line, to have the history for
+        // warming up its effects once it's heard again; so does a tap which
+        // is heard again, until its effects have caught up with the line
+        bool isHeard = !isSilent(tapControl, isWetOff);
+        bool mustWait = isHeard && tapControl.isSilent_ && !warmUpFx(tapIndex, tapControl);
+        if (!isHeard || mustWait) {
+            skipTapControls(tapIndex, tapControl, count);
+            for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex) {
+                const float *tapInput = tapInputs[std::min(chanIndex, numChannels - 1)];
+                channels_[chanIndex].taps_[tapIndex].line_.write(tapInput, count);
+            }
+            tapControl.isSilent_ = true;
+            // the line moves on from a warm-up which has started, and the tap
+            // which waits for it fades in from silence once it's heard, unless
+            // the wet, which keeps it warm, fades it in
+            if (mustWait) {
+                if (tapControl.warmUpLag_ != 0)
+                    tapControl.warmUpLag_ += count;
+                if (!keepWarm_)
+                    tapControl.smoothLevelLinear_.rampFromZero();
+            }
             else
-                mixMonoToStereo(tapIndex, feedbackTapOutputs[0], level, pan, wet, outputs, count);
+                tapControl.warmUpLag_ = 0;
+            continue;
         }
-        else {
-            // compute tap parameters
-            prepareTapControls(tapIndex, tapControl, count);
+        tapControl.isSilent_ = false;
 
-            // compute FX parameters
-            prepareFXControls(tapControl, count);
+        if (numBankTaps < maxBankTaps && usesFilterBank(tapControl, oversampling_)) {
+            unsigned bankIndex = numBankTaps++;
+            bankTapIndices[bankIndex] = tapIndex;
 
-            for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex) {
-                ChannelDsp &chan = channels_[chanIndex];
-                TapDsp &tap = chan.taps_[tapIndex];
+            prepareTapControls(tapIndex, tapControl, count, temp.bankDelays[bankIndex], temp.bankLevel[bankIndex], temp.bankPan[bankIndex], temp.bankWidth[bankIndex]);
+            prepareFXControls(tapControl, count, bankFxControls[bankIndex]);
+
+            if (numBankTaps == maxBankTaps)
+                runBankTaps();
+            continue;
+        }
+
+        runBankTaps();
+
+        // compute tap parameters
+        prepareTapControls(tapIndex, tapControl, count, delays, level, pan, width);
+
+        // compute FX parameters
+        prepareFXControls(tapControl, count, fxControl);
+
+        // a tap in a group reads the shared line, and it runs its own
+        // effects only while it enters or leaves the group
+        int fxGroup = tapControl.fxGroup_;
+        bool hasOwnFx = fxGroup == -1 || tapControl.fxGroupStep_ != 0;
+        bool hasSharedFx = fxGroup != -1;
+
+        // a tap which changes its rate runs the own effects at both rates
+        unsigned rates[2] = { tapControl.reducedRate_, tapControl.nextReducedRate_ };
+        unsigned numRates = (tapControl.reducedRateStep_ != 0) ? 2 : 1;
+
+        TapDsp *taps[GdMaxChannels];
+        for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+            taps[chanIndex] = &channels_[chanIndex].taps_[tapIndex];
+
+        // run all the stages tile by tile, while the data is hot in cache
+        for (unsigned tileStart = 0; tileStart < count; tileStart += kTileSize) {
+            unsigned tileCount = std::min(count - tileStart, (unsigned)kTileSize);
+
+            if (hasOwnFx && hasSharedFx) {
+                float weight = tapControl.fxGroupWeight_;
+                float step = tapControl.fxGroupStep_;
+                for (unsigned i = 0; i < tileCount; ++i) {
+                    weight = std::max(0.0f, std::min(1.0f, weight + step));
+                    sharedFxWeights[i] = weight;
+                }
+                tapControl.fxGroupWeight_ = weight;
+            }
+
+            const float *rateDelays[2] {};
+            if (hasOwnFx) {
+                // compensate the latency of the resamplers
+                for (unsigned k = 0; k < numRates; ++k) {
+                    float latencyFrames = getFxLatency(rates[k]);
+                    if (latencyFrames == 0)
+                        rateDelays[k] = delays + tileStart;
+                    else {
+                        float latency = latencyFrames / sampleRate_;
+                        float *compensated = temp.reducedRateDelays[k];
+                        for (unsigned i = 0; i < tileCount; ++i)
+                            compensated[i] = std::max(0.0f, delays[tileStart + i] - latency);
+                        rateDelays[k] = compensated;
+                    }
+                }
 
-                // compute the line and its effects
-                const float *tapInput = tapInputs[chanIndex];
-                float *ordinaryTapOutput = ordinaryTapOutputs[chanIndex];
+                if (numRates == 2) {
+                    float weight = tapControl.reducedRateWeight_;
+                    float step = tapControl.reducedRateStep_;
+                    for (unsigned i = 0; i < tileCount; ++i) {
+                        weight = std::min(1.0f, weight + step);
+                        temp.reducedRateWeights[i] = std::max(0.0f, weight);
+                    }
+                    tapControl.reducedRateWeight_ = weight;
+                }
+            }
 
-                tap.line_.process(tapInput, delays, ordinaryTapOutput, count);
+            // compute the lines
+            float *const *rateTapOutputs[2] = { ordinaryTapOutputs, temp.reducedRateTapOutputs };
+
+            for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+                TapDsp &tap = *taps[chanIndex];
+                const float *tapInput = tapInputs[chanIndex] + tileStart;
+
+                // the other channel follows the line of the first
+                if (isMono)
+                    channels_[1].taps_[tapIndex].line_.write(tapInput, tileCount);
+
+                if (!hasOwnFx)
+                    tap.line_.write(tapInput, tileCount);
+                else if (numRates == 1 && rates[0] == 0)
+                    tap.line_.process(tapInput, rateDelays[0], ordinaryTapOutputs[chanIndex], tileCount);
+                else {
+                    unsigned lineIndex = tap.line_.getLineIndex();
+                    tap.line_.write(tapInput, tileCount);
+                    for (unsigned k = 0; k < numRates; ++k)
+                        tap.line_.read(lineIndex, rateDelays[k], rateTapOutputs[k][chanIndex], tileCount);
+                }
+            }
 
-                unsigned i = 0;
-                GdTapFx &fx = tap.fx_;
-                for (; i + GdTapFx::kControlUpdateInterval < count; i += GdTapFx::kControlUpdateInterval) {
-                    fx.performKRateUpdates(fxControl, i);
-                    fx.process(ordinaryTapOutput + i, ordinaryTapOutput + i, fxControl, GdTapFx::kControlUpdateInterval);
+            // compute the effects of all the channels together
+            if (hasOwnFx) {
+                for (unsigned k = 0; k < numRates; ++k)
+                    TapDsp::processFx(taps, numChannels, rates[k], oversampling_, rateTapOutputs[k], fxControl, tileStart, tileCount, firstUpdate, temp.reducedRateFrames, temp.oversampledFrames);
+
+                // crossfade between the current and the next rate
+                if (numRates == 2) {
+                    const float *rateWeights = temp.reducedRateWeights;
+                    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+                        float *ordinaryTapOutput = ordinaryTapOutputs[chanIndex];
+                        const float *nextRateTapOutput = rateTapOutputs[1][chanIndex];
+                        for (unsigned i = 0; i < tileCount; ++i)
+                            ordinaryTapOutput[i] += rateWeights[i] * (nextRateTapOutput[i] - ordinaryTapOutput[i]);
+                    }
                 }
-                if (i < count) {
-                    fx.performKRateUpdates(fxControl, i);
-                    fx.process(ordinaryTapOutput + i, ordinaryTapOutput + i, fxControl, count - i);
+            }
+
+            if (hasSharedFx) {
+                for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+                    FxGroupDsp &group = channels_[chanIndex].fxGroups_[fxGroup];
+                    float *ordinaryTapOutput = ordinaryTapOutputs[chanIndex];
+                    float *sharedTapOutput = hasOwnFx ? sharedTapOutputs[chanIndex] : ordinaryTapOutput;
+                    group.line_.read(group.lineIndex_ + tileStart, delays + tileStart, sharedTapOutput, tileCount);
+
+                    // crossfade between the own and the shared effects
+                    if (hasOwnFx) {
+                        for (unsigned i = 0; i < tileCount; ++i)
+                            ordinaryTapOutput[i] += sharedFxWeights[i] * (sharedTapOutput[i] - ordinaryTapOutput[i]);
+                    }
                 }
             }
 
-            // add to stereo mix
-            if (numInputs == 2)
-                mixStereoToStereo(tapIndex, ordinaryTapOutputs, level, pan, width, wet, outputs, count);
-            else
-                mixMonoToStereo(tapIndex, ordinaryTapOutputs[0], level, pan, wet, outputs, count);
+            // add to mix
+            const float *tapOutputs[GdMaxChannels];
+            for (unsigned chanIndex = 0; chanIndex < numInputs; ++chanIndex)
+                tapOutputs[chanIndex] = ordinaryTapOutputs[std::min(chanIndex, numChannels - 1)];
+            float *const *mixOutputs = getMixOutputs(tapIndex);
+            float *tileOutputs[GdMaxChannels];
+            for (unsigned chanIndex = 0; chanIndex < numOutputs; ++chanIndex)
+                tileOutputs[chanIndex] = mixOutputs[chanIndex] + tileStart;
+            mixToOutputs(tapIndex, tapOutputs, level + tileStart, pan + tileStart, width + tileStart, wet + tileStart, tileOutputs, tileCount);
+        }
+
+        // complete the transitions
+        if (hasOwnFx && numRates == 2 && tapControl.reducedRateWeight_ == 1.0f) {
+            tapControl.reducedRate_ = tapControl.nextReducedRate_;
+            tapControl.reducedRateWeight_ = 0;
+            tapControl.reducedRateStep_ = 0;
+        }
+        if (hasOwnFx && hasSharedFx) {
+            if (tapControl.fxGroupStep_ > 0 && tapControl.fxGroupWeight_ == 1.0f)
+                tapControl.fxGroupStep_ = 0;
+            else if (tapControl.fxGroupStep_ < 0 && tapControl.fxGroupWeight_ == 0.0f) {
+                tapControl.fxGroupStep_ = 0;
+                tapControl.fxGroup_ = -1;
+            }
         }
     }
+
+    runBankTaps();
 }
 
 //==============================================================================
-static inline simde__m128 calcStereoPanGains(float value)
+bool GdNetwork::getFxGroupKey(const TapControl &tapControl, FxGroupKey &key)
 {
-    simde__m128 x = simde_mm_setr_ps(1.0f - value, value, 0.0f, 0.0f);
-    simde__m128 y = simde_mm_sqrt_ps(x);
-    return y;
+    int filter = tapControl.filterEnable_ ? tapControl.filter_ : GdFilterOff;
+
+    // the effects are pass-through, there is nothing to share
+    if (filter == GdFilterOff)
+        return false;
+
+    // the effects must be linear and time-invariant, to commute with the line
+    if (tapControl.analog_)
+        return false;
+    const LinearSmoother *smoothers[] = {
+        &tapControl.smoothLpfCutoff_,
+        &tapControl.smoothHpfCutoff_,
+        &tapControl.smoothResonanceLinear_,
+        &tapControl.smoothShiftLinear_,
+    };
+    for (const LinearSmoother *smoother : smoothers) {
+        if (smoother->getCurrentValue() != smoother->getTarget())
+            return false;
+    }
+    if (tapControl.smoothShiftLinear_.getTarget() != 1.0f)
+        return false;
+
+    key.filter = filter;
+    key.lpfCutoff = tapControl.smoothLpfCutoff_.getTarget();
+    key.hpfCutoff = tapControl.smoothHpfCutoff_.getTarget();
+    key.resonance = tapControl.smoothResonanceLinear_.getTarget();
+    return true;
 }
 
-static inline simde__m128 calcPanGainsPS(simde__m128 value)
+void GdNetwork::updateFxGroups(unsigned fbTapIndex, unsigned count)
 {
-    return simde_mm_sqrt_ps(value);
-}
+    float sampleRate = sampleRate_;
 
-//==============================================================================
-void GdNetwork::mixMonoToStereo(unsigned tapIndex, const float *input, const float *level, const float *pans, const float *wet, float *const outputs[], unsigned count)
-{
-    float *leftOutput = outputs[0];
-    float *rightOutput = outputs[1];
+    // time for which a group or a tap must be stable before they go together
+    unsigned settleFrames = (unsigned)std::ceil(kFxGroupSettleTime * sampleRate);
+    // time of the crossfade of a tap which leaves a group
+    unsigned leaveFrames = (unsigned)std::ceil(GdParamSmoothTime * sampleRate);
 
-    unsigned i = 0;
+    FxGroupKey keys[GdMaxLines];
+    bool eligible[GdMaxLines];
+    int groupOfKey[GdMaxLines];
 
-    for (; i + 3 < count; i += 4) {
-        simde__m128 pan = simde_mm_load_ps(&pans[i]);
-        simde__m128 panGainLeft = calcPanGainsPS(simde_mm_sub_ps(simde_mm_set1_ps(1.0f), pan));
-        simde__m128 panGainRight = calcPanGainsPS(pan);
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        TapControl &tapControl = tapControls_[tapIndex];
 
-        simde__m128 in = simde_mm_load_ps(&input[i]);
-        simde__m128 gain = simde_mm_mul_ps(simde_mm_load_ps(&wet[i]), simde_mm_load_ps(&level[i]));
-        simde__m128 leftSample = simde_mm_mul_ps(panGainLeft, simde_mm_mul_ps(in, gain));
-        simde__m128 rightSample = simde_mm_mul_ps(panGainRight, simde_mm_mul_ps(in, gain));
+        eligible[tapIndex] = tapControl.enable_ && tapIndex != fbTapIndex &&
+            getFxGroupKey(tapControl, keys[tapIndex]);
+        groupOfKey[tapIndex] = -1;
 
-        simde_mm_storeu_ps(&leftOutput[i], simde_mm_add_ps(simde_mm_loadu_ps(&leftOutput[i]), leftSample));
-        simde_mm_storeu_ps(&rightOutput[i], simde_mm_add_ps(simde_mm_loadu_ps(&rightOutput[i]), rightSample));
+        tapControl.fxGroupEligibleFrames_ = !eligible[tapIndex] ? 0 :
+            std::min(tapControl.fxGroupEligibleFrames_ + count, ~0u - count);
+
+        // the feedback tap must run its own effects at once
+        if (tapIndex == fbTapIndex && tapControl.fxGroup_ != -1) {
+            tapControl.fxGroup_ = -1;
+            tapControl.fxGroupWeight_ = 0;
+            tapControl.fxGroupStep_ = 0;
+            for (ChannelDsp &chan : channels_)
+                chan.taps_[tapIndex].fx_.clear();
+        }
     }
 
-    for (; i < count; ++i) {
-        simde__m128 panGain = calcStereoPanGains(pans[i]);
+    // release the groups which no tap uses or requires anymore
+    for (unsigned groupIndex = 0; groupIndex < kMaxFxGroups; ++groupIndex) {
+        FxGroupControl &groupControl = fxGroupControls_[groupIndex];
 
-        float in = input[i];
-        float gain = wet[i] * level[i];
-        float leftSample = in * gain * ((float *)&panGain)[0];
-        float rightSample = in * gain * ((float *)&panGain)[1];
+        if (!groupControl.inUse_)
+            continue;
 
-        leftOutput[i] += leftSample;
-        rightOutput[i] += rightSample;
+        unsigned numUsers = 0;
+        unsigned numCandidates = 0;
+        for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+            numUsers += tapControls_[tapIndex].fxGroup_ == (int)groupIndex;
+            if (eligible[tapIndex] && keys[tapIndex] == groupControl.key_) {
+                groupOfKey[tapIndex] = (int)groupIndex;
+                ++numCandidates;
+            }
+        }
+
+        if (numUsers == 0 && numCandidates < 2)
+            groupControl.inUse_ = false;
     }
-}
 
-void GdNetwork::mixStereoToStereo(unsigned tapIndex, const float *const inputs[], const float *level, const float *pans, const float *widths, const float *wet, float *const outputs[], unsigned count)
-{
-    const float *leftInput = inputs[0];
+    // create groups for the sets of equivalent taps
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        if (!eligible[tapIndex] || groupOfKey[tapIndex] != -1)
+            continue;
+
+        const FxGroupKey &key = keys[tapIndex];
+
+        unsigned numCandidates = 1;
+        for (unsigned otherIndex = tapIndex + 1; otherIndex < GdMaxLines; ++otherIndex)
+            numCandidates += eligible[otherIndex] && keys[otherIndex] == key;
+        if (numCandidates < 2)
+            continue;
+
+        unsigned groupIndex = 0;
+        while (groupIndex < kMaxFxGroups && fxGroupControls_[groupIndex].inUse_)
+            ++groupIndex;
+        if (groupIndex == kMaxFxGroups)
+            break;
+
+        FxGroupControl &groupControl = fxGroupControls_[groupIndex];
+        groupControl.inUse_ = true;
+        groupControl.key_ = key;
+        groupControl.warmFrames_ = 0;
+
+        // the line does not need clearing, it's not read before it's filled
+        for (ChannelDsp &chan : channels_)
+            chan.fxGroups_[groupIndex].fx_.clear();
+
+        for (unsigned otherIndex = tapIndex; otherIndex < GdMaxLines; ++otherIndex) {
+            if (eligible[otherIndex] && keys[otherIndex] == key)
+                groupOfKey[otherIndex] = (int)groupIndex;
+        }
+    }
+
+    // let the taps enter and leave the groups
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        TapControl &tapControl = tapControls_[tapIndex];
+        int fxGroup = tapControl.fxGroup_;
+
+        if (fxGroup != -1) {
+            bool mustLeave = !eligible[tapIndex] || groupOfKey[tapIndex] != fxGroup;
+            if (mustLeave && tapControl.fxGroupStep_ >= 0) {
+                // restart the own effects, they are faded in while they settle
+                tapControl.fxGroupStep_ = -1.0f / (float)leaveFrames;
+                for (ChannelDsp &chan : channels_)
+                    chan.taps_[tapIndex].clearFx(tapControl.reducedRate_, oversampling_);
+            }
+        }
+        else if (groupOfKey[tapIndex] != -1) {
+            const FxGroupControl &groupControl = fxGroupControls_[groupOfKey[tapIndex]];
+            const LinearSmoother &smoothDelay = tapControl.smoothDelay_;
+            float maxDelay = std::max(smoothDelay.getCurrentValue(), smoothDelay.getTarget());
+            unsigned delayFrames = (unsigned)std::ceil(maxDelay * sampleRate);
+            bool canEnter = tapControl.fxGroupEligibleFrames_ >= settleFrames &&
+                groupControl.warmFrames_ >= delayFrames + settleFrames;
+            if (canEnter) {
+                tapControl.fxGroup_ = groupOfKey[tapIndex];
+                tapControl.fxGroupWeight_ = 0;
+                tapControl.fxGroupStep_ = 1.0f / (float)kTileSize;
+            }
+        }
+    }
+}
+
+//==============================================================================
+unsigned GdNetwork::getReducedRate(const TapControl &tapControl) const
+{
+    int filter = tapControl.filterEnable_ ? tapControl.filter_ : GdFilterOff;
+
+    // the low-pass must remove what the resamplers let alias
+    float slopeDB;
+    switch (filter) {
+    case GdFilter6dB:
+        slopeDB = 6.0f;
+        break;
+    case GdFilter12dB:
+    case GdFilter12dBSVF:
+        slopeDB = 12.0f;
+        break;
+    default:
+        return 0;
+    }
+
+    // the saturation of the analog filters makes harmonics past their band,
+    // which would fold back at a reduced rate
+    if (tapControl.analog_)
+        return 0;
+
+    // with small blocks, the resamplers cost more per call than they save
+    if (bufferSize_ < kSmallBlockSize)
+        return 0;
+
+    // the shifter must be pass-through, it would move the band of the filter
+    const LinearSmoother &smoothShift = tapControl.smoothShiftLinear_;
+    if (smoothShift.getCurrentValue() != 1.0f || smoothShift.getTarget() != 1.0f)
+        return 0;
+
+    const LinearSmoother &smoothLpf = tapControl.smoothLpfCutoff_;
+    const LinearSmoother &smoothHpf = tapControl.smoothHpfCutoff_;
+    const LinearSmoother &smoothDelay = tapControl.smoothDelay_;
+    float lpfCutoff = std::max(smoothLpf.getCurrentValue(), smoothLpf.getTarget());
+    float hpfCutoff = std::max(smoothHpf.getCurrentValue(), smoothHpf.getTarget());
+    float minDelay = std::min(smoothDelay.getCurrentValue(), smoothDelay.getTarget());
+
+    // at a reduced rate, the movements of the controls lag by the latency,
+    // so a tap only goes down while they are still
+    bool isSettled = true;
+    const LinearSmoother *smoothers[] = {
+        &smoothLpf,
+        &smoothHpf,
+        &tapControl.smoothResonanceLinear_,
+        &smoothDelay,
+    };
+    for (const LinearSmoother *smoother : smoothers)
+        isSettled = isSettled && smoother->getCurrentValue() == smoother->getTarget();
+
+    float sampleRate = sampleRate_;
+    float cutoffRatio = std::exp2(-kReducedRateAttenuationDB / slopeDB);
+
+    for (unsigned reducedRate = kMaxReducedRate; reducedRate > 0; --reducedRate) {
+        if (reducedRate > tapControl.reducedRate_ && !isSettled)
+            continue;
+
+        // the passband of the resamplers, the narrowest being the last stage
+        float passband = GdHalfBand::Narrow::Passband * sampleRate / (float)(1u << (reducedRate - 1));
+        float maxCutoff = passband * cutoffRatio;
+        if (reducedRate == tapControl.reducedRate_)
+            maxCutoff *= kReducedRateHysteresis;
+
+        // the line must be long enough to compensate the latency
+        bool canReduce = lpfCutoff <= maxCutoff && hpfCutoff <= maxCutoff &&
+            minDelay * sampleRate >= (float)(getReducedRateLatency(reducedRate) + 1);
+        if (canReduce)
+            return reducedRate;
+    }
+
+    return 0;
+}
+
+unsigned GdNetwork::getReducedRateLatency(unsigned reducedRate)
+{
+    // each stage adds its latency at its own rate
+    return GdHalfBand::Narrow::RoundTripLatency * ((1u << reducedRate) - 1);
+}
+
+float GdNetwork::getOversamplingLatency(unsigned oversampling)
+{
+    // each stage adds its latency at its own rate, and the inner stage is
+    // delayed by a frame to make its latency whole at the sample rate
+    float latency = 0;
+    if (oversampling > 0)
+        latency += (float)GdHalfBand::Wide::RoundTripLatency / 2;
+    if (oversampling > 1)
+        latency += (float)(GdHalfBand::Narrow::RoundTripLatency + 2) / 4;
+    return latency;
+}
+
+float GdNetwork::getFxLatency(unsigned reducedRate) const
+{
+    // the effects at the full rate are oversampled, or run directly
+    if (reducedRate != 0)
+        return (float)getReducedRateLatency(reducedRate);
+    return getOversamplingLatency(oversampling_);
+}
+
+void GdNetwork::updateReducedRates(unsigned fbTapIndex)
+{
+    // time for which a tap runs the next rate silently, before a short crossfade
+    unsigned warmFrames = (unsigned)std::ceil(kReducedRateWarmTime * sampleRate_);
+
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        TapControl &tapControl = tapControls_[tapIndex];
+
+        if (!tapControl.enable_)
+            continue;
+
+        // the feedback tap runs its effects frame by frame, at the full rate
+        if (tapIndex == fbTapIndex) {
+            if (tapControl.reducedRate_ != 0 || tapControl.nextReducedRate_ != 0) {
+                tapControl.reducedRate_ = 0;
+                tapControl.nextReducedRate_ = 0;
+                tapControl.reducedRateWeight_ = 0;
+                tapControl.reducedRateStep_ = 0;
+                for (ChannelDsp &chan : channels_)
+                    chan.taps_[tapIndex].clearFx(0, 0);
+            }
+            continue;
+        }
+
+        unsigned reducedRate = getReducedRate(tapControl);
+
+        // the own effects are idle while the tap is in a group, so change
+        // at once, the effects get cleared when the tap leaves the group
+        if (tapControl.fxGroup_ != -1 && tapControl.fxGroupStep_ == 0) {
+            tapControl.reducedRate_ = reducedRate;
+            tapControl.nextReducedRate_ = reducedRate;
+            tapControl.reducedRateWeight_ = 0;
+            tapControl.reducedRateStep_ = 0;
+            continue;
+        }
+
+        if (tapControl.reducedRateStep_ != 0 || reducedRate == tapControl.reducedRate_)
+            continue;
+
+        // start the effects at the next rate, the weight stays at zero while they warm up
+        tapControl.nextReducedRate_ = reducedRate;
+        tapControl.reducedRateWeight_ = -(float)warmFrames / (float)kTileSize;
+        tapControl.reducedRateStep_ = 1.0f / (float)kTileSize;
+        for (ChannelDsp &chan : channels_)
+            chan.taps_[tapIndex].clearFx(reducedRate, oversampling_);
+    }
+}
+
+//==============================================================================
+bool GdNetwork::isSilent(const TapControl &tapControl, bool isWetOff)
+{
+    // the transitions progress frame by frame, let them complete
+    if (tapControl.fxGroupStep_ != 0 || tapControl.reducedRateStep_ != 0)
+        return false;
+
+    const LinearSmoother &smoothLevel = tapControl.smoothLevelLinear_;
+    return isWetOff || (smoothLevel.getCurrentValue() == 0.0f && smoothLevel.getTarget() == 0.0f);
+}
+
+bool GdNetwork::usesFilterBank(const TapControl &tapControl, unsigned oversampling)
+{
+#if GD_FILTER_DOUBLE_PRECISION
+    // the bank computes in single precision only
+    (void)tapControl;
+    (void)oversampling;
+    return false;
+#else
+    // the tap runs only its own effects, at the sample rate, with its filters
+    // on; the state-variable filters, which glide at every frame, run apart
+    int filter = tapControl.filterEnable_ ? tapControl.filter_ : GdFilterOff;
+    return filter != GdFilterOff && filter != GdFilter12dBSVF && tapControl.fxGroup_ == -1 && oversampling == 0 &&
+        tapControl.reducedRate_ == 0 && tapControl.reducedRateStep_ == 0;
+#endif
+}
+
+void GdNetwork::skipTapControls(unsigned tapIndex, TapControl &tapControl, unsigned count)
+{
+    for (LinearSmoother *smoother : tapControl.getSmoothers())
+        smoother->skip(count);
+
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+    smoothTapLatency_[tapIndex].setTarget(channels_[0].taps_[tapIndex].getFullRateFx(oversampling_).getLatency());
+    smoothTapLatency_[tapIndex].skip(count);
+#else
+    (void)tapIndex;
+#endif
+}
+
+//==============================================================================
+bool GdNetwork::updateMonoMode(const float *const inputs[], unsigned fbTapIndex, unsigned count)
+{
+    if (channelMode_ != Stereo)
+        return false;
+
+    bool isMonoInput = maxAbsDifference(inputs[0], inputs[1], count) <= kMonoThreshold;
+    monoFrames_ = !isMonoInput ? 0 : std::min(monoFrames_ + count, ~0u - count);
+
+    // the feedback of this block is not compared yet, so count it afterwards
+    unsigned monoFeedbackFrames = monoFeedbackFrames_;
+    monoFeedbackFrames_ = std::min(monoFeedbackFrames_ + count, ~0u - count);
+
+    // the time for which a difference of the channels stays in the network
+    float maxDelay = 0;
+    bool canCopyFx = true;
+    for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        const TapControl &tapControl = tapControls_[tapIndex];
+
+        if (!tapControl.enable_)
+            continue;
+
+        const LinearSmoother &smoothDelay = tapControl.smoothDelay_;
+        maxDelay = std::max(maxDelay, std::max(smoothDelay.getCurrentValue(), smoothDelay.getTarget()));
+
+#if !GD_SHIFTER_CAN_COPY_STATE
+        // the state of a shifter only matters while it's not pass-through
+        const LinearSmoother &smoothShift = tapControl.smoothShiftLinear_;
+        canCopyFx = canCopyFx && smoothShift.getCurrentValue() == 1.0f && smoothShift.getTarget() == 1.0f;
+#endif
+    }
+    unsigned monoRequiredFrames = (unsigned)std::ceil((maxDelay + kMonoSettleTime) * sampleRate_);
+
+    bool isMono = canCopyFx && monoFrames_ >= monoRequiredFrames &&
+        (fbTapIndex == ~0u || monoFeedbackFrames >= monoRequiredFrames);
+
+    // back to stereo, the second channel continues from the state of the
+    // first, since it has been writing the same lines
+    if (isMono_ && !isMono) {
+        const ChannelDsp &first = channels_[0];
+        ChannelDsp &second = channels_[1];
+
+        second.feedback_ = first.feedback_;
+
+        for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+            if (tapControls_[tapIndex].enable_)
+                second.taps_[tapIndex].copyFxState(first.taps_[tapIndex]);
+        }
+
+        for (unsigned groupIndex = 0; groupIndex < kMaxFxGroups; ++groupIndex) {
+            if (fxGroupControls_[groupIndex].inUse_)
+                second.fxGroups_[groupIndex].copyFxState(first.fxGroups_[groupIndex]);
+        }
+    }
+
+    isMono_ = isMono;
+    return isMono;
+}
+
+//==============================================================================
+template <class Allocator>
+auto GdNetwork::allocateTempBuffers(Allocator &allocator, unsigned numChannels, unsigned count) -> TempBuffers
+{
+    TempBuffers temp;
+
+    temp.delays = allocator.template allocate<float>(count);
+    temp.feedbackGain = allocator.template allocate<float>(count);
+    temp.level = allocator.template allocate<float>(count);
+    temp.pan = allocator.template allocate<float>(count);
+    temp.width = allocator.template allocate<float>(count);
+    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+        temp.feedbackTapOutputs[chanIndex] = allocator.template allocate<float>(count);
+        temp.ordinaryTapOutputs[chanIndex] = allocator.template allocate<float>(kTileSize);
+        temp.inputAndFeedbackSums[chanIndex] = allocator.template allocate<float>(count);
+    }
+    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+        temp.sharedTapOutputs[chanIndex] = allocator.template allocate<float>(kTileSize);
+    temp.sharedFxWeights = allocator.template allocate<float>(kTileSize);
+    temp.sharedFxShift = allocator.template allocate<float>(kTileSize);
+    for (unsigned k = 0; k < 2; ++k)
+        temp.reducedRateDelays[k] = allocator.template allocate<float>(kTileSize);
+    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex)
+        temp.reducedRateTapOutputs[chanIndex] = allocator.template allocate<float>(kTileSize);
+    temp.reducedRateWeights = allocator.template allocate<float>(kTileSize);
+    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+        for (unsigned stage = 0; stage < kMaxReducedRate; ++stage)
+            temp.reducedRateFrames[chanIndex][stage] = allocator.template allocate<float>(kTileSize);
+    }
+    for (unsigned chanIndex = 0; chanIndex < numChannels; ++chanIndex) {
+        for (unsigned stage = 0; stage < kMaxOversampling; ++stage)
+            temp.oversampledFrames[chanIndex][stage] = allocator.template allocate<float>(kTileSize << (stage + 1));
+    }
+    temp.latencyDelays = allocator.template allocate<float>(count);
+    temp.lpfCutoff = allocator.template allocate<float>(count);
+    temp.hpfCutoff = allocator.template allocate<float>(count);
+    temp.resonance = allocator.template allocate<float>(count);
+    temp.shift = allocator.template allocate<float>(count);
+    temp.warmUpLpfCutoff = allocator.template allocate<float>(kTileSize);
+    temp.warmUpHpfCutoff = allocator.template allocate<float>(kTileSize);
+    temp.warmUpResonance = allocator.template allocate<float>(kTileSize);
+    temp.warmUpShift = allocator.template allocate<float>(kTileSize);
+    if (numChannels <= GdFilterBank::kNumLanes) {
+        for (unsigned bankIndex = 0; bankIndex < getMaxBankTaps(numChannels); ++bankIndex) {
+            temp.bankDelays[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankLevel[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankPan[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankWidth[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankLpfCutoff[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankHpfCutoff[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankResonance[bankIndex] = allocator.template allocate<float>(count);
+            temp.bankShift[bankIndex] = allocator.template allocate<float>(count);
+        }
+        for (unsigned lane = 0; lane < GdFilterBank::kNumLanes; ++lane)
+            temp.bankTapOutputs[lane] = allocator.template allocate<float>(kTileSize);
+    }
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+    temp.latency = allocator.template allocate<float>(count);
+#endif
+
+    return temp;
+}
+
+unsigned GdNetwork::getMaxBankTaps(unsigned numChannels)
+{
+    return std::min((unsigned)kMaxBankTaps, (unsigned)GdFilterBank::kNumLanes / numChannels);
+}
+
+//==============================================================================
+static inline simde__m128 calcStereoPanGains(float value)
+{
+    simde__m128 x = simde_mm_setr_ps(1.0f - value, value, 0.0f, 0.0f);
+    simde__m128 y = simde_mm_sqrt_ps(x);
+    return y;
+}
+
+static inline simde__m128 calcPanGainsPS(simde__m128 value)
+{
+    return simde_mm_sqrt_ps(value);
+}
+
+//==============================================================================
+void GdNetwork::mixToOutputs(unsigned tapIndex, const float *const inputs[], const float *level, const float *pan, const float *width, const float *wet, float *const outputs[], unsigned count)
+{
+    if (channelMode_ == Mono) {
+        mixMonoToStereo(tapIndex, inputs[0], level, pan, wet, outputs, count);
+        return;
+    }
+
+    // the pairs are panned, the single channels go to their own outputs
+    unsigned numChannels = (unsigned)channels_.size();
+    unsigned chanIndex = 0;
+    for (; chanIndex < 2 * numPairs_; chanIndex += 2)
+        mixStereoToStereo(tapIndex, &inputs[chanIndex], level, pan, width, wet, &outputs[chanIndex], count);
+    for (; chanIndex < numChannels; ++chanIndex)
+        mixMonoToMono(tapIndex, inputs[chanIndex], level, wet, outputs[chanIndex], count);
+}
+
+void GdNetwork::mixMonoToMono(unsigned tapIndex, const float *input, const float *level, const float *wet, float *output, unsigned count)
+{
+    unsigned i = 0;
+
+    for (; i + 3 < count; i += 4) {
+        simde__m128 in = simde_mm_load_ps(&input[i]);
+        simde__m128 gain = simde_mm_mul_ps(simde_mm_load_ps(&wet[i]), simde_mm_load_ps(&level[i]));
+        simde__m128 sample = simde_mm_mul_ps(in, gain);
+
+        simde_mm_storeu_ps(&output[i], simde_mm_add_ps(simde_mm_loadu_ps(&output[i]), sample));
+    }
+
+    for (; i < count; ++i) {
+        float in = input[i];
+        float gain = wet[i] * level[i];
+        output[i] += in * gain;
+    }
+}
+
+void GdNetwork::mixMonoToStereo(unsigned tapIndex, const float *input, const float *level, const float *pans, const float *wet, float *const outputs[], unsigned count)
+{
+    float *leftOutput = outputs[0];
+    float *rightOutput = outputs[1];
+
+    unsigned i = 0;
+
+    for (; i + 3 < count; i += 4) {
+        simde__m128 pan = simde_mm_load_ps(&pans[i]);
+        simde__m128 panGainLeft = calcPanGainsPS(simde_mm_sub_ps(simde_mm_set1_ps(1.0f), pan));
+        simde__m128 panGainRight = calcPanGainsPS(pan);
+
+        simde__m128 in = simde_mm_load_ps(&input[i]);
+        simde__m128 gain = simde_mm_mul_ps(simde_mm_load_ps(&wet[i]), simde_mm_load_ps(&level[i]));
+        simde__m128 leftSample = simde_mm_mul_ps(panGainLeft, simde_mm_mul_ps(in, gain));
+        simde__m128 rightSample = simde_mm_mul_ps(panGainRight, simde_mm_mul_ps(in, gain));
+
+        simde_mm_storeu_ps(&leftOutput[i], simde_mm_add_ps(simde_mm_loadu_ps(&leftOutput[i]), leftSample));
+        simde_mm_storeu_ps(&rightOutput[i], simde_mm_add_ps(simde_mm_loadu_ps(&rightOutput[i]), rightSample));
+    }
+
+    for (; i < count; ++i) {
+        simde__m128 panGain = calcStereoPanGains(pans[i]);
+
+        float in = input[i];
+        float gain = wet[i] * level[i];
+        float leftSample = in * gain * ((float *)&panGain)[0];
+        float rightSample = in * gain * ((float *)&panGain)[1];
+
+        leftOutput[i] += leftSample;
+        rightOutput[i] += rightSample;
+    }
+}
+
+void GdNetwork::mixStereoToStereo(unsigned tapIndex, const float *const inputs[], const float *level, const float *pans, const float *widths, const float *wet, float *const outputs[], unsigned count)
+{
+    const float *leftInput = inputs[0];
     const float *rightInput = inputs[1];
     float *leftOutput = outputs[0];
     float *rightOutput = outputs[1];
@@ -514,19 +1730,288 @@ void GdNetwork::TapDsp::clear()
 {
     line_.clear();
     fx_.clear();
+
+    for (ReducedRateDsp &reduced : reduced_)
+        reduced.clear();
+
+    for (OversampledDsp &oversampled : oversampled_)
+        oversampled.clear();
+}
+
+void GdNetwork::TapDsp::clearFx(unsigned reducedRate, unsigned oversampling)
+{
+    if (reducedRate != 0)
+        reduced_[reducedRate - 1].clear();
+    else if (oversampling != 0)
+        oversampled_[oversampling - 1].clear();
+    else
+        fx_.clear();
+}
+
+const GdTapFx &GdNetwork::TapDsp::getFullRateFx(unsigned oversampling) const
+{
+    return (oversampling == 0) ? fx_ : oversampled_[oversampling - 1].fx_;
+}
+
+void GdNetwork::TapDsp::copyFxState(const TapDsp &other)
+{
+    fx_.copyState(other.fx_);
+
+    for (unsigned reducedRate = 1; reducedRate <= kMaxReducedRate; ++reducedRate)
+        reduced_[reducedRate - 1].copyFxState(other.reduced_[reducedRate - 1]);
+
+    for (unsigned oversampling = 1; oversampling <= kMaxOversampling; ++oversampling)
+        oversampled_[oversampling - 1].copyFxState(other.oversampled_[oversampling - 1]);
 }
 
 void GdNetwork::TapDsp::setSampleRate(float sampleRate)
 {
     line_.setSampleRate(sampleRate);
     fx_.setSampleRate(sampleRate);
+
+    for (unsigned reducedRate = 1; reducedRate <= kMaxReducedRate; ++reducedRate)
+        reduced_[reducedRate - 1].setSampleRate(sampleRate / (float)(1u << reducedRate));
+
+    for (unsigned oversampling = 1; oversampling <= kMaxOversampling; ++oversampling)
+        oversampled_[oversampling - 1].setSampleRate(sampleRate * (float)(1u << oversampling));
 }
 
 void GdNetwork::TapDsp::setBufferSize(unsigned bufferSize)
+{
+    fx_.setBufferSize(bufferSize);
+
+    for (ReducedRateDsp &reduced : reduced_)
+        reduced.setBufferSize(bufferSize);
+
+    for (unsigned oversampling = 1; oversampling <= kMaxOversampling; ++oversampling)
+        oversampled_[oversampling - 1].setBufferSize(bufferSize << oversampling);
+}
+
+// runs the effects of all the channels in chunks of the control interval,
+// for frames at a rate divided or multiplied by a power of 2, which read the
+// controls at the sample rate; the chunk before the first update continues
+// the previous block
+static void processFxInControlChunks(GdTapFx *const fxs[], float *const frames[], unsigned numFx, GdTapFx::Control control, unsigned index, unsigned count, unsigned firstUpdate, unsigned reducedRate, unsigned oversampling)
+{
+    // keep the interval in time, the controls move as fast at any rate
+    const unsigned interval = (GdTapFx::kControlUpdateInterval << oversampling) >> reducedRate;
+    control.updateInterval = interval;
+
+    // constant controls update once, in the first tile of the block; the
+    // chunks remain, because the channels interleave the recursions of
+    // their filters, which are otherwise bound by latency
+    bool mustUpdate = !control.isConstant || index == 0;
+
+    unsigned i = 0;
+    unsigned nextUpdate = firstUpdate;
+
+    while (i < count) {
+        if (i == nextUpdate) {
+            if (mustUpdate)
+                performKRateUpdates(fxs, numFx, control, index + ((i << reducedRate) >> oversampling));
+            mustUpdate = !control.isConstant;
+            nextUpdate += interval;
+        }
+        unsigned j = std::min(nextUpdate, count);
+        for (unsigned fxIndex = 0; fxIndex < numFx; ++fxIndex)
+            fxs[fxIndex]->process(frames[fxIndex] + i, frames[fxIndex] + i, control, j - i);
+        i = j;
+    }
+}
+
+void GdNetwork::TapDsp::processFx(TapDsp *const taps[], unsigned numTaps, unsigned reducedRate, unsigned oversampling, float *const frames[], GdTapFx::Control control, unsigned index, unsigned count, unsigned firstUpdate, float *const reducedFrames[][kMaxReducedRate], float *const oversampledFrames[][kMaxOversampling])
+{
+    GdTapFx *fxs[GdMaxChannels] {};
+
+    if (reducedRate == 0 && oversampling == 0) {
+        for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex)
+            fxs[chanIndex] = &taps[chanIndex]->fx_;
+        processFxInControlChunks(fxs, frames, numTaps, control, index, count, firstUpdate, 0, 0);
+        return;
+    }
+
+    if (reducedRate == 0) {
+        // interpolate up to the rate of the effects, every stage makes
+        // exactly twice the frames of its input
+        float *highRateFrames[GdMaxChannels] {};
+        for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex) {
+            OversampledDsp &oversampled = taps[chanIndex]->oversampled_[oversampling - 1];
+            oversampled.interpolator_.process(frames[chanIndex], count, oversampledFrames[chanIndex][0], 2 * count);
+            if (oversampling > 1) {
+                // delay by a frame at twice the rate, which makes the latency
+                // whole at the sample rate
+                float *stageFrames = oversampledFrames[chanIndex][0];
+                float delayedFrame = stageFrames[2 * count - 1];
+                std::copy_backward(stageFrames, stageFrames + 2 * count - 1, stageFrames + 2 * count);
+                stageFrames[0] = oversampled.delayedFrame_;
+                oversampled.delayedFrame_ = delayedFrame;
+                oversampled.innerInterpolator_.process(stageFrames, 2 * count, oversampledFrames[chanIndex][1], 4 * count);
+            }
+            fxs[chanIndex] = &oversampled.fx_;
+            highRateFrames[chanIndex] = oversampledFrames[chanIndex][oversampling - 1];
+        }
+
+        // the grid of updates continues at the higher rate
+        processFxInControlChunks(fxs, highRateFrames, numTaps, control, index, count << oversampling, firstUpdate << oversampling, 0, oversampling);
+
+        // decimate back down to the sample rate
+        for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex) {
+            OversampledDsp &oversampled = taps[chanIndex]->oversampled_[oversampling - 1];
+            if (oversampling > 1)
+                oversampled.innerDecimator_.process(oversampledFrames[chanIndex][1], oversampledFrames[chanIndex][0], 4 * count);
+            oversampled.decimator_.process(oversampledFrames[chanIndex][0], frames[chanIndex], 2 * count);
+        }
+        return;
+    }
+
+    // decimate down to the rate of the effects, the resamplers of all the
+    // channels have processed the same counts, so they produce the same
+    unsigned stageCounts[kMaxReducedRate + 1] {};
+    float *reducedRateFrames[GdMaxChannels] {};
+    stageCounts[0] = count;
+    for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex) {
+        ReducedRateDsp &reduced = taps[chanIndex]->reduced_[reducedRate - 1];
+        const float *stageInput = frames[chanIndex];
+        for (unsigned stage = 0; stage < reducedRate; ++stage) {
+            stageCounts[stage + 1] = reduced.decimators_[stage].process(stageInput, reducedFrames[chanIndex][stage], stageCounts[stage]);
+            stageInput = reducedFrames[chanIndex][stage];
+        }
+        fxs[chanIndex] = &reduced.fx_;
+        reducedRateFrames[chanIndex] = reducedFrames[chanIndex][reducedRate - 1];
+    }
+
+    // the grid of updates does not continue at the reduced rate, since the
+    // resamplers do not output a fixed number of frames per block
+    processFxInControlChunks(fxs, reducedRateFrames, numTaps, control, index, stageCounts[reducedRate], 0, reducedRate, 0);
+
+    // interpolate back up to the sample rate
+    for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex) {
+        ReducedRateDsp &reduced = taps[chanIndex]->reduced_[reducedRate - 1];
+        for (unsigned stage = reducedRate; stage-- > 0; ) {
+            float *stageOutput = (stage > 0) ? reducedFrames[chanIndex][stage - 1] : frames[chanIndex];
+            reduced.interpolators_[stage].process(reducedFrames[chanIndex][stage], stageCounts[stage + 1], stageOutput, stageCounts[stage]);
+        }
+    }
+}
+
+void GdNetwork::TapDsp::warmUpFx(TapDsp *const taps[], unsigned numTaps, unsigned reducedRate, unsigned oversampling, float delay, unsigned lag, unsigned count, GdTapFx::Control control, float *const frames[], float *delays, float *const reducedFrames[][kMaxReducedRate], float *const oversampledFrames[][kMaxOversampling])
+{
+    // the controls are constant, the same tile of them serves every tile
+    std::fill_n(delays, kTileSize, delay);
+
+    for (unsigned tileStart = 0; tileStart < count; tileStart += kTileSize) {
+        unsigned tileCount = std::min(count - tileStart, (unsigned)kTileSize);
+
+        for (unsigned chanIndex = 0; chanIndex < numTaps; ++chanIndex) {
+            const GdLine &line = taps[chanIndex]->line_;
+            // the index where the first frame of the history was written
+            unsigned lineIndex = line.getLineIndex() + line.getCapacity() - lag;
+            line.read(lineIndex + tileStart, delays, frames[chanIndex], tileCount);
+        }
+
+        processFx(taps, numTaps, reducedRate, oversampling, frames, control, 0, tileCount, 0, reducedFrames, oversampledFrames);
+    }
+}
+
+//==============================================================================
+void GdNetwork::ReducedRateDsp::clear()
+{
+    fx_.clear();
+
+    for (GdHalfBandDecimator<GdHalfBand::Narrow> &decimator : decimators_)
+        decimator.clear();
+    for (GdHalfBandInterpolator<GdHalfBand::Narrow> &interpolator : interpolators_)
+        interpolator.clear();
+}
+
+void GdNetwork::ReducedRateDsp::copyFxState(const ReducedRateDsp &other)
+{
+    fx_.copyState(other.fx_);
+
+    for (unsigned stage = 0; stage < kMaxReducedRate; ++stage) {
+        decimators_[stage] = other.decimators_[stage];
+        interpolators_[stage] = other.interpolators_[stage];
+    }
+}
+
+void GdNetwork::ReducedRateDsp::setSampleRate(float sampleRate)
+{
+    fx_.setSampleRate(sampleRate);
+}
+
+void GdNetwork::ReducedRateDsp::setBufferSize(unsigned bufferSize)
+{
+    fx_.setBufferSize(bufferSize);
+}
+
+//==============================================================================
+void GdNetwork::OversampledDsp::clear()
+{
+    fx_.clear();
+
+    interpolator_.clear();
+    decimator_.clear();
+    innerInterpolator_.clear();
+    innerDecimator_.clear();
+    delayedFrame_ = 0;
+}
+
+void GdNetwork::OversampledDsp::copyFxState(const OversampledDsp &other)
+{
+    fx_.copyState(other.fx_);
+
+    interpolator_ = other.interpolator_;
+    decimator_ = other.decimator_;
+    innerInterpolator_ = other.innerInterpolator_;
+    innerDecimator_ = other.innerDecimator_;
+    delayedFrame_ = other.delayedFrame_;
+}
+
+void GdNetwork::OversampledDsp::setSampleRate(float sampleRate)
+{
+    fx_.setSampleRate(sampleRate);
+}
+
+void GdNetwork::OversampledDsp::setBufferSize(unsigned bufferSize)
 {
     fx_.setBufferSize(bufferSize);
 }
 
+//==============================================================================
+GdNetwork::FxGroupDsp::FxGroupDsp()
+{
+    line_.setMaxDelay(GdMaxDelay);
+}
+
+void GdNetwork::FxGroupDsp::clear()
+{
+    fx_.clear();
+    line_.clear();
+    lineIndex_ = 0;
+}
+
+void GdNetwork::FxGroupDsp::copyFxState(const FxGroupDsp &other)
+{
+    fx_.copyState(other.fx_);
+}
+
+void GdNetwork::FxGroupDsp::setSampleRate(float sampleRate)
+{
+    fx_.setSampleRate(sampleRate);
+    line_.setSampleRate(sampleRate);
+}
+
+void GdNetwork::FxGroupDsp::setBufferSize(unsigned bufferSize)
+{
+    fx_.setBufferSize(bufferSize);
+}
+
+bool GdNetwork::FxGroupKey::operator==(const FxGroupKey &other) const
+{
+    return filter == other.filter && lpfCutoff == other.lpfCutoff &&
+        hpfCutoff == other.hpfCutoff && resonance == other.resonance;
+}
+
 //==============================================================================
 void GdNetwork::ChannelDsp::clear()
 {
@@ -534,18 +2019,27 @@ void GdNetwork::ChannelDsp::clear()
 
     for (TapDsp &tap : taps_)
         tap.clear();
+
+    for (FxGroupDsp &group : fxGroups_)
+        group.clear();
 }
 
 void GdNetwork::ChannelDsp::setSampleRate(float sampleRate)
 {
     for (TapDsp &tap : taps_)
         tap.setSampleRate(sampleRate);
+
+    for (FxGroupDsp &group : fxGroups_)
+        group.setSampleRate(sampleRate);
 }
 
 void GdNetwork::ChannelDsp::setBufferSize(unsigned bufferSize)
 {
     for (TapDsp &tap : taps_)
         tap.setBufferSize(bufferSize);
+
+    for (FxGroupDsp &group : fxGroups_)
+        group.setBufferSize(bufferSize);
 }
 
 //==============================================================================
@@ -559,6 +2053,18 @@ void GdNetwork::TapControl::clear()
 {
     for (LinearSmoother *smoother : getSmoothers())
         smoother->clearToTarget();
+
+    fxGroup_ = -1;
+    fxGroupWeight_ = 0;
+    fxGroupStep_ = 0;
+    fxGroupEligibleFrames_ = 0;
+
+    reducedRate_ = 0;
+    nextReducedRate_ = 0;
+    reducedRateWeight_ = 0;
+    reducedRateStep_ = 0;
+
+    warmUpLag_ = 0;
 }
 
 void GdNetwork::TapControl::setSampleRate(float sampleRate)
@@ -580,3 +2086,124 @@ auto GdNetwork::TapControl::getSmoothers() -> std::array<LinearSmoother *, kNumS
         &smoothWidth_,
     }};
 }
+
+//==============================================================================
+template <class Archive> void GdNetwork::archiveState(Archive &archive)
+{
+    for (ChannelDsp &chan : channels_)
+        chan.archiveState(archive);
+
+    archive.value(isMono_);
+    archive.value(monoFrames_);
+    archive.value(monoFeedbackFrames_);
+
+    smoothFbGainLinear_.archiveState(archive);
+    for (TapControl &tapControl : tapControls_)
+        tapControl.archiveState(archive);
+    for (FxGroupControl &groupControl : fxGroupControls_)
+        groupControl.archiveState(archive);
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+    for (LinearSmoother &smoother : smoothTapLatency_)
+        smoother.archiveState(archive);
+#endif
+
+    archive.value(controlPhase_);
+    archive.value(bookkeepingFrames_);
+    archive.value(bookkeepingFbTapIndex_);
+    archive.check(controlPhase_ < GdTapFx::kControlUpdateInterval);
+    archive.check(bookkeepingFbTapIndex_ == ~0u || bookkeepingFbTapIndex_ < GdMaxLines);
+
+    for (GdLine &line : latencyLines_)
+        line.archiveState(archive);
+    for (GdLine &line : directLatencyLines_)
+        line.archiveState(archive);
+}
+
+void GdNetwork::saveState(GdStateWriter &writer)
+{
+    archiveState(writer);
+}
+
+void GdNetwork::loadState(GdStateReader &reader)
+{
+    archiveState(reader);
+}
+
+template <class Archive> void GdNetwork::ReducedRateDsp::archiveState(Archive &archive)
+{
+    fx_.archiveState(archive);
+    for (unsigned stage = 0; stage < kMaxReducedRate; ++stage) {
+        decimators_[stage].archiveState(archive);
+        interpolators_[stage].archiveState(archive);
+    }
+}
+
+template <class Archive> void GdNetwork::OversampledDsp::archiveState(Archive &archive)
+{
+    fx_.archiveState(archive);
+    interpolator_.archiveState(archive);
+    decimator_.archiveState(archive);
+    innerInterpolator_.archiveState(archive);
+    innerDecimator_.archiveState(archive);
+    archive.value(delayedFrame_);
+}
+
+template <class Archive> void GdNetwork::TapDsp::archiveState(Archive &archive)
+{
+    line_.archiveState(archive);
+    fx_.archiveState(archive);
+    for (ReducedRateDsp &reduced : reduced_)
+        reduced.archiveState(archive);
+    for (OversampledDsp &oversampled : oversampled_)
+        oversampled.archiveState(archive);
+}
+
+template <class Archive> void GdNetwork::FxGroupDsp::archiveState(Archive &archive)
+{
+    fx_.archiveState(archive);
+    line_.archiveState(archive);
+    archive.value(lineIndex_);
+    archive.check(lineIndex_ < line_.getCapacity() || lineIndex_ == 0);
+}
+
+template <class Archive> void GdNetwork::ChannelDsp::archiveState(Archive &archive)
+{
+    archive.value(feedback_);
+    archive.check(std::isfinite(feedback_));
+    for (TapDsp &tap : taps_)
+        tap.archiveState(archive);
+    for (FxGroupDsp &group : fxGroups_)
+        group.archiveState(archive);
+}
+
+template <class Archive> void GdNetwork::TapControl::archiveState(Archive &archive)
+{
+    for (LinearSmoother *smoother : getSmoothers())
+        smoother->archiveState(archive);
+
+    archive.value(fxGroup_);
+    archive.value(fxGroupWeight_);
+    archive.value(fxGroupStep_);
+    archive.value(fxGroupEligibleFrames_);
+    archive.check(fxGroup_ >= -1 && fxGroup_ < kMaxFxGroups);
+    archive.check(std::isfinite(fxGroupWeight_) && std::isfinite(fxGroupStep_));
+
+    archive.value(reducedRate_);
+    archive.value(nextReducedRate_);
+    archive.value(reducedRateWeight_);
+    archive.value(reducedRateStep_);
+    archive.check(reducedRate_ <= kMaxReducedRate && nextReducedRate_ <= kMaxReducedRate);
+    archive.check(std::isfinite(reducedRateWeight_) && std::isfinite(reducedRateStep_));
+
+    archive.value(isSilent_);
+    archive.value(warmUpLag_);
+}
+
+template <class Archive> void GdNetwork::FxGroupControl::archiveState(Archive &archive)
+{
+    archive.value(inUse_);
+    archive.value(key_);
+    archive.value(warmFrames_);
+    archive.check(key_.filter >= GdFilterOff && key_.filter < GdNumFilterTypes);
+    archive.check(std::isfinite(key_.lpfCutoff) && std::isfinite(key_.hpfCutoff) && std::isfinite(key_.resonance));
+}
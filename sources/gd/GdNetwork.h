@@ -21,8 +21,12 @@
 #include "GdLine.h"
 #include "GdTapFx.h"
 #include "GdDefs.h"
+#include "GdState.h"
+#include "filters/GdFilterBank.h"
+#include "filters/GdHalfBand.h"
 #include "utility/LinearSmoother.h"
-#include <jsl/allocator>
+#include "utility/ScratchArena.h"
+#include "utility/MemoryPool.h"
 #include <array>
 #include <vector>
 #include <memory>
@@ -36,57 +40,204 @@ public:
     enum ChannelMode {
         Mono,
         Stereo,
+        Multichannel,
     };
 
     explicit GdNetwork(ChannelMode channelMode);
+    // a multichannel network, of which the channels are pairs of left and
+    // right, followed by the single channels
+    GdNetwork(unsigned numPairs, unsigned numSingles);
     ~GdNetwork();
+    ChannelMode getChannelMode() const { return channelMode_; }
+    unsigned getNumPairs() const { return numPairs_; }
+    unsigned getNumInputs() const { return (unsigned)channels_.size(); }
+    unsigned getNumOutputs() const { return (channelMode_ == Mono) ? 2 : (unsigned)channels_.size(); }
     void clear();
+    // the capacity of the lines, by default the longest delay of a tap;
+    // it's set before the sample rate, which allocates the lines
+    void setMaxDelay(float maxDelay);
     void setSampleRate(float sampleRate);
     void setBufferSize(unsigned bufferSize);
     void setParameter(unsigned parameter, float value);
     void setTempo(float tempo);
-    void process(const float *const inputs[], const float *dry, const float *wet, float *const outputs[], unsigned count);
+    // the latency of the oversampling, by which the dry signal and all the taps
+    // are delayed, in frames
+    unsigned getLatency() const;
+    // whether the taps are linear and invariant in time, which they are when
+    // the controls are settled, without feedback, shifting or analog filters
+    bool isStatic() const;
+    // keeps the taps running while the wet is off, without being heard, so
+    // that their effects are warm by the time the wet returns
+    void setKeepWarm(bool keepWarm);
+    // whether every tap which is heard with the wet on runs its effects, and
+    // none of them still waits for its warm-up
+    bool isWarm() const;
+    // the longest delay at which a tap is enabled, with the alignment to the grid
+    float getLongestTapDelay() const;
+    // whether an enabled tap shifts its pitch
+    bool isShifting() const;
+    // the time until the response to an input falls under the threshold,
+    // relative to its level, or infinity if the feedback does not decay
+    float getMemoryTime(float threshold) const;
+    // the taps which have direct outputs go there instead of the main outputs,
+    // with the same channels and the same mix; `directOutputs` may be null
+    void process(const float *const inputs[], const float *dry, const float *wet, float *const outputs[], float *const *const directOutputs[], unsigned count);
+    // the state of the processing, apart from the parameters; the network which
+    // loads has the same channels, sample rate and buffer size, and the same
+    // parameters are set before
+    void saveState(GdStateWriter &writer);
+    void loadState(GdStateReader &reader);
 
 //==============================================================================
 private:
+    struct TapControl;
+    struct FxGroupKey;
+    static bool getFxGroupKey(const TapControl &tapControl, FxGroupKey &key);
+    void updateFxGroups(unsigned fbTapIndex, unsigned count);
+    unsigned getReducedRate(const TapControl &tapControl) const;
+    static unsigned getReducedRateLatency(unsigned reducedRate);
+    static float getOversamplingLatency(unsigned oversampling);
+    float getFxLatency(unsigned reducedRate) const;
+    void updateReducedRates(unsigned fbTapIndex);
+    bool updateMonoMode(const float *const inputs[], unsigned fbTapIndex, unsigned count);
+    static bool isSilent(const TapControl &tapControl, bool isWetOff);
+    static bool usesFilterBank(const TapControl &tapControl, unsigned oversampling);
+    void skipTapControls(unsigned tapIndex, TapControl &tapControl, unsigned count);
+    void mixToOutputs(unsigned tapIndex, const float *const inputs[], const float *level, const float *pan, const float *width, const float *wet, float *const outputs[], unsigned count);
+    void mixMonoToMono(unsigned tapIndex, const float *input, const float *level, const float *wet, float *output, unsigned count);
     void mixMonoToStereo(unsigned tapIndex, const float *input, const float *level, const float *pan, const float *wet, float *const outputs[], unsigned count);
     void mixStereoToStereo(unsigned tapIndex, const float *const inputs[], const float *level, const float *pan, const float *width, const float *wet, float *const outputs[], unsigned count);
+    template <class Archive> void archiveState(Archive &archive);
 
 //==============================================================================
 private:
+    // the lowest rate of effects, as a power of 2 which divides the sample rate
+    enum { kMaxReducedRate = 2 };
+    static_assert((GdTapFx::kControlUpdateInterval >> kMaxReducedRate) > 0, "the control interval must be divisible at the lowest rate");
+
+    // the effects which run at a reduced rate, between the resamplers
+    struct ReducedRateDsp {
+        void clear();
+        void setSampleRate(float sampleRate);
+        void setBufferSize(unsigned bufferSize);
+        void copyFxState(const ReducedRateDsp &other);
+        template <class Archive> void archiveState(Archive &archive);
+
+        // parts
+        GdTapFx fx_;
+        GdHalfBandDecimator<GdHalfBand::Narrow> decimators_[kMaxReducedRate];
+        GdHalfBandInterpolator<GdHalfBand::Narrow> interpolators_[kMaxReducedRate];
+    };
+
+    // the highest rate of effects, as a power of 2 which multiplies the sample rate
+    enum { kMaxOversampling = 2 };
+
+    // the effects which run at a multiple of the rate, between the resamplers
+    struct OversampledDsp {
+        void clear();
+        void setSampleRate(float sampleRate);
+        void setBufferSize(unsigned bufferSize);
+        void copyFxState(const OversampledDsp &other);
+        template <class Archive> void archiveState(Archive &archive);
+
+        // parts
+        GdTapFx fx_;
+        // the stage at the sample rate keeps the whole audible band, the
+        // next stage only needs to keep the band of the first
+        GdHalfBandInterpolator<GdHalfBand::Wide> interpolator_;
+        GdHalfBandDecimator<GdHalfBand::Wide> decimator_;
+        GdHalfBandInterpolator<GdHalfBand::Narrow> innerInterpolator_;
+        GdHalfBandDecimator<GdHalfBand::Narrow> innerDecimator_;
+        // the last frame at twice the rate, which enters the next stage late
+        float delayedFrame_ = 0;
+    };
+
     struct TapDsp {
         TapDsp();
         void clear();
+        void clearFx(unsigned reducedRate, unsigned oversampling);
+        const GdTapFx &getFullRateFx(unsigned oversampling) const;
         void setSampleRate(float sampleRate);
         void setBufferSize(unsigned bufferSize);
+        void copyFxState(const TapDsp &other);
+        template <class Archive> void archiveState(Archive &archive);
+
+        // the effects of a tap in all the channels, which share the updates
+        // of the controls; at the full rate, they are oversampled if requested
+        static void processFx(TapDsp *const taps[], unsigned numTaps, unsigned reducedRate, unsigned oversampling, float *const frames[], GdTapFx::Control control, unsigned index, unsigned count, unsigned firstUpdate, float *const reducedFrames[][kMaxReducedRate], float *const oversampledFrames[][kMaxOversampling]);
+        // runs the effects over the history of the line, from the given lag
+        // behind the frame which is written next, for some of its frames
+        static void warmUpFx(TapDsp *const taps[], unsigned numTaps, unsigned reducedRate, unsigned oversampling, float delay, unsigned lag, unsigned count, GdTapFx::Control control, float *const frames[], float *delays, float *const reducedFrames[][kMaxReducedRate], float *const oversampledFrames[][kMaxOversampling]);
 
         // parts
         GdLine line_;
         GdTapFx fx_;
+        ReducedRateDsp reduced_[kMaxReducedRate];
+        OversampledDsp oversampled_[kMaxOversampling];
+    };
+
+    // the maximum number of groups of taps which share their effects
+    enum { kMaxFxGroups = 4 };
+
+    // the effects run once for a group, followed by a line with many heads
+    struct FxGroupDsp {
+        FxGroupDsp();
+        void clear();
+        void setSampleRate(float sampleRate);
+        void setBufferSize(unsigned bufferSize);
+        void copyFxState(const FxGroupDsp &other);
+        template <class Archive> void archiveState(Archive &archive);
+
+        // parts
+        GdTapFx fx_;
+        GdLine line_;
+        // the line index at the start of the current block
+        unsigned lineIndex_ = 0;
     };
 
     struct ChannelDsp {
         void clear();
         void setSampleRate(float sampleRate);
         void setBufferSize(unsigned bufferSize);
+        template <class Archive> void archiveState(Archive &archive);
 
         // internal
         float feedback_ = 0;
 
         // taps
         TapDsp taps_[GdMaxLines];
+
+        // shared effects
+        FxGroupDsp fxGroups_[kMaxFxGroups];
     };
 
     // channels
-    std::vector<ChannelDsp> channels_;
+    ChannelMode channelMode_ = Mono;
+    PoolVector<ChannelDsp> channels_;
+    // number of channels which go in pairs of left and right, at the start
+    unsigned numPairs_ = 0;
+
+    // a stereo network runs only the first channel while both channels of
+    // the input are the same, and the other channel only follows its lines
+    bool isMono_ = false;
+    // number of frames for which the input was the same in both channels
+    unsigned monoFrames_ = 0;
+    // number of frames for which the feedback was the same in both channels
+    unsigned monoFeedbackFrames_ = 0;
+
+    // the taps run while the wet is off
+    bool keepWarm_ = false;
 
     // timing information
+    float sampleRate_ = 0;
+    unsigned bufferSize_ = 0;
     float bpm_ = 120.0f;
 
     // parameters + smoothers
     bool sync_ = false;
     int div_ = GdDefaultDivisor;
     float swing_ = 0.5f;
+    unsigned oversampling_ = 0;
     bool fbEnable_ = false;
     unsigned fbTapIndex_ = 0;
     float fbTapGainDB_ = GdMinFeedbackGainDB;
@@ -96,6 +247,7 @@ private:
         TapControl();
         void clear();
         void setSampleRate(float sampleRate);
+        template <class Archive> void archiveState(Archive &archive);
 
         // parameters
         bool enable_ = false;
@@ -107,6 +259,7 @@ private:
         float lpfCutoff_ = 0;
         float hpfCutoff_ = 0;
         float resonanceDB_ = 0;
+        bool analog_ = false;
         bool shiftEnable_ = false;
         float shift_ = 0;
         float pan_ = 0;
@@ -123,15 +276,120 @@ private:
         LinearSmoother smoothWidth_;
         enum { kNumSmoothers = 8 };
         std::array<LinearSmoother *, kNumSmoothers> getSmoothers();
+        // sharing of effects
+        int fxGroup_ = -1;
+        float fxGroupWeight_ = 0;
+        float fxGroupStep_ = 0;
+        unsigned fxGroupEligibleFrames_ = 0;
+        // processing of the own effects at a reduced rate
+        unsigned reducedRate_ = 0;
+        unsigned nextReducedRate_ = 0;
+        float reducedRateWeight_ = 0;
+        float reducedRateStep_ = 0;
+        // the effects did not run in the last block, since the tap was silent
+        bool isSilent_ = false;
+        // the frames by which the effects of a silent tap are behind its
+        // line, while they warm up to be heard again; 0 if not warming up
+        unsigned warmUpLag_ = 0;
     };
 
     TapControl tapControls_[GdMaxLines];
+
+    // settings of the effects which are identical in every member of a group
+    struct FxGroupKey {
+        int filter = GdFilterOff;
+        float lpfCutoff = 0;
+        float hpfCutoff = 0;
+        float resonance = 0;
+        bool operator==(const FxGroupKey &other) const;
+    };
+
+    struct FxGroupControl {
+        template <class Archive> void archiveState(Archive &archive);
+
+        bool inUse_ = false;
+        FxGroupKey key_;
+        // number of frames which went in the line since the group started
+        unsigned warmFrames_ = 0;
+    };
+
+    FxGroupControl fxGroupControls_[kMaxFxGroups];
 #if GD_SHIFTER_CAN_REPORT_LATENCY
     LinearSmoother smoothTapLatency_[GdMaxLines];
 #endif
 
     // internal
-    enum { kNumTempBuffers = 16 };
-    using TempBuffer = std::vector<float, jsl::aligned_allocator<float, 32>>;
-    std::array<TempBuffer, kNumTempBuffers> temp_;
+    // number of frames which an ordinary tap pushes at once through its stages
+    enum { kTileSize = 64 };
+    static_assert(kTileSize % GdTapFx::kControlUpdateInterval == 0, "the tile size must be a multiple of the control interval");
+
+    // the number of ordinary taps which run their filters together in the bank
+    enum { kMaxBankTaps = 8 };
+    GdFilterBank filterBank_;
+
+    // the largest block which spreads the control work over successive calls
+    enum { kSmallBlockSize = 32 };
+    static_assert((int)kSmallBlockSize <= (int)kTileSize, "a small block must fit in a tile");
+
+    // position in the control interval, at the start of the next small block
+    unsigned controlPhase_ = 0;
+    // frames since the last update of the groups and the rates
+    unsigned bookkeepingFrames_ = 0;
+    unsigned bookkeepingFbTapIndex_ = ~0u;
+
+    // the oversampled effects delay the taps, so the dry signal and the
+    // feedback tap, which runs at the sample rate, are delayed by as much
+    unsigned latencyFrames_ = 0;
+    PoolVector<GdLine> latencyLines_;
+    // the same for the direct output of the feedback tap
+    PoolVector<GdLine> directLatencyLines_;
+
+    struct TempBuffers {
+        float *delays = nullptr;
+        float *feedbackGain = nullptr;
+        float *level = nullptr;
+        float *pan = nullptr;
+        float *width = nullptr;
+        float *feedbackTapOutputs[GdMaxChannels] {};
+        float *ordinaryTapOutputs[GdMaxChannels] {};
+        float *inputAndFeedbackSums[GdMaxChannels] {};
+        float *sharedTapOutputs[GdMaxChannels] {};
+        float *sharedFxWeights = nullptr;
+        float *sharedFxShift = nullptr;
+        float *reducedRateDelays[2] {};
+        float *reducedRateTapOutputs[GdMaxChannels] {};
+        float *reducedRateWeights = nullptr;
+        float *reducedRateFrames[GdMaxChannels][kMaxReducedRate] {};
+        float *oversampledFrames[GdMaxChannels][kMaxOversampling] {};
+        float *latencyDelays = nullptr;
+        float *lpfCutoff = nullptr;
+        float *hpfCutoff = nullptr;
+        float *resonance = nullptr;
+        float *shift = nullptr;
+        float *warmUpLpfCutoff = nullptr;
+        float *warmUpHpfCutoff = nullptr;
+        float *warmUpResonance = nullptr;
+        float *warmUpShift = nullptr;
+        // the controls and the outputs of the taps in the filter bank
+        float *bankDelays[kMaxBankTaps] {};
+        float *bankLevel[kMaxBankTaps] {};
+        float *bankPan[kMaxBankTaps] {};
+        float *bankWidth[kMaxBankTaps] {};
+        float *bankLpfCutoff[kMaxBankTaps] {};
+        float *bankHpfCutoff[kMaxBankTaps] {};
+        float *bankResonance[kMaxBankTaps] {};
+        float *bankShift[kMaxBankTaps] {};
+        float *bankTapOutputs[GdFilterBank::kNumLanes] {};
+#if GD_SHIFTER_CAN_REPORT_LATENCY
+        float *latency = nullptr;
+#endif
+    };
+
+    // lays out the temporary buffers of the processing, either in the arena,
+    // or in a `ScratchArena::Layout` which determines the size of the arena
+    template <class Allocator> static TempBuffers allocateTempBuffers(Allocator &allocator, unsigned numChannels, unsigned count);
+    // the number of taps in the bank at once, which have all their channels in it
+    static unsigned getMaxBankTaps(unsigned numChannels);
+
+    ScratchArena arena_;
 };
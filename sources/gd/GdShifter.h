@@ -35,3 +35,6 @@
 #if !defined(GD_SHIFTER_CAN_REPORT_LATENCY)
 #   error Must define GD_SHIFTER_CAN_REPORT_LATENCY
 #endif
+#if !defined(GD_SHIFTER_CAN_COPY_STATE)
+#   error Must define GD_SHIFTER_CAN_COPY_STATE
+#endif
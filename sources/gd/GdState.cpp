@@ -0,0 +1,147 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#include "GdState.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// the shortest run of zeros which is stored as its length only
+static constexpr size_t kMinSilentRun = 8;
+
+// every run of frames starts with its length, shifted by 1, and the lowest
+// bit is set if the run is silent
+static constexpr uint32_t kSilentRunFlag = 1;
+static constexpr size_t kMaxRunLength = UINT32_MAX >> 1;
+
+GdStateWriter::GdStateWriter(void *data, size_t capacity, bool compress)
+    : data_((uint8_t *)data), capacity_(data ? capacity : 0), compress_(compress)
+{
+}
+
+void GdStateWriter::write(const void *data, size_t size)
+{
+    if (size_ + size <= capacity_)
+        std::memcpy(data_ + size_, data, size);
+    size_ += size;
+}
+
+void GdStateWriter::frames(float *frames, size_t count)
+{
+    uint64_t storedCount = count;
+    value(storedCount);
+    uint8_t compress = compress_;
+    value(compress);
+
+    if (!compress) {
+        write(frames, count * sizeof(float));
+        return;
+    }
+
+    auto silentRunLength = [frames, count](size_t start) -> size_t {
+        size_t end = start;
+        while (end < count && end - start < kMaxRunLength && frames[end] == 0.0f && !std::signbit(frames[end]))
+            ++end;
+        return end - start;
+    };
+
+    size_t i = 0;
+    while (i < count) {
+        size_t silentLength = silentRunLength(i);
+        if (silentLength >= kMinSilentRun || i + silentLength == count) {
+            uint32_t header = (uint32_t)(silentLength << 1) | kSilentRunFlag;
+            value(header);
+            i += silentLength;
+            continue;
+        }
+
+        // the frames until the next run of silence which is long enough
+        size_t end = i + std::max<size_t>(silentLength, 1);
+        while (end < count && end - i < kMaxRunLength) {
+            size_t length = silentRunLength(end);
+            if (length >= kMinSilentRun || end + length == count)
+                break;
+            end += std::max<size_t>(length, 1);
+        }
+        end = std::min(end, i + kMaxRunLength);
+
+        uint32_t header = (uint32_t)((end - i) << 1);
+        value(header);
+        write(frames + i, (end - i) * sizeof(float));
+        i = end;
+    }
+}
+
+//==============================================================================
+GdStateReader::GdStateReader(const void *data, size_t size)
+    : data_((const uint8_t *)data), size_(data ? size : 0)
+{
+}
+
+void GdStateReader::read(void *data, size_t size)
+{
+    if (!valid_ || size > size_ - position_) {
+        valid_ = false;
+        std::memset(data, 0, size);
+        return;
+    }
+    std::memcpy(data, data_ + position_, size);
+    position_ += size;
+}
+
+void GdStateReader::frames(float *frames, size_t count)
+{
+    uint64_t storedCount = 0;
+    value(storedCount);
+    uint8_t compress = 0;
+    value(compress);
+
+    // the arrays have the sizes which the same configuration allocates
+    if (storedCount != count)
+        valid_ = false;
+    if (!valid_) {
+        std::fill_n(frames, count, 0.0f);
+        return;
+    }
+
+    if (!compress) {
+        read(frames, count * sizeof(float));
+        return;
+    }
+
+    size_t i = 0;
+    while (valid_ && i < count) {
+        uint32_t header = 0;
+        value(header);
+        size_t length = header >> 1;
+        if (length > count - i || length == 0) {
+            valid_ = false;
+            break;
+        }
+        if (header & kSilentRunFlag)
+            std::fill_n(frames + i, length, 0.0f);
+        else
+            read(frames + i, length * sizeof(float));
+        i += length;
+    }
+
+    if (!valid_)
+        std::fill_n(frames, count, 0.0f);
+}
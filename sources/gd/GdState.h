@@ -0,0 +1,108 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+
+#pragma once
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Writes the state of the processing in a binary form
+ *
+ * The values are stored as they are in memory, so a state only loads on the
+ * same platform. With compression, the silent runs of the arrays of frames
+ * are stored as their length only.
+ *
+ * The parts of the processing write and read their state with the same
+ * function, `archiveState`, which receives either a writer or a reader.
+ */
+class GdStateWriter {
+public:
+    static constexpr bool isLoading = false;
+
+    // it writes at most `capacity` bytes in `data`, which can be null
+    GdStateWriter(void *data, size_t capacity, bool compress);
+    // the size of the whole state, which is greater than the capacity if it
+    // did not fit
+    size_t getSize() const { return size_; }
+
+    template <class T> void value(T &value);
+    void frames(float *frames, size_t count);
+    void check(bool condition) { (void)condition; }
+
+private:
+    void write(const void *data, size_t size);
+
+private:
+    uint8_t *data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t size_ = 0;
+    bool compress_ = false;
+};
+
+/**
+ * @brief Reads the state of the processing which a writer has written
+ */
+class GdStateReader {
+public:
+    static constexpr bool isLoading = true;
+
+    GdStateReader(const void *data, size_t size);
+    // whether everything was read from the data, with the expected sizes
+    bool isValid() const { return valid_; }
+    // whether the data was read up to its end
+    bool isAtEnd() const { return position_ == size_; }
+
+    template <class T> void value(T &value);
+    void frames(float *frames, size_t count);
+    // invalidates the state if a value read is out of its range
+    void check(bool condition) { valid_ = valid_ && condition; }
+
+private:
+    void read(void *data, size_t size);
+
+private:
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+    size_t position_ = 0;
+    bool valid_ = true;
+};
+
+//==============================================================================
+template <class T> inline void GdStateWriter::value(T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "the value must be trivially copyable");
+    write(&value, sizeof(T));
+}
+
+template <class T> inline void GdStateReader::value(T &value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "the value must be trivially copyable");
+    read(&value, sizeof(T));
+}
+
+// a boolean is read as a byte, which only has 2 valid values
+template <> inline void GdStateReader::value(bool &value)
+{
+    uint8_t byte = 0;
+    read(&byte, sizeof(byte));
+    check(byte <= 1);
+    value = byte == 1;
+}
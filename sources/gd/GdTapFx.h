@@ -21,7 +21,9 @@
 #include "GdFilter.h"
 #include "GdShifter.h"
 #include "GdDefs.h"
+#include "GdDenormals.h"
 #include "filters/GdFilterAA.h"
+#include <algorithm>
 #include <cstdio>
 
 #define GD_SHIFTER_USES_AA_FILTER 1
@@ -35,17 +37,31 @@ public:
     void clear();
     void setSampleRate(float sampleRate);
     void setBufferSize(unsigned bufferSize);
+    void copyState(const GdTapFx &other);
     void performKRateUpdates(Control control, unsigned index);
+    void followKRateUpdates(const GdTapFx &leader, Control control, unsigned index);
     void process(const float *input, float *output, Control control, unsigned count);
+    // runs the stages which follow the filters, for a filter bank which has
+    // already run these
+    void processShifter(const float *input, float *output, Control control, unsigned count);
     float processOne(float input, Control control, unsigned index);
     float getLatency() const;
+    template <class Archive> void archiveState(Archive &archive);
 
     struct Control {
         int filter = GdFilterOff;
+        // the filters saturate in their recursions
+        bool analog = false;
         float *lpfCutoff = nullptr;
         float *hpfCutoff = nullptr;
         float *resonance = nullptr;
         float *shift = nullptr;
+        // the controls keep the same values over the block, so the
+        // coefficients need only an update at the start
+        bool isConstant = false;
+        // the frames from an update to the next, at the rate of the effects,
+        // over which the filters which move at every frame glide
+        unsigned updateInterval = kControlUpdateInterval;
     };
 
     GdFilter lpf_;
@@ -54,6 +70,21 @@ public:
     GdFilterAA shifterAA_;
 #endif
     GdShifter shifter_;
+
+private:
+    // the stages which are not a pass-through, which the chain runs; they
+    // change only with the updates of the controls, and the chain has a
+    // kernel for every combination, where the others cost nothing
+    enum {
+        kStageFilters = 1 << 0,
+        kStageShifterAA = 1 << 1,
+        kStageShifter = 1 << 2,
+        kAllStages = kStageFilters | kStageShifterAA | kStageShifter,
+    };
+    unsigned stages_ = kAllStages;
+    void updateStages();
+    void processStages(const float *input, float *output, Control control, unsigned count, unsigned stages);
+    template <unsigned Stages> void processChain(const float *input, float *output, Control control, unsigned count);
 };
 
 //==============================================================================
@@ -65,6 +96,7 @@ inline void GdTapFx::clear()
     shifterAA_.clear();
 #endif
     shifter_.clear();
+    updateStages();
 }
 
 inline void GdTapFx::setSampleRate(float sampleRate)
@@ -83,6 +115,19 @@ inline void GdTapFx::setBufferSize(unsigned bufferSize)
     shifter_.setBufferSize(bufferSize);
 }
 
+inline void GdTapFx::copyState(const GdTapFx &other)
+{
+    lpf_ = other.lpf_;
+    hpf_ = other.hpf_;
+#if GD_SHIFTER_USES_AA_FILTER
+    shifterAA_ = other.shifterAA_;
+#endif
+#if GD_SHIFTER_CAN_COPY_STATE
+    shifter_.copyState(other.shifter_);
+#endif
+    updateStages();
+}
+
 inline void GdTapFx::performKRateUpdates(Control control, unsigned index)
 {
     {
@@ -104,6 +149,10 @@ inline void GdTapFx::performKRateUpdates(Control control, unsigned index)
             filter[0] = GdFilter::kFilterLPF12;
             filter[1] = GdFilter::kFilterHPF12;
             break;
+        case GdFilter12dBSVF:
+            filter[0] = GdFilter::kFilterLPF12SVF;
+            filter[1] = GdFilter::kFilterHPF12SVF;
+            break;
         }
         cutoff[0] = control.lpfCutoff[index];
         cutoff[1] = control.hpfCutoff[index];
@@ -112,11 +161,16 @@ inline void GdTapFx::performKRateUpdates(Control control, unsigned index)
         for (unsigned i = 0; i < 2; ++i) {
             GdFilter &f = *filters[i];
             bool mustUpdate = false;
+            // a new filter starts at its controls, a filter which continues
+            // moves to them
+            bool mustGlide = true;
             if (f.getFilterType() != filter[i]) {
                 f.setFilterType(filter[i]);
                 f.clear();
                 mustUpdate = true;
+                mustGlide = false;
             }
+            f.setAnalog(control.analog);
             if (f.getCutoff() != cutoff[i]) {
                 f.setCutoff(cutoff[i]);
                 mustUpdate = true;
@@ -125,8 +179,12 @@ inline void GdTapFx::performKRateUpdates(Control control, unsigned index)
                 f.setResonance(resonance);
                 mustUpdate = true;
             }
-            if (mustUpdate)
-                f.updateCoeffs();
+            if (mustUpdate) {
+                if (mustGlide)
+                    f.glideCoeffs(control.updateInterval);
+                else
+                    f.updateCoeffs();
+            }
         }
     }
 
@@ -143,82 +201,187 @@ inline void GdTapFx::performKRateUpdates(Control control, unsigned index)
         shifter.setShift(control.shift[index]);
     }
 #endif
+
+    updateStages();
 }
 
-inline void GdTapFx::process(const float *input, float *output, Control control, unsigned count)
+inline void GdTapFx::followKRateUpdates(const GdTapFx &leader, Control control, unsigned index)
 {
+    // the leader has updated with the same controls, so reuse its coefficients
+    lpf_.copyCoeffs(leader.lpf_);
+    hpf_.copyCoeffs(leader.hpf_);
+
+#if GD_SHIFTER_USES_AA_FILTER
+    {
+        GdFilterAA &shifterAA = shifterAA_;
+        shifterAA.setCutoff(shifterAA.getSampleRate() / (2 * control.shift[index]));
+    }
+#endif
+
+#if GD_SHIFTER_UPDATES_AT_K_RATE
     {
+        GdShifter &shifter = shifter_;
+        shifter.setShift(control.shift[index]);
+    }
+#endif
+
+    updateStages();
+}
+
+inline void GdTapFx::updateStages()
+{
+    unsigned stages = 0;
+
+    bool filtersOff = lpf_.getFilterType() == GdFilter::kFilterOff &&
+        hpf_.getFilterType() == GdFilter::kFilterOff;
+    if (!filtersOff)
+        stages |= kStageFilters;
+
+#if GD_SHIFTER_USES_AA_FILTER
+    if (!shifterAA_.isPassThrough())
+        stages |= kStageShifterAA;
+#endif
+
+    if (!shifter_.isPassThrough())
+        stages |= kStageShifter;
+
+    stages_ = stages;
+}
+
+inline void GdTapFx::process(const float *input, float *output, Control control, unsigned count)
+{
+    processStages(input, output, control, count, stages_);
+}
+
+inline void GdTapFx::processShifter(const float *input, float *output, Control control, unsigned count)
+{
+    processStages(input, output, control, count, stages_ & ~kStageFilters);
+}
+
+inline void GdTapFx::processStages(const float *input, float *output, Control control, unsigned count, unsigned stages)
+{
+    switch (stages) {
+    case 0:
+        processChain<0>(input, output, control, count);
+        break;
+    case kStageFilters:
+        processChain<kStageFilters>(input, output, control, count);
+        break;
+    case kStageShifterAA:
+        processChain<kStageShifterAA>(input, output, control, count);
+        break;
+    case kStageFilters | kStageShifterAA:
+        processChain<kStageFilters | kStageShifterAA>(input, output, control, count);
+        break;
+    case kStageShifter:
+        processChain<kStageShifter>(input, output, control, count);
+        break;
+    case kStageFilters | kStageShifter:
+        processChain<kStageFilters | kStageShifter>(input, output, control, count);
+        break;
+    case kStageShifterAA | kStageShifter:
+        processChain<kStageShifterAA | kStageShifter>(input, output, control, count);
+        break;
+    default:
+        processChain<kAllStages>(input, output, control, count);
+        break;
+    }
+}
+
+template <unsigned Stages> inline void GdTapFx::processChain(const float *input, float *output, Control control, unsigned count)
+{
+    (void)control;
+
+    if (Stages & kStageFilters) {
+        GD_COUNT_DENORMALS(GdDenormalsInFilters);
         GdFilter &lpf = lpf_;
         lpf.process(input, output, count);
-    }
 
-    input = output;
+        input = output;
 
-    {
         GdFilter &hpf = hpf_;
         hpf.process(input, output, count);
-    }
 
-    input = output;
+        input = output;
+    }
 
 #if GD_SHIFTER_USES_AA_FILTER
-    {
+    if (Stages & kStageShifterAA) {
+        GD_COUNT_DENORMALS(GdDenormalsInShifterAA);
         GdFilterAA &shifterAA = shifterAA_;
         shifterAA.process(input, output, count);
-    }
 
-    input = output;
+        input = output;
+    }
 #endif
 
-    {
+    if (Stages & kStageShifter) {
+        GD_COUNT_DENORMALS(GdDenormalsInShifter);
         GdShifter &shifter = shifter_;
 #if GD_SHIFTER_UPDATES_AT_K_RATE
         shifter.process(input, output, count);
 #else
         shifter.process(input, output, control.shift, count);
 #endif
+
+        input = output;
     }
+
+    if (input != output)
+        std::copy_n(input, count, output);
 }
 
 inline float GdTapFx::processOne(float input, Control control, unsigned index)
 {
-    float output;
+    float output = input;
+    unsigned stages = stages_;
 
-    {
+    if (stages & kStageFilters) {
         GdFilter &lpf = lpf_;
-        output = lpf.processOne(input);
-    }
+        output = lpf.processOne(output);
 
-    input = output;
-
-    {
         GdFilter &hpf = hpf_;
-        output = hpf.processOne(input);
+        output = hpf.processOne(output);
     }
 
-    input = output;
-
 #if GD_SHIFTER_USES_AA_FILTER
-    {
+    if (stages & kStageShifterAA) {
         GdFilterAA &shifterAA = shifterAA_;
-        output = shifterAA.processOne(input);
+        output = shifterAA.processOne(output);
     }
-
-    input = output;
 #endif
 
-    {
+    if (stages & kStageShifter) {
         GdShifter &shifter = shifter_;
 #if GD_SHIFTER_UPDATES_AT_K_RATE
-        output = shifter.processOne(input);
+        output = shifter.processOne(output);
 #else
-        output = shifter.processOne(input, control.shift[index]);
+        output = shifter.processOne(output, control.shift[index]);
 #endif
     }
 
     return output;
 }
 
+template <class Archive> inline void GdTapFx::archiveState(Archive &archive)
+{
+    lpf_.archiveState(archive);
+    hpf_.archiveState(archive);
+#if GD_SHIFTER_USES_AA_FILTER
+    shifterAA_.archiveState(archive);
+#endif
+#if GD_SHIFTER_CAN_COPY_STATE
+    shifter_.archiveState(archive);
+#else
+    // the shifter restarts, if its state is not accessible
+    if (Archive::isLoading)
+        shifter_.clear();
+#endif
+
+    if (Archive::isLoading)
+        updateStages();
+}
+
 inline float GdTapFx::getLatency() const
 {
     float latency;
@@ -18,7 +18,14 @@
  */
 
 #include "GdFilterAA.h"
+#include <simde/x86/sse2.h>
 #include <array>
+#include <algorithm>
+#include <cmath>
+
+// below this count of frames, filling and draining the pipeline of the
+// sections costs more than it saves, so they run one after the other
+static constexpr unsigned kMinPipelinedCount = 8;
 
 const float *GdFilterAA::neutralCoeffs_ = []() -> const float * {
     static std::array<float, 5 * NS + 1> coeffs;
@@ -31,6 +38,67 @@ const float *GdFilterAA::neutralCoeffs_ = []() -> const float * {
     return coeffs.data();
 }();
 
+namespace {
+// a filter of the table, with its sections as the angles of their zeros,
+// which the elliptic design puts on the unit circle, and the radii and the
+// angles of their poles; interpolated in this form, the poles and the zeros
+// follow their arcs, much closer to the designs in between than the raw
+// coefficients would, and the poles stay inside the unit circle
+struct PolarFilter {
+    float zeroAngle[GdFilterDataAA::NS];
+    float zeroCos[GdFilterDataAA::NS];
+    float zeroSin[GdFilterDataAA::NS];
+    float poleRadius[GdFilterDataAA::NS];
+    float poleAngle[GdFilterDataAA::NS];
+    float poleCos[GdFilterDataAA::NS];
+    float poleSin[GdFilterDataAA::NS];
+    float dcGain;
+};
+} // namespace
+
+static const PolarFilter *const polarFilters = []() -> const PolarFilter * {
+    using namespace GdFilterDataAA;
+    static std::array<PolarFilter, NF> table;
+    for (unsigned nthFilter = 0; nthFilter < NF; ++nthFilter) {
+        const float *ba = BA + nthFilter * (5 * NS + 1);
+        PolarFilter &filter = table[nthFilter];
+        double dcGain = ba[5 * NS];
+        for (unsigned nthSection = 0; nthSection < NS; ++nthSection) {
+            const float *sc = ba + 5 * nthSection;
+            double b0 = sc[0], b1 = sc[1], b2 = sc[2];
+            double a1 = sc[3], a2 = sc[4];
+            double poleRadius = std::sqrt(a2);
+            double zeroAngle = std::acos(-0.5 * b1 / b0);
+            double poleAngle = std::acos(-0.5 * a1 / poleRadius);
+            filter.zeroAngle[nthSection] = (float)zeroAngle;
+            filter.zeroCos[nthSection] = (float)std::cos(zeroAngle);
+            filter.zeroSin[nthSection] = (float)std::sin(zeroAngle);
+            filter.poleRadius[nthSection] = (float)poleRadius;
+            filter.poleAngle[nthSection] = (float)poleAngle;
+            filter.poleCos[nthSection] = (float)std::cos(poleAngle);
+            filter.poleSin[nthSection] = (float)std::sin(poleAngle);
+            dcGain *= (b0 + b1 + b2) / (1 + a1 + a2);
+        }
+        filter.dcGain = (float)dcGain;
+    }
+    return table.data();
+}();
+
+// the cosine of an angle after a rotation, which is small between adjacent
+// filters of the table (< 0.05 rad), so that short series are exact in float
+static inline float cosAfterRotation(float cosAngle, float sinAngle, float rotation)
+{
+    float x2 = rotation * rotation;
+    float cosRotation = 1 - x2 * (0.5f - x2 * (1.0f / 24));
+    float sinRotation = rotation * (1 - x2 * (1.0f / 6));
+    return cosAngle * cosRotation - sinAngle * sinRotation;
+}
+
+GdFilterAA::GdFilterAA()
+{
+    updateCoeffs();
+}
+
 
 void GdFilterAA::setSampleRate(float newSampleRate)
 {
@@ -53,57 +121,142 @@ void GdFilterAA::setCutoff(float newCutoff)
 void GdFilterAA::updateCoeffs()
 {
     float F = cutoff_ / sampleRate_;
-    if (F >= 0.5f) {
-        coeffs_ = neutralCoeffs_;
+    neutral_ = F >= 0.5f;
+    if (neutral_) {
+        std::memcpy(coeffs_, neutralCoeffs_, (5 * NS + 1) * sizeof(float));
+        return;
     }
-    else {
-        int index = (int)(0.5f + (NF - 1) * ((F - F0) / (F1 - F0)));
-        index = (index < 0) ? 0 : index;
-        index = (index > NF - 1) ? (NF - 1) : index;
-        coeffs_ = GdFilterDataAA::BA + (unsigned)index * (5 * NS + 1);
+
+    // the position between the filters of the table, saturated at the ends
+    float position = (NF - 1) * ((F - F0) / (F1 - F0));
+    position = (position > 0) ? position : 0;
+    unsigned index = std::min((unsigned)position, NF - 2);
+    float mu = std::min(position - (float)index, 1.0f);
+
+    const PolarFilter &f1 = polarFilters[index];
+    const PolarFilter &f2 = polarFilters[index + 1];
+
+    // the sections side by side, for the vectorizer
+    float b1[NS], a1[NS], a2[NS];
+    for (unsigned s = 0; s < NS; ++s) {
+        float zeroCos = cosAfterRotation(f1.zeroCos[s], f1.zeroSin[s], mu * (f2.zeroAngle[s] - f1.zeroAngle[s]));
+        float poleCos = cosAfterRotation(f1.poleCos[s], f1.poleSin[s], mu * (f2.poleAngle[s] - f1.poleAngle[s]));
+        float poleRadius = f1.poleRadius[s] + mu * (f2.poleRadius[s] - f1.poleRadius[s]);
+        b1[s] = -2 * zeroCos;
+        a1[s] = -2 * poleRadius * poleCos;
+        a2[s] = poleRadius * poleRadius;
     }
+
+    // the gain of the sections at DC, as a fraction
+    float dcNumerator = 1;
+    float dcDenominator = 1;
+
+    float *cptr = coeffs_;
+    for (unsigned nthSection = 0; nthSection < NS; ++nthSection) {
+        *cptr++ = 1.0f; *cptr++ = b1[nthSection]; *cptr++ = 1.0f;
+        *cptr++ = a1[nthSection]; *cptr++ = a2[nthSection];
+        dcNumerator *= 2 + b1[nthSection];
+        dcDenominator *= 1 + a1[nthSection] + a2[nthSection];
+    }
+
+    // the gain which keeps the level of the pass band
+    float dcGain = f1.dcGain + mu * (f2.dcGain - f1.dcGain);
+    *cptr++ = dcGain * dcDenominator / dcNumerator;
+}
+
+namespace {
+// the sections in the lanes of vectors, with their coefficients and states
+struct PipelinedSections {
+    simde__m128 b0, b1, b2, a1, a2;
+    simde__m128 s1, s2;
+    simde__m128 out;
+};
+} // namespace
+
+// at a step, the input of the first section is the new frame, and that of
+// the others is the output of their predecessor at the step before
+static inline void stepSections(PipelinedSections &p, float frame)
+{
+    simde__m128 in = simde_mm_move_ss(
+        simde_mm_shuffle_ps(p.out, p.out, SIMDE_MM_SHUFFLE(2, 1, 0, 0)),
+        simde_mm_set_ss(frame));
+    p.out = simde_mm_add_ps(p.s1, simde_mm_mul_ps(p.b0, in));
+    p.s1 = simde_mm_sub_ps(simde_mm_add_ps(p.s2, simde_mm_mul_ps(p.b1, in)), simde_mm_mul_ps(p.a1, p.out));
+    p.s2 = simde_mm_sub_ps(simde_mm_mul_ps(p.b2, in), simde_mm_mul_ps(p.a2, p.out));
+}
+
+// at the first and the last steps, the sections which have no frame to
+// compute keep their state
+static inline void stepSomeSections(PipelinedSections &p, float frame, simde__m128 active)
+{
+    simde__m128 s1 = p.s1;
+    simde__m128 s2 = p.s2;
+    stepSections(p, frame);
+    p.s1 = simde_mm_or_ps(simde_mm_and_ps(active, p.s1), simde_mm_andnot_ps(active, s1));
+    p.s2 = simde_mm_or_ps(simde_mm_and_ps(active, p.s2), simde_mm_andnot_ps(active, s2));
+}
+
+static inline simde__m128 sectionMask(bool s0, bool s1, bool s2, bool s3)
+{
+    return simde_mm_castsi128_ps(simde_mm_setr_epi32(-(int)s0, -(int)s1, -(int)s2, -(int)s3));
+}
+
+static inline float lastSectionOutput(const PipelinedSections &p)
+{
+    return simde_mm_cvtss_f32(simde_mm_shuffle_ps(p.out, p.out, SIMDE_MM_SHUFFLE(3, 3, 3, 3)));
 }
 
 void GdFilterAA::process(const float *input, float *output, unsigned count)
 {
-    // compute sections except last
-    for (unsigned nthSection = 0; nthSection < NS - 1; ++nthSection) {
-        Section sec = sec_[nthSection];
-        const float *sc = coeffs_ + 5 * nthSection;
-
-        float b0 = sc[0], b1 = sc[1], b2 = sc[2];
-        float a1 = sc[3], a2 = sc[4];
-
-        for (unsigned i = 0; i < count; ++i) {
-            float in = input[i];
-            float out = sec.s1 + b0 * in;
-            sec.s1 = sec.s2 + b1 * in - a1 * out;
-            sec.s2 = b2 * in - a2 * out;
-            output[i] = out;
-        }
+    // the sections run in the lanes of a vector, each a frame behind the one
+    // before, so they all advance at once: at step n, the section s computes
+    // the frame n - s; the operations are in the same order as in `processOne`
+    static_assert(NS == 4, "the sections must fill a vector");
 
-        sec_[nthSection] = sec;
-        input = output;
+    if (count < kMinPipelinedCount) {
+        for (unsigned i = 0; i < count; ++i)
+            output[i] = processOne(input[i]);
+        return;
     }
 
-    // compute final section with gain
-    {
-        unsigned nthSection = NS - 1;
-        Section sec = sec_[nthSection];
-        const float *sc = coeffs_ + 5 * nthSection;
-
-        float b0 = sc[0], b1 = sc[1], b2 = sc[2];
-        float a1 = sc[3], a2 = sc[4], k = sc[5];
-
-        for (unsigned i = 0; i < count; ++i) {
-            float in = input[i];
-            float out = sec.s1 + b0 * in;
-            sec.s1 = sec.s2 + b1 * in - a1 * out;
-            sec.s2 = b2 * in - a2 * out;
-            output[i] = k * out;
-        }
+    const float *sc = coeffs_;
+    const float k = sc[5 * NS];
+
+    PipelinedSections p;
+    p.b0 = simde_mm_setr_ps(sc[0], sc[5], sc[10], sc[15]);
+    p.b1 = simde_mm_setr_ps(sc[1], sc[6], sc[11], sc[16]);
+    p.b2 = simde_mm_setr_ps(sc[2], sc[7], sc[12], sc[17]);
+    p.a1 = simde_mm_setr_ps(sc[3], sc[8], sc[13], sc[18]);
+    p.a2 = simde_mm_setr_ps(sc[4], sc[9], sc[14], sc[19]);
+    p.s1 = simde_mm_setr_ps(sec_[0].s1, sec_[1].s1, sec_[2].s1, sec_[3].s1);
+    p.s2 = simde_mm_setr_ps(sec_[0].s2, sec_[1].s2, sec_[2].s2, sec_[3].s2);
+    p.out = simde_mm_setzero_ps();
 
-        sec_[nthSection] = sec;
+    // fill: the sections start one after the other
+    stepSomeSections(p, input[0], sectionMask(1, 0, 0, 0));
+    stepSomeSections(p, input[1], sectionMask(1, 1, 0, 0));
+    stepSomeSections(p, input[2], sectionMask(1, 1, 1, 0));
+
+    for (unsigned n = NS - 1; n < count; ++n) {
+        stepSections(p, input[n]);
+        output[n - (NS - 1)] = k * lastSectionOutput(p);
+    }
+
+    // drain: the sections finish one after the other
+    stepSomeSections(p, 0.0f, sectionMask(0, 1, 1, 1));
+    output[count - 3] = k * lastSectionOutput(p);
+    stepSomeSections(p, 0.0f, sectionMask(0, 0, 1, 1));
+    output[count - 2] = k * lastSectionOutput(p);
+    stepSomeSections(p, 0.0f, sectionMask(0, 0, 0, 1));
+    output[count - 1] = k * lastSectionOutput(p);
+
+    alignas(16) float s1Lanes[NS];
+    alignas(16) float s2Lanes[NS];
+    simde_mm_store_ps(s1Lanes, p.s1);
+    simde_mm_store_ps(s2Lanes, p.s2);
+    for (unsigned nthSection = 0; nthSection < NS; ++nthSection) {
+        sec_[nthSection].s1 = s1Lanes[nthSection];
+        sec_[nthSection].s2 = s2Lanes[nthSection];
     }
 }
 
@@ -22,13 +22,18 @@
 
 class GdFilterAA {
 public:
+    GdFilterAA();
     void clear();
     float getSampleRate() const;
     void setSampleRate(float newSampleRate);
     void setCutoff(float newCutoff);
     void updateCoeffs();
+    // whether the output is the input, with neutral coefficients and nothing
+    // left in the sections
+    bool isPassThrough() const;
     void process(const float *input, float *output, unsigned count);
     float processOne(float input);
+    template <class Archive> void archiveState(Archive &archive);
 
 private:
     static constexpr float F0 = GdFilterDataAA::F0;
@@ -41,7 +46,8 @@ private:
 
     float sampleRate_ = 0;
     float cutoff_ = 0;
-    const float *coeffs_ = GdFilterDataAA::BA;
+    bool neutral_ = false;
+    float coeffs_[5 * NS + 1];
 
     static const float *neutralCoeffs_;
 };
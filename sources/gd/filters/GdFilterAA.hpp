@@ -30,6 +30,27 @@ inline float GdFilterAA::getSampleRate() const
     return sampleRate_;
 }
 
+inline bool GdFilterAA::isPassThrough() const
+{
+    if (!neutral_)
+        return false;
+
+    for (unsigned nthSection = 0; nthSection < NS; ++nthSection) {
+        if (sec_[nthSection].s1 != 0 || sec_[nthSection].s2 != 0)
+            return false;
+    }
+
+    return true;
+}
+
+template <class Archive> inline void GdFilterAA::archiveState(Archive &archive)
+{
+    archive.value(sec_);
+    archive.value(cutoff_);
+    if (Archive::isLoading)
+        updateCoeffs();
+}
+
 inline float GdFilterAA::processOne(float input)
 {
     float output = input;
@@ -0,0 +1,211 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "GdFilterBank.h"
+#include "utility/RsqrtNL.h"
+#include <simde/x86/sse.h>
+#include <algorithm>
+#include <cassert>
+
+void GdFilterBank::loadCoeffs(unsigned lane, const GdFilter &lpf, const GdFilter &hpf)
+{
+    const GdFilter *filters[kNumStages] = {&lpf, &hpf};
+
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        Stage &stage = stages_[s];
+        const GdFilter::Coeff1 &c1 = filters[s]->coeff1_;
+        const GdFilter::Coeff2 &c2 = filters[s]->coeff2_;
+        stage.u0[lane] = (float)c1.u0;
+        stage.u1[lane] = (float)c1.u1;
+        stage.v1[lane] = (float)c1.v1;
+        stage.a1[lane] = (float)c2.a1;
+        stage.a2[lane] = (float)c2.a2;
+        stage.a3[lane] = (float)c2.a3;
+        stage.m0[lane] = (float)c2.m0;
+        stage.m1[lane] = (float)c2.m1;
+        stage.m2[lane] = (float)c2.m2;
+        stage.analog[lane] = filters[s]->isAnalog() ? 1.0f : 0.0f;
+    }
+}
+
+void GdFilterBank::loadState(unsigned lane, const GdFilter &lpf, const GdFilter &hpf)
+{
+    const GdFilter *filters[kNumStages] = {&lpf, &hpf};
+
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        Stage &stage = stages_[s];
+        stage.x1[lane] = (float)filters[s]->mem1_.x1;
+        stage.y1[lane] = (float)filters[s]->mem1_.y1;
+        stage.s1[lane] = (float)filters[s]->mem2_.s1;
+        stage.s2[lane] = (float)filters[s]->mem2_.s2;
+    }
+}
+
+void GdFilterBank::storeState(unsigned lane, GdFilter &lpf, GdFilter &hpf) const
+{
+    GdFilter *filters[kNumStages] = {&lpf, &hpf};
+
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        const Stage &stage = stages_[s];
+        filters[s]->mem1_.x1 = stage.x1[lane];
+        filters[s]->mem1_.y1 = stage.y1[lane];
+        filters[s]->mem2_.s1 = stage.s1[lane];
+        filters[s]->mem2_.s2 = stage.s2[lane];
+    }
+}
+
+void GdFilterBank::process(float *const frames[], unsigned numLanes, unsigned count)
+{
+    assert(numLanes <= kNumLanes);
+
+    // the lanes past the last one stay at zero, which their filters keep
+    unsigned numVectors = (numLanes + kLanesPerVector - 1) / kLanesPerVector;
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        Stage &stage = stages_[s];
+        for (unsigned lane = numLanes; lane < numVectors * kLanesPerVector; ++lane)
+            stage.x1[lane] = stage.y1[lane] = stage.s1[lane] = stage.s2[lane] = 0;
+    }
+
+    // the nonlinearity costs nothing unless a lane needs it
+    bool analog = false;
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+            analog = analog || stages_[s].analog[lane] != 0;
+    }
+
+    for (unsigned i = 0; i < count; i += kTileSize) {
+        unsigned tileCount = std::min(count - i, (unsigned)kTileSize);
+        float *tileFrames[kNumLanes];
+        for (unsigned lane = 0; lane < numLanes; ++lane)
+            tileFrames[lane] = frames[lane] + i;
+        if (numVectors == 1) {
+            if (analog)
+                processTile<1, true>(tileFrames, numLanes, tileCount);
+            else
+                processTile<1, false>(tileFrames, numLanes, tileCount);
+        }
+        else {
+            if (analog)
+                processTile<2, true>(tileFrames, numLanes, tileCount);
+            else
+                processTile<2, false>(tileFrames, numLanes, tileCount);
+        }
+    }
+}
+
+// the nonlinearity of `GdFilter`, in the lanes of the mask only
+static inline simde__m128 saturateLanes(simde__m128 x, simde__m128 mask)
+{
+    return simde_mm_or_ps(simde_mm_and_ps(mask, rsqrtNL4(x)), simde_mm_andnot_ps(mask, x));
+}
+
+template <unsigned NumVectors, bool Analog> void GdFilterBank::processTile(float *const frames[], unsigned numLanes, unsigned count)
+{
+    static_assert(NumVectors <= kNumVectors, "the bank has too few lanes");
+    constexpr unsigned stride = NumVectors * kLanesPerVector;
+    float *tile = tile_;
+
+    for (unsigned lane = 0; lane < numLanes; ++lane) {
+        for (unsigned i = 0; i < count; ++i)
+            tile[i * stride + lane] = frames[lane][i];
+    }
+    for (unsigned lane = numLanes; lane < stride; ++lane) {
+        for (unsigned i = 0; i < count; ++i)
+            tile[i * stride + lane] = 0;
+    }
+
+    // the coefficients stay in memory, they are too many for the registers
+    simde__m128 x1[kNumStages][NumVectors];
+    simde__m128 y1[kNumStages][NumVectors];
+    simde__m128 s1[kNumStages][NumVectors];
+    simde__m128 s2[kNumStages][NumVectors];
+    simde__m128 analog[kNumStages][NumVectors];
+
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        for (unsigned v = 0; v < NumVectors; ++v) {
+            unsigned lane = v * kLanesPerVector;
+            analog[s][v] = simde_mm_cmpneq_ps(simde_mm_load_ps(&stages_[s].analog[lane]), simde_mm_setzero_ps());
+            x1[s][v] = simde_mm_load_ps(&stages_[s].x1[lane]);
+            y1[s][v] = simde_mm_load_ps(&stages_[s].y1[lane]);
+            s1[s][v] = simde_mm_load_ps(&stages_[s].s1[lane]);
+            s2[s][v] = simde_mm_load_ps(&stages_[s].s2[lane]);
+        }
+    }
+
+    for (unsigned i = 0; i < count; ++i) {
+        float *frame = &tile[i * stride];
+        for (unsigned v = 0; v < NumVectors; ++v) {
+            unsigned lane = v * kLanesPerVector;
+            simde__m128 x = simde_mm_load_ps(&frame[lane]);
+            for (unsigned s = 0; s < kNumStages; ++s) {
+                const Stage &stage = stages_[s];
+                simde__m128 y;
+
+                // the operations are in the same order as in `GdFilter`
+                simde__m128 r = simde_mm_sub_ps(
+                    simde_mm_mul_ps(simde_mm_load_ps(&stage.u1[lane]), x1[s][v]),
+                    simde_mm_mul_ps(simde_mm_load_ps(&stage.v1[lane]), y1[s][v]));
+                if (Analog)
+                    r = saturateLanes(r, analog[s][v]);
+                y = simde_mm_add_ps(simde_mm_mul_ps(simde_mm_load_ps(&stage.u0[lane]), x), r);
+                x1[s][v] = x;
+                y1[s][v] = y;
+                x = y;
+
+                simde__m128 a2 = simde_mm_load_ps(&stage.a2[lane]);
+                simde__m128 v3 = simde_mm_sub_ps(x, s2[s][v]);
+                simde__m128 v1 = simde_mm_add_ps(
+                    simde_mm_mul_ps(simde_mm_load_ps(&stage.a1[lane]), s1[s][v]),
+                    simde_mm_mul_ps(a2, v3));
+                simde__m128 v2 = simde_mm_add_ps(
+                    simde_mm_add_ps(s2[s][v], simde_mm_mul_ps(a2, s1[s][v])),
+                    simde_mm_mul_ps(simde_mm_load_ps(&stage.a3[lane]), v3));
+                s1[s][v] = simde_mm_sub_ps(simde_mm_add_ps(v1, v1), s1[s][v]);
+                s2[s][v] = simde_mm_sub_ps(simde_mm_add_ps(v2, v2), s2[s][v]);
+                if (Analog) {
+                    s1[s][v] = saturateLanes(s1[s][v], analog[s][v]);
+                    s2[s][v] = saturateLanes(s2[s][v], analog[s][v]);
+                }
+                // the mix of the lane, which is that of its type in `GdFilter`
+                y = simde_mm_add_ps(
+                    simde_mm_add_ps(
+                        simde_mm_mul_ps(simde_mm_load_ps(&stage.m0[lane]), x),
+                        simde_mm_mul_ps(simde_mm_load_ps(&stage.m1[lane]), v1)),
+                    simde_mm_mul_ps(simde_mm_load_ps(&stage.m2[lane]), v2));
+                x = y;
+            }
+            simde_mm_store_ps(&frame[lane], x);
+        }
+    }
+
+    for (unsigned s = 0; s < kNumStages; ++s) {
+        for (unsigned v = 0; v < NumVectors; ++v) {
+            unsigned lane = v * kLanesPerVector;
+            simde_mm_store_ps(&stages_[s].x1[lane], x1[s][v]);
+            simde_mm_store_ps(&stages_[s].y1[lane], y1[s][v]);
+            simde_mm_store_ps(&stages_[s].s1[lane], s1[s][v]);
+            simde_mm_store_ps(&stages_[s].s2[lane], s2[s][v]);
+        }
+    }
+
+    for (unsigned lane = 0; lane < numLanes; ++lane) {
+        for (unsigned i = 0; i < count; ++i)
+            frames[lane][i] = tile[i * stride + lane];
+    }
+}
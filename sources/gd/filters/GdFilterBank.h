@@ -0,0 +1,80 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+#include "GdFilter.h"
+
+// The low-pass and high-pass filters of several taps, which advance together
+// in the lanes of vectors
+//
+// A lane holds the pair of filters of a tap in one channel. The coefficients
+// and the states are laid out by lane, and the frames pass through a tile
+// which is transposed: the frame of every lane in turn, then the next frame.
+// A recursion waits on its last output, so the lanes go about as fast
+// together as a single filter does alone.
+//
+// The sections run in every lane, the pass-through ones also, which leaves
+// the output of the linear filters exact to that of `GdFilter`. The analog
+// filters saturate their recursions in their lanes only, with the vector
+// form of the same nonlinearity, so they stay exact also.
+class GdFilterBank {
+public:
+    enum { kNumLanes = 8 };
+
+    // copies the coefficients of the filters of the tap into the lane
+    void loadCoeffs(unsigned lane, const GdFilter &lpf, const GdFilter &hpf);
+    // copies the states of the filters of the tap into the lane, or back
+    void loadState(unsigned lane, const GdFilter &lpf, const GdFilter &hpf);
+    void storeState(unsigned lane, GdFilter &lpf, GdFilter &hpf) const;
+    // processes the frames of the first lanes in place
+    void process(float *const frames[], unsigned numLanes, unsigned count);
+
+private:
+    enum { kLanesPerVector = 4 };
+    enum { kNumVectors = kNumLanes / kLanesPerVector };
+    // number of frames which are transposed at once
+    enum { kTileSize = 16 };
+    template <unsigned NumVectors, bool Analog> void processTile(float *const frames[], unsigned numLanes, unsigned count);
+
+    // a first order followed by a second order, in the form of `GdFilter`
+    struct Stage {
+        alignas(16) float u0[kNumLanes];
+        alignas(16) float u1[kNumLanes];
+        alignas(16) float v1[kNumLanes];
+        alignas(16) float a1[kNumLanes];
+        alignas(16) float a2[kNumLanes];
+        alignas(16) float a3[kNumLanes];
+        alignas(16) float m0[kNumLanes];
+        alignas(16) float m1[kNumLanes];
+        alignas(16) float m2[kNumLanes];
+        alignas(16) float x1[kNumLanes];
+        alignas(16) float y1[kNumLanes];
+        alignas(16) float s1[kNumLanes];
+        alignas(16) float s2[kNumLanes];
+        // whether the filter of the lane is analog, as 0 or 1
+        alignas(16) float analog[kNumLanes];
+    };
+
+    // the low-pass, then the high-pass
+    enum { kNumStages = 2 };
+    Stage stages_[kNumStages] {};
+
+    // the transposed frames
+    alignas(16) float tile_[kTileSize * kNumLanes] {};
+};
@@ -1,12 +1,12 @@
 // File generated by MakeElliptic.jl
-// with arguments ["--name", "GdFilterDataAA", "--sos"]
+// with arguments ["--name", "GdFilterDataAA", "--sos", "--nf", "74"]
 #pragma once
 
 namespace GdFilterDataAA {
 
 static constexpr float F0 = 0.25;
 static constexpr float F1 = 0.45;
-static constexpr unsigned int NF = 512;
+static constexpr unsigned int NF = 74;
 static constexpr unsigned int NS = 4;
 
 static constexpr float BA[] = {
@@ -16,3066 +16,438 @@ static constexpr float BA[] = {
 	1.0f, 0.883332296108678f, 1.0f, -0.12362998082139319f, 0.7350834072447124f,
 	1.0f, 0.6767766059742345f, 1.0f, 0.04594374270934408f, 0.9200030070288457f,
 	0.01353187420967294f,
-	// Elliptic N=8 F/Fs=0.25039138943248535 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.8963042604793399f, 0.9999999999999998f, -0.8020687551924609f, 0.22841765437627198f,
-	1.0f, 1.3449791206904942f, 1.0f, -0.4528589479148453f, 0.47793958964381544f,
-	1.0f, 0.8872869250243316f, 1.0f, -0.11938131140713162f, 0.7350438252371372f,
-	1.0f, 0.6811281419588522f, 1.0f, 0.05066250033671321f, 0.9200077581464435f,
-	0.013634336209227079f,
-	// Elliptic N=8 F/Fs=0.25078277886497063 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.8967998972012037f, 1.0000000000000002f, -0.7998375962426622f, 0.22765738861767648f,
-	1.0f, 1.3476687478357443f, 1.0f, -0.4494750582760439f, 0.47764989475379194f,
-	1.0f, 0.8912329582237204f, 0.9999999999999999f, -0.11513146444314092f, 0.735005621640888f,
-	1.0f, 0.6854724214275114f, 0.9999999999999999f, 0.05538071088654146f, 0.92001297308301f,
-	0.013737522457452338f,
-	// Elliptic N=8 F/Fs=0.251174168297456 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.8972932333178716f, 1.0f, -0.7976038871497771f, 0.22689848671904794f,
-	1.0f, 1.3503495082259689f, 1.0000000000000002f, -0.44608809555689516f, 0.47736221122081274f,
-	1.0f, 0.895170399915177f, 1.0f, -0.11088045489492374f, 0.7349687972292303f,
-	1.0f, 0.6898094363092845f, 0.9999999999999999f, 0.06009834935037065f, 0.920018651732715f,
-	0.01384143772163569f,
-	// Elliptic N=8 F/Fs=0.25156555772994127 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.897784281847459f, 1.0000000000000002f, -0.795367618221518f, 0.22614095206973608f,
-	1.0f, 1.3530214295019776f, 1.0000000000000002f, -0.4426980590572239f, 0.47707654284524403f,
-	1.0f, 0.8990992543915576f, 1.0000000000000002f, -0.10662829774654134f, 0.7349333527742493f,
-	1.0f, 0.6941391786469838f, 0.9999999999999999f, 0.06481539073116613f, 0.9200247939876259f,
-	0.013946086798529073f,
-	// Elliptic N=8 F/Fs=0.2519569471624266 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.8982730557150118f, 1.0f, -0.7931287797336626f, 0.2253847880926222f,
-	1.0f, 1.3556845392282937f, 1.0000000000000002f, -0.4393049480881347f, 0.4767928934448482f,
-	1.0f, 0.903019526029368f, 1.0000000000000002f, -0.1023750080007035f, 0.7348992890468412f,
-	1.0f, 0.6984616405964853f, 0.9999999999999998f, 0.06953181004338982f, 0.9200313997377111f,
-	0.014051474514524915f,
-	// Elliptic N=8 F/Fs=0.25234833659491196 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.8987595677532845f, 0.9999999999999997f, -0.7908873619298981f, 0.22462999824430835f,
-	1.0f, 1.358338864893006f, 1.0000000000000002f, -0.435908761972179f, 0.47651126685482703f,
-	1.0f, 0.9069312192878919f, 1.0000000000000002f, -0.09812060067886381f, 0.7348666068167049f,
-	1.0f, 0.7027768144260456f, 1.0f, 0.07424758231306881f, 0.9200384688708408f,
-	0.014157605725832568f,
 	// Elliptic N=8 F/Fs=0.25273972602739725 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.8992438307035082f, 1.0000000000000002f, -0.7886433550216662f, 0.22387658601530985f,
 	1.0f, 1.3609844339076316f, 1.0f, -0.4325095000435168f, 0.4762316669278652f,
 	1.0f, 0.9108343387083275f, 1.0f, -0.09386509082130966f, 0.7348353068523357f,
 	1.0f, 0.707084692515628f, 0.9999999999999999f, 0.07896268257787001f, 0.9200460012727898f,
 	0.014264485318655977f,
-	// Elliptic N=8 F/Fs=0.2531311154598826 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.89972585721615f, 1.0f, -0.7863967491880036f, 0.22312455493024744f,
-	1.0f, 1.3636212736069844f, 0.9999999999999998f, -0.42910716164808316f, 0.4759540975341737f,
-	1.0f, 0.9147288889129294f, 0.9999999999999998f, -0.08960849348725335f, 0.7348053899210144f,
-	1.0f, 0.7113852673562315f, 1.0f, 0.08367708588717332f, 0.9200539968272395f,
-	0.014372118209372347f,
-	// Elliptic N=8 F/Fs=0.25352250489236794 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9002056598516701f, 0.9999999999999999f, -0.7841475345753869f, 0.2223739085480428f,
-	1.0f, 1.3662494112490442f, 1.0f, -0.4257017461437552f, 0.4756785625615326f,
-	1.0f, 0.9186148746041514f, 1.0f, -0.08535082375492666f, 0.7347768567887997f,
-	1.0f, 0.7156785315492117f, 0.9999999999999999f, 0.08839076730213685f, 0.9200624554157781f,
-	0.01448050934471175f,
-	// Elliptic N=8 F/Fs=0.25391389432485323 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9006832510812675f, 1.0000000000000002f, -0.7818957012975734f, 0.22162465046211507f,
-	1.0f, 1.368868874014837f, 0.9999999999999998f, -0.4222932529005207f, 0.4754050659153351f,
-	1.0f, 0.9224923005637996f, 1.0f, -0.08109209672167102f, 0.7347497082205222f,
-	1.0f, 0.7199644778056143f, 1.0f, 0.09310370189577281f, 0.9200713769179064f,
-	0.014589663701938075f,
-	// Elliptic N=8 F/Fs=0.2543052837573385 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.901158643287618f, 1.0f, -0.7796412394354412f, 0.2208767843005786f,
-	1.0f, 1.3714796890083198f, 1.0f, -0.41888168130064296f, 0.47513361151863026f,
-	1.0f, 0.9263611716521898f, 0.9999999999999998f, -0.07683232750402826f, 0.7347239449797713f,
-	1.0f, 0.7242430989455076f, 1.0f, 0.09781586475301887f, 0.9200807612110361f,
-	0.014699586289030822f,
-	// Elliptic N=8 F/Fs=0.25469667318982386 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.901631848765609f, 0.9999999999999998f, -0.7773841390368282f, 0.22013031372644168f,
-	1.0f, 1.3740818832562673f, 1.0f, -0.41546703073883384f, 0.4748642033121679f,
-	1.0f, 0.9302214928073089f, 0.9999999999999999f, -0.07257153123783487f, 0.7346995678288906f,
-	1.0f, 0.7285143878973129f, 1.0000000000000002f, 0.1025272309708067f, 0.9200906081704945f,
-	0.014810282144868153f,
-	// Elliptic N=8 F/Fs=0.2550880626223092 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9021028797230655f, 1.0000000000000002f, -0.7751243901163757f, 0.21938524243780994f,
-	1.0f, 1.376675483708168f, 1.0f, -0.41204930062242245f, 0.47459684525444074f,
-	1.0f, 0.9340732690439795f, 1.0f, -0.0683097230783125f, 0.7346765775289664f,
-	1.0f, 0.7327783376971392f, 1.0f, 0.107237775658132f, 0.9201009176695253f,
-	0.01492175633941088f,
 	// Elliptic N=8 F/Fs=0.2554794520547945 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9025717482814652f, 0.9999999999999997f, -0.7728619826553619f, 0.21864157416808716f,
 	1.0f, 1.3792605172361239f, 0.9999999999999997f, -0.408628490371528f, 0.4743315413217285f,
 	1.0f, 0.9379165054530334f, 1.0f, -0.06404691820016158f, 0.7346549748398213f,
 	1.0f, 0.7370349414881222f, 1.0000000000000002f, 0.11194747393612496f, 0.9201116895792892f,
 	0.015034013973887674f,
-	// Elliptic N=8 F/Fs=0.25587084148727984 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9030384664766573f, 1.0000000000000004f, -0.7705969066015417f, 0.21789931268618074f,
-	1.0f, 1.3818370106347564f, 1.0f, -0.40520459941922854f, 0.474068295508142f,
-	1.0f, 0.9417512072004923f, 1.0000000000000002f, -0.05978313179764868f, 0.7346347605200028f,
-	1.0f, 0.7412841925197634f, 1.0f, 0.11665630093812449f, 0.9201229237688705f,
-	0.015147060180981461f,
-	// Elliptic N=8 F/Fs=0.2562622309197652 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.903503046259559f, 0.9999999999999999f, -0.7683291518689842f, 0.21715846179670795f,
-	1.0f, 1.3844049906211155f, 0.9999999999999998f, -0.40177762721173876f, 0.4738071118256664f,
-	1.0f, 0.9455773795267447f, 1.0f, -0.0555183790847027f, 0.7346159353267756f,
-	1.0f, 0.7455260841472696f, 1.0000000000000002f, 0.1213642318097424f, 0.9201346201052741f,
-	0.01526090012501676f,
-	// Elliptic N=8 F/Fs=0.2566536203522505 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.903965499496863f, 0.9999999999999998f, -0.7660587083379079f, 0.21641902534020363f,
-	1.0f, 1.3869644838345954f, 1.0f, -0.3983475732085814f, 0.4735479943042049f,
-	1.0f, 0.9493950277457367f, 0.9999999999999998f, -0.05125267529500518f, 0.7345985000161133f,
-	1.0f, 0.7497606098308949f, 0.9999999999999999f, 0.12607124170893538f, 0.9201467784534301f,
-	0.01537553900214815f,
-	// Elliptic N=8 F/Fs=0.2570450097847358 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9044258379717234f, 1.0f, -0.7637855658545148f, 0.2156810071933294f,
-	1.0f, 1.389515516836856f, 1.0000000000000002f, -0.39491443688276207f, 0.47329094699162305f,
-	1.0f, 0.9532041572441672f, 0.9999999999999998f, -0.04698603568207966f, 0.7345824553426865f,
-	1.0f, 0.75398776313529f, 0.9999999999999998f, 0.13077730580607844f, 0.9201593986761946f,
-	0.015490982040550147f,
-	// Elliptic N=8 F/Fs=0.2574363992172211 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.904884073384443f, 1.0f, -0.7615097142308286f, 0.2149444112690861f,
-	1.0f, 1.3920581161117467f, 1.0f, -0.3914782177209486f, 0.47303597395379204f,
-	1.0f, 0.9570047734806792f, 1.0f, -0.0427184755193867f, 0.734567802059857f,
-	1.0f, 0.758207537728843f, 1.0000000000000002f, 0.135482399284026f, 0.9201724806343538f,
-	0.015607234500607822f,
-	// Elliptic N=8 F/Fs=0.25782778864970646 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9053402173531537f, 1.0000000000000002f, -0.7592311432445226f, 0.21420924151702492f,
-	1.0f, 1.394592308065239f, 0.9999999999999999f, -0.3880389152236436f, 0.4727830792746335f,
-	1.0f, 0.9607968819850714f, 1.0000000000000004f, -0.0384500101004124f, 0.7345545409196655f,
-	1.0f, 0.7624199273830333f, 1.0000000000000002f, 0.1401864973381911f, 0.9201860241866231f,
-	0.015724301675108916f,
 	// Elliptic N=8 F/Fs=0.2582191780821918 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9057942814144866f, 1.0f, -0.7569498426387595f, 0.21347550192346468f,
 	1.0f, 1.3971181190253583f, 0.9999999999999998f, -0.3845965289053682f, 0.4725322670561627f,
 	1.0f, 0.9645804883574964f, 0.9999999999999998f, -0.03418065473876247f, 0.7345426726728239f,
 	1.0f, 0.766624925971778f, 0.9999999999999999f, 0.14488957517660378f, 0.9202000291896529f,
 	0.015842188889436844f,
-	// Elliptic N=8 F/Fs=0.2586105675146771 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9062462770242414f, 1.0000000000000004f, -0.754665802122018f, 0.21274319651170598f,
-	1.0f, 1.3996355752421268f, 1.0f, -0.3811510582948366f, 0.4722835414185321f,
-	1.0f, 0.9683555982676845f, 1.0f, -0.02991042476825166f, 0.7345321980687048f,
-	1.0f, 0.7708225274707889f, 1.0f, 0.14959160801998908f, 0.9202144954980258f,
-	0.015960901501765098f,
-	// Elliptic N=8 F/Fs=0.25900195694716244 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9066962155580425f, 1.0000000000000002f, -0.7523790113679247f, 0.21201232934225023f,
-	1.0f, 1.4021447028875058f, 0.9999999999999998f, -0.3777025029351375f, 0.4720369065000761f,
-	1.0f, 0.9721222174541552f, 1.0f, -0.025639335542994166f, 0.7345231178553339f,
-	1.0f, 0.7750127259569247f, 1.0f, 0.15429257110183286f, 0.9202294229642636f,
-	0.016080444903252625f,
-	// Elliptic N=8 F/Fs=0.2593933463796477 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9071441083119967f, 0.9999999999999999f, -0.7500894600150887f, 0.21128290451302084f,
-	1.0f, 1.4046455280553456f, 1.0f, -0.37425086238391864f, 0.47179236645735656f,
-	1.0f, 0.97588035172344f, 1.0f, -0.02136740243749982f, 0.7345154327793759f,
-	1.0f, 0.7791955156075473f, 1.0f, 0.15899243966844492f, 0.9202448114388253f,
-	0.016200824518240457f,
-	// Elliptic N=8 F/Fs=0.25978473581213307 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9075899665033396f, 1.0f, -0.7477971376669247f, 0.21055492615958288f,
-	1.0f, 1.4071380767613393f, 0.9999999999999998f, -0.37079613621356255f, 0.47154992546520347f,
-	1.0f, 0.9796300069493173f, 0.9999999999999998f, -0.017094640846757415f, 0.7345091435861291f,
-	1.0f, 0.7833708906998844f, 1.0000000000000002f, 0.1636911889790377f, 0.9202606607701108f,
-	0.016322045804449598f,
-	// Elliptic N=8 F/Fs=0.2601761252446184 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.908033801271076f, 1.0f, -0.7455020338914872f, 0.2098283984553685f,
-	1.0f, 1.4096223749429804f, 0.9999999999999998f, -0.3673383240113775f, 0.4713095877167622f,
-	1.0f, 0.9833711890720391f, 1.0000000000000002f, -0.012821066186334126f, 0.7345042510195131f,
-	1.0f, 0.787538845610385f, 1.0000000000000002f, 0.168388794305785f, 0.9202769708044637f,
-	0.016444114253179966f,
-	// Elliptic N=8 F/Fs=0.2605675146771037 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.908475623676617f, 1.0000000000000002f, -0.7432041382212965f, 0.20910332561190215f,
-	1.0f, 1.4120984484595236f, 0.9999999999999998f, -0.36387742537977674f, 0.47107135742353556f,
-	1.0f, 0.9871039040975698f, 0.9999999999999999f, -0.008546693892461484f, 0.7345007558220609f,
-	1.0f, 0.7916993748140855f, 0.9999999999999999f, 0.1730852309338932f, 0.9202937413861716f,
-	0.016567035389510574f,
 	// Elliptic N=8 F/Fs=0.26095890410958905 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.908915444704409f, 1.0000000000000002f, -0.7409034401531643f, 0.2083797118790266f,
 	1.0f, 1.4145663230919554f, 1.0000000000000002f, -0.36041343993646496f, 0.4708352388154298f,
 	1.0f, 0.9908281580968359f, 1.0000000000000002f, -0.004271539422126965f, 0.734498658734905f,
 	1.0f, 0.7958524728839763f, 0.9999999999999998f, 0.17778047416167156f, 0.9203109723574692f,
 	0.016690814772501106f,
-	// Elliptic N=8 F/Fs=0.2613502935420744 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9093532752625582f, 0.9999999999999999f, -0.7385999291480222f, 0.20765756154513365f,
-	1.0f, 1.4170260245429602f, 1.0000000000000002f, -0.35694636731462565f, 0.47060123614079785f,
-	1.0f, 0.9945439572049659f, 1.0f, 4.3817468340395625e-6f, 0.7344979604977728f,
-	1.0f, 0.7999981344903647f, 0.9999999999999998f, 0.18247449930059753f, 0.9203286635585406f,
-	0.016815457995394377f,
-	// Elliptic N=8 F/Fs=0.2617416829745597 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9097891261834483f, 0.9999999999999996f, -0.7362935946307452f, 0.206936878937394f,
-	1.0f, 1.419477578436899f, 0.9999999999999999f, -0.3534762071631087f, 0.4703693536664838f,
-	1.0f, 0.9982513076205494f, 1.0000000000000002f, 0.0042810541156469055f, 0.7344986618489705f,
-	1.0f, 0.8041363544002471f, 0.9999999999999998f, 0.18716728167538266f, 0.9203468148275199f,
-	0.01694097068582026f,
-	// Elliptic N=8 F/Fs=0.262133072407045 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9102230082243539f, 0.9999999999999999f, -0.7339844259899768f, 0.2062176684219904f,
-	1.0f, 1.421921010319788f, 1.0f, -0.3500029591466172f, 0.4701395956778674f,
-	1.0f, 1.001950215604893f, 1.0000000000000002f, 0.008558462164509251f, 0.7345007635253762f,
-	1.0f, 0.8082671274766797f, 0.9999999999999999f, 0.1918587966240443f, 0.9203654260004936f,
-	0.017067358506000795f,
-	// Elliptic N=8 F/Fs=0.2625244618395303 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.910654932068044f, 1.0000000000000004f, -0.731672412577954f, 0.20549993440435327f,
-	1.0f, 1.4243563456592794f, 1.0000000000000002f, -0.3465266229458999f, 0.4699119664789082f,
-	1.0f, 1.0056406874812818f, 1.0000000000000002f, 0.01283659035249751f, 0.7345042662624297f,
-	1.0f, 0.8123904486781502f, 0.9999999999999998f, 0.19654901949796771f, 0.920384496911505f,
-	0.017194627152956467f,
-	// Elliptic N=8 F/Fs=0.26291585127201567 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.911084908323385f, 0.9999999999999997f, -0.7293575437103277f, 0.20478368132939606f,
-	1.0f, 1.426783609844652f, 1.0f, -0.3430471982579403f, 0.46968647039218947f,
-	1.0f, 1.0093227296342506f, 0.9999999999999999f, 0.01711542311747801f, 0.7345091707941199f,
-	1.0f, 0.8165063130579554f, 1.0000000000000002f, 0.2012379256619774f, 0.9204040273925513f,
-	0.01732278235871382f,
-	// Elliptic N=8 F/Fs=0.26330724070450096 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.911512947525939f, 1.0000000000000002f, -0.7270398086659869f, 0.2040689136817549f,
-	1.0f, 1.4292028281868001f, 1.0000000000000002f, -0.33956468479614865f, 0.4694631117589639f,
-	1.0f, 1.012996348508854f, 0.9999999999999997f, 0.02139494487601525f, 0.7345154778529749f,
-	1.0f, 0.8206147157635759f, 0.9999999999999999f, 0.2059254904944002f, 0.920424017273591f,
-	0.017451829890514223f,
 	// Elliptic N=8 F/Fs=0.2636986301369863 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.911939060138547f, 1.0000000000000004f, -0.724719196686877f, 0.20335563598602807f,
 	1.0f, 1.4316140259182293f, 1.0f, -0.336079082290555f, 0.46924189493919694f,
 	1.0f, 1.0166615506099452f, 1.0f, 0.025675140023283173f, 0.7345231881700534f,
 	1.0f, 0.8247156520360593f, 1.0f, 0.2106116893871349f, 0.9204444663825417f,
 	0.01758177555102402f,
-	// Elliptic N=8 F/Fs=0.26409001956947165 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9123632565519193f, 1.0f, -0.7223956969778229f, 0.2026438528070199f,
-	1.0f, 1.4340172281930565f, 1.0f, -0.3325903904880032f, 0.46902282431161196f,
-	1.0f, 1.020318342501457f, 0.9999999999999999f, 0.029955992932972728f, 0.73453230247493f,
-	1.0f, 0.8288091172093992f, 1.0f, 0.21529649774571738f, 0.9204653745452839f,
-	0.01771262517854587f,
-	// Elliptic N=8 F/Fs=0.26448140900195694 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9127855470852118f, 1.0f, -0.7200692987063463f, 0.201933568749984f,
-	1.0f, 1.4364124600870092f, 0.9999999999999998f, -0.32909860915234784f, 0.46880590427373386f,
-	1.0f, 1.0239667308056897f, 1.0000000000000002f, 0.034237487957202224f, 0.7345428214956878f,
-	1.0f, 0.8328951067099183f, 1.0000000000000004f, 0.21997989098938578f, 0.9204867415856638f,
-	0.01784438464723131f,
-	// Elliptic N=8 F/Fs=0.2648727984344423 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9132059419865999f, 1.0000000000000002f, -0.7177399910024842f, 0.20122478846087044f,
-	1.0f, 1.438799746597437f, 0.9999999999999999f, -0.3256037380646464f, 0.46859113924193474f,
-	1.0f, 1.0276067222026044f, 1.0000000000000002f, 0.038519609426428826f, 0.7345547459589056f,
-	1.0f, 0.8369736160556582f, 1.0000000000000002f, 0.22466184455115087f, 0.9205085673254929f,
-	0.017977059867294854f,
-	// Elliptic N=8 F/Fs=0.26526418786692757 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9136244514338465f, 1.0000000000000002f, -0.7154077629586074f, 0.2005175166265737f,
-	1.0f, 1.4411791126433158f, 1.0f, -0.3221057770233618f, 0.4683785336514778f,
-	1.0f, 1.0312383234291154f, 1.0f, 0.04280234164935495f, 0.7345680765896471f,
-	1.0f, 0.8410446408557626f, 1.0000000000000002f, 0.2293423338778549f, 0.920530851584552f,
-	0.01811065678522895f,
-	// Elliptic N=8 F/Fs=0.2656555772994129 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9140410855348666f, 1.0000000000000002f, -0.7130726036292363f, 0.1998117579751839f,
-	1.0f, 1.4435505830652657f, 1.0000000000000002f, -0.31860472584455635f, 0.4681680919565608f,
-	1.0f, 1.0348615412783984f, 1.0000000000000002f, 0.04708566891284152f, 0.7345828141114498f,
-	1.0f, 0.8451081768098713f, 1.0f, 0.23402133443024487f, 0.9205535941805925f,
-	0.018245181384020752f,
-	// Elliptic N=8 F/Fs=0.26604696673189826 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.914455854328284f, 1.0000000000000002f, -0.710734502030856f, 0.19910751727623824f,
-	1.0f, 1.4459141826255661f, 1.0000000000000004f, -0.31510058436209526f, 0.4679598186303634f,
-	1.0f, 1.038476382599189f, 1.0f, 0.0513695754818161f, 0.7345989592463144f,
-	1.0f, 0.8491642197075107f, 1.0f, 0.23869882168303352f, 0.9205767949293373f,
-	0.018380639683369775f,
 	// Elliptic N=8 F/Fs=0.26643835616438355 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9148687677839833f, 0.9999999999999999f, -0.7083934471417329f, 0.19840479934097688f,
 	1.0f, 1.4482699360081757f, 1.0f, -0.3115933524278451f, 0.4677537181650892f,
 	1.0f, 1.0420828542950986f, 1.0f, 0.05565404559918228f, 0.7346165127146917f,
 	1.0f, 0.8532127654274869f, 1.0f, 0.2433747711249665f, 0.9206004536444852f,
 	0.01851703773990709f,
-	// Elliptic N=8 F/Fs=0.2668297455968689 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9152798358036605f, 0.9999999999999998f, -0.7060494279017264f, 0.19770360902259831f,
-	1.0f, 1.4506178678187591f, 1.0000000000000002f, -0.30808302991187564f, 0.46754979507201133f,
-	1.0f, 1.045680963323929f, 1.0f, 0.05993906348573403f, 0.7346354752354733f,
-	1.0f, 0.8572538099372868f, 0.9999999999999998f, 0.2480491582588874f, 0.9206245701377103f,
-	0.018654381647415872f,
-	// Elliptic N=8 F/Fs=0.2672211350293542 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9156890682213628f, 1.0000000000000002f, -0.7037024332121034f, 0.19700395121651917f,
-	1.0f, 1.4529580025847102f, 0.9999999999999997f, -0.3045696167026653f, 0.4673480538815171f,
-	1.0f, 1.04927071669699f, 1.0f, 0.06422461334006035f, 0.7346558475259793f,
-	1.0f, 0.8612873492924714f, 0.9999999999999998f, 0.25272195860180335f, 0.9206491442186661f,
-	0.018792677537053097f,
-	// Elliptic N=8 F/Fs=0.26761252446183953 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9160964748040266f, 0.9999999999999999f, -0.701352451935349f, 0.19630583086063422f,
-	1.0f, 1.455290364755187f, 0.9999999999999999f, -0.30105311270730284f, 0.4671484991431526f,
-	1.0f, 1.0528521214784274f, 1.0000000000000002f, 0.06851067933846f, 0.7346776303019447f,
-	1.0f, 0.8653133796360811f, 1.0f, 0.25739314768494936f, 0.9206741756949844f,
-	0.018931931577572773f,
-	// Elliptic N=8 F/Fs=0.2680039138943249 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.916502065252013f, 1.0000000000000002f, -0.6989994728949788f, 0.1956092529355797f,
-	1.0f, 1.4576149787011414f, 0.9999999999999998f, -0.2975335178516939f, 0.46695113542566685f,
-	1.0f, 1.0564251847845503f, 1.0f, 0.07279724563484974f, 0.734700824277511f,
-	1.0f, 0.8693318971980355f, 1.0000000000000002f, 0.26206270105385443f, 0.9206996643722825f,
-	0.0190721499755504f,
-	// Elliptic N=8 F/Fs=0.26839530332681016 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9169058491996316f, 1.0f, -0.6966434848753492f, 0.19491422246499907f,
-	1.0f, 1.4599318687153582f, 0.9999999999999997f, -0.29401083208076983f, 0.46675596731705754f,
-	1.0f, 1.0599899137831648f, 0.9999999999999998f, 0.07708429636067461f, 0.7347254301652122f,
-	1.0f, 0.8733428982945393f, 1.0f, 0.26673059426840223f, 0.9207256100541578f,
-	0.01921333897560886f,
-	// Elliptic N=8 F/Fs=0.2687866927592955 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9173078362156675f, 0.9999999999999999f, -0.6942844766214639f, 0.1942207445158086f,
-	1.0f, 1.4622410590124968f, 0.9999999999999997f, -0.2904850553586896f, 0.46656299942461454f,
-	1.0f, 1.0635463156929161f, 0.9999999999999997f, 0.08137181562482289f, 0.7347514486759632f,
-	1.0f, 0.8773463793274935f, 1.0000000000000002f, 0.27139680290290513f, 0.920752012542197f,
-	0.01935550486064571f,
 	// Elliptic N=8 F/Fs=0.26917808219178085 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9177080358038978f, 1.0000000000000004f, -0.6919224368387856f, 0.19352882419846837f,
 	1.0f, 1.464542573729131f, 0.9999999999999998f, -0.2869561876690558f, 0.46637223637496533f,
 	1.0f, 1.0670943977826268f, 1.0f, 0.0856597875135311f, 0.7347788805190486f,
 	1.0f, 0.8813423367838988f, 0.9999999999999999f, 0.27606130254615685f, 0.920778871635974f,
 	0.019498653952061663f,
-	// Elliptic N=8 F/Fs=0.26956947162426614 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9181064574036026f, 0.9999999999999998f, -0.6895573541930431f, 0.1928384666672539f,
-	1.0f, 1.466836436923797f, 0.9999999999999999f, -0.28342422901512204f, 0.46618368281411904f,
-	1.0f, 1.070634167370645f, 1.0000000000000002f, 0.08994819609029618f, 0.7348077264021089f,
-	1.0f, 0.8853307672352707f, 0.9999999999999999f, 0.2807240688015034f, 0.9208061871330513f,
-	0.019642792609990713f,
-	// Elliptic N=8 F/Fs=0.26996086105675143 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9185031103900811f, 1.0000000000000004f, -0.6871892173100332f, 0.19214967712052827f,
-	1.0f, 1.4691226725770434f, 0.9999999999999996f, -0.27988917942000097f, 0.46599734340751175f,
-	1.0f, 1.074165631824201f, 0.9999999999999998f, 0.09423702539579257f, 0.7348379870311306f,
-	1.0f, 0.889311667337055f, 1.0f, 0.28538507728690976f, 0.9208339588289858f,
-	0.019787927233531552f,
-	// Elliptic N=8 F/Fs=0.2703522504892368 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9188980040751469f, 1.0f, -0.6848180147754314f, 0.19146246080102008f,
-	1.0f, 1.471401304591484f, 1.0f, -0.27635103892688273f, 0.4658132228400509f,
-	1.0f, 1.0776887985587609f, 1.0f, 0.09852625944777532f, 0.7348696631104319f,
-	1.0f, 0.8932850338280403f, 1.0f, 0.29004430363501676f, 0.9208621865173257f,
-	0.019934064260980263f,
-	// Elliptic N=8 F/Fs=0.2707436399217221 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9192911477076346f, 0.9999999999999997f, -0.6824437351345938f, 0.19077682299610083f,
-	1.0f, 1.4736723567918482f, 0.9999999999999998f, -0.2728098075992452f, 0.4656313258161598f,
-	1.0f, 1.081203675037385f, 1.0f, 0.10281588224099536f, 0.7349027553426519f,
-	1.0f, 0.8972508635297779f, 0.9999999999999998f, 0.29470172349321033f, 0.9208908699896157f,
-	0.020081210170064628f,
-	// Elliptic N=8 F/Fs=0.2711350293542074 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9196825504738928f, 1.0f, -0.680066366892362f, 0.1900927690380661f,
-	1.0f, 1.4759358529250453f, 1.0f, -0.26926548552107155f, 0.4654516570598224f,
-	1.0f, 1.0847102687700976f, 1.0f, 0.1071058777471102f, 0.734937264428737f,
-	1.0f, 0.9012091533460023f, 0.9999999999999997f, 0.2993573125236811f, 0.9209200090353992f,
-	0.020229371478179707f,
-	// Elliptic N=8 F/Fs=0.27152641878669276 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9200722214982724f, 1.0f, -0.6776858985128625f, 0.18941030430441747f,
-	1.0f, 1.4781918166602213f, 1.0f, -0.2657180727970622f, 0.46527422131462887f,
-	1.0f, 1.0882085873132565f, 1.0000000000000002f, 0.11139622991459752f, 0.7349731910679281f,
-	1.0f, 0.9051599002620555f, 1.0f, 0.30401104640349436f, 0.9209496034422175f,
-	0.02037855474262506f,
 	// Elliptic N=8 F/Fs=0.2719178082191781 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9204601698436166f, 1.0f, -0.6753023184193121f, 0.18872943421814853f,
 	1.0f, 1.480440271588823f, 1.0f, -0.26216756955285825f, 0.4650990233438173f,
 	1.0f, 1.0916986382689244f, 0.9999999999999999f, 0.11568692266866232f, 0.7350105359577499f,
 	1.0f, 0.9091031013443076f, 0.9999999999999999f, 0.3086629008246466f, 0.920979652995615f,
 	0.020528766560843046f,
-	// Elliptic N=8 F/Fs=0.2723091976516634 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9208464045117397f, 0.9999999999999998f, -0.6729156149938162f, 0.18805016424803211f,
-	1.0f, 1.4826812412246644f, 1.0f, -0.2586139759352565f, 0.4649260679303231f,
-	1.0f, 1.0951804292842502f, 0.9999999999999998f, 0.11997793991115167f, 0.7350492997939945f,
-	1.0f, 0.9130387537395873f, 1.0000000000000002f, 0.3133128514941316f, 0.9210101574791385f,
-	0.02068001357065893f,
-	// Elliptic N=8 F/Fs=0.27270058708414874 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9212309344439078f, 1.0000000000000002f, -0.6705257765771688f, 0.18737249990891036f,
-	1.0f, 1.4849147490039971f, 1.0000000000000002f, -0.2550572921124295f, 0.4647553598768191f,
-	1.0f, 1.0986539680508527f, 1.0f, 0.12426926552046802f, 0.7350894832707134f,
-	1.0f, 0.9169668546746106f, 0.9999999999999997f, 0.31796087413400587f, 0.9210411166743392f,
-	0.020832302450522398f,
-	// Elliptic N=8 F/Fs=0.273091976516634 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.921613768521307f, 1.0000000000000002f, -0.668132791468651f, 0.18669644676198624f,
-	1.0f, 1.4871408182855776f, 0.9999999999999999f, -0.2514975182741493f, 0.4645869040057626f,
-	1.0f, 1.1021192623042053f, 1.0000000000000002f, 0.12856088335147742f, 0.7351310870802003f,
-	1.0f, 0.9208874014554119f, 1.0f, 0.3226069444814475f, 0.921072530360777f,
-	0.020985639919750176f,
-	// Elliptic N=8 F/Fs=0.2734833659491194 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9219949155655178f, 1.0f, -0.6657366479258281f, 0.18602201041511865f,
-	1.0f, 1.489359472350748f, 1.0000000000000004f, -0.24793465463200728f, 0.4644207051594401f,
-	1.0f, 1.1055763198230308f, 1.0f, 0.1328527772354257f, 0.7351741119129798f,
-	1.0f, 0.9248003914667774f, 1.0000000000000002f, 0.32725103828882235f, 0.92110439831602f,
-	0.021140032738770725f,
-	// Elliptic N=8 F/Fs=0.2738747553816047 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9223743843389762f, 0.9999999999999999f, -0.663337334164347f, 0.18534919652311943f,
-	1.0f, 1.4915707344035045f, 1.0000000000000004f, -0.24436870141963996f, 0.46425676820001055f,
-	1.0f, 1.1090251484286962f, 1.0f, 0.1371449309798477f, 0.7352185584577952f,
-	1.0f, 0.9287058221716811f, 1.0000000000000004f, 0.3318931313237467f, 0.9211367203156476f,
-	0.02129548770936989f,
-	// Elliptic N=8 F/Fs=0.27426614481409 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9227521835454358f, 1.0000000000000002f, -0.660934838357733f, 0.18467801078805324f,
-	1.0f, 1.4937746275705819f, 1.0f, -0.2407996588929551f, 0.46409509800955095f,
-	1.0f, 1.1124657559846116f, 1.0f, 0.14143732836847944f, 0.7352644274015931f,
-	1.0f, 0.9326036911107214f, 1.0f, 0.33653319936914505f, 0.9211694961332512f,
-	0.021452011674938334f,
 	// Elliptic N=8 F/Fs=0.27465753424657535 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9231283218304218f, 1.0f, -0.6585291486371795f, 0.18400845895953744f,
 	1.0f, 1.495971174901535f, 0.9999999999999998f, -0.23722752733035443f, 0.4639356994901002f,
 	1.0f, 1.1158981503956393f, 1.0000000000000004f, 0.14572995316117432f, 0.7353117194295116f,
 	1.0f, 0.9364939959015662f, 1.0000000000000002f, 0.3411712182233204f, 0.9212027255404385f,
 	0.02160961152072042f,
-	// Elliptic N=8 F/Fs=0.27504892367906064 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.923502807781687f, 0.9999999999999999f, -0.6561202530913477f, 0.1833405468350493f,
-	1.0f, 1.4981603993688188f, 0.9999999999999998f, -0.23365230703296502f, 0.46377857756370466f,
-	1.0f, 1.119322339607497f, 1.0f, 0.1500227890938118f, 0.7353604352248663f,
-	1.0f, 0.9403767342383884f, 1.0f, 0.34580716370001063f, 0.9212364083068322f,
-	0.021768294174064534f,
-	// Elliptic N=8 F/Fs=0.275440313111546 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9238756499296565f, 0.9999999999999998f, -0.6537081397661546f, 0.18267428026023041f,
-	1.0f, 1.5003423238678784f, 1.0f, -0.23007399832486716f, 0.46362373717246225f,
-	1.0f, 1.122738331606177f, 1.0f, 0.154315819878214f, 0.7354105754691372f,
-	1.0f, 0.9442519038913166f, 1.0000000000000004f, 0.35044101162845326f, 0.9212705442000733f,
-	0.021928066604675125f,
-	// Elliptic N=8 F/Fs=0.27583170254403133 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.924246856747875f, 1.0000000000000002f, -0.6512927966645661f, 0.1820096651291969f,
-	1.0f, 1.5025169712172346f, 1.0f, -0.2264926015533248f, 0.4634711832785665f,
-	1.0f, 1.1261461344173582f, 0.9999999999999997f, 0.15860902920205466f, 0.7354621408419545f,
-	1.0f, 0.9481195027058777f, 0.9999999999999999f, 0.35507273785344745f, 0.9213051329858251f,
-	0.022088935824866027f,
-	// Elliptic N=8 F/Fs=0.2762230919765166 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9246164366534426f, 1.0000000000000004f, -0.6488742117463882f, 0.18134670738485176f,
-	1.0f, 1.5046843641585763f, 0.9999999999999998f, -0.22290811708901695f, 0.4633209208643512f,
-	1.0f, 1.1295457561058315f, 1.0f, 0.16290240072877532f, 0.7355151320210858f,
-	1.0f, 0.9519795286024489f, 0.9999999999999998f, 0.3597023182354138f, 0.9213401744277706f,
-	0.022250908889815468f,
-	// Elliptic N=8 F/Fs=0.27661448140900197 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9249843980074552f, 0.9999999999999999f, -0.6464523729280541f, 0.18068541301919808f,
-	1.0f, 1.5068445253568543f, 1.0f, -0.21932054532627052f, 0.4631729549323349f,
-	1.0f, 1.1329372047749238f, 1.0f, 0.167195918097498f, 0.7355695496824208f,
-	1.0f, 0.9558319795757085f, 0.9999999999999997f, 0.3643297286504613f, 0.9213756682876186f,
-	0.022413992897822716f,
-	// Elliptic N=8 F/Fs=0.2770058708414873 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9253507491154365f, 1.0000000000000002f, -0.6440272680824151f, 0.18002578807365688f,
-	1.0f, 1.508997477400373f, 0.9999999999999997f, -0.2157298866832968f, 0.4630272905052662f,
-	1.0f, 1.1363204885659277f, 1.0f, 0.17148956492293776f, 0.735625394499959f,
-	1.0f, 0.9596768536940873f, 1.0f, 0.3689549449904428f, 0.921411614325103f,
-	0.022578194990566094f,
 	// Elliptic N=8 F/Fs=0.2773972602739726 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9257154982277627f, 1.0000000000000004f, -0.641598885038526f, 0.17936783863938632f,
 	1.0f, 1.511143242800892f, 1.0f, -0.21213614160242486f, 0.46288393262616656f,
 	1.0f, 1.139695615657537f, 1.0f, 0.1757833247953168f, 0.7356826671457947f,
 	1.0f, 0.9635141490992263f, 1.0f, 0.3735779431630203f, 0.9214480122979853f,
 	0.02274352235336274f,
-	// Elliptic N=8 F/Fs=0.2777886497064579 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9260786535400913f, 1.0000000000000002f, -0.6391672115814325f, 0.17871157085760397f,
-	1.0f, 1.5132818439937217f, 1.0000000000000004f, -0.20853931055033956f, 0.4627428863583761f,
-	1.0f, 1.1430625942652828f, 0.9999999999999998f, 0.18007718128027814f, 0.7357413682901023f,
-	1.0f, 0.9673438640054342f, 1.0f, 0.37819869909172693f, 0.921484861962057f,
-	0.02290998221542978f,
-	// Elliptic N=8 F/Fs=0.27818003913894324 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9264402231937807f, 1.0000000000000002f, -0.6367322354519553f, 0.17805699091991115f,
-	1.0f, 1.515413303337827f, 1.0000000000000002f, -0.20493939401831918f, 0.46260415678559685f,
-	1.0f, 1.1464214326409794f, 1.0000000000000004f, 0.1843711179188011f, 0.7358014986011251f,
-	1.0f, 0.9711659966991488f, 1.0000000000000002f, 0.3828171887160275f, 0.9215221630711414f,
-	0.023077581850147404f,
-	// Elliptic N=8 F/Fs=0.2785714285714286 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9268002152763062f, 0.9999999999999998f, -0.6342939443464752f, 0.177404105068621f,
-	1.0f, 1.5175376431159304f, 0.9999999999999998f, -0.20133639252247754f, 0.46246774901193705f,
-	1.0f, 1.1497721390721642f, 0.9999999999999997f, 0.18866511822711302f, 0.7358630587451567f,
-	1.0f, 0.9749805455383961f, 1.0000000000000002f, 0.38743338799137744f, 0.9215599153770946f,
-	0.0232463285753231f,
-	// Elliptic N=8 F/Fs=0.27896281800391387 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9271586378216752f, 0.9999999999999998f, -0.6318523259167161f, 0.17675291959708833f,
-	1.0f, 1.5196548855346173f, 0.9999999999999998f, -0.19773030660400334f, 0.46233366816195703f,
-	1.0f, 1.1531147218815556f, 1.0f, 0.1929591656966036f, 0.7359260493865304f,
-	1.0f, 0.9787875089522581f, 1.0f, 0.3920472728892868f, 0.9215981186298075f,
-	0.023416229753457918f,
-	// Elliptic N=8 F/Fs=0.2793542074363992 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.927515498810836f, 1.0000000000000002f, -0.6294073677695254f, 0.17610344085004204f,
-	1.0f, 1.5217650527244426f, 0.9999999999999998f, -0.19412113682940224f, 0.46220191938071054f,
-	1.0f, 1.1564491894265012f, 1.0000000000000002f, 0.1972532437937422f, 0.7359904711876007f,
-	1.0f, 0.9825868854403383f, 0.9999999999999999f, 0.39665881939738146f, 0.9216367725772088f,
-	0.023587292792014183f,
-	// Elliptic N=8 F/Fs=0.27974559686888456 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9278708061720824f, 1.0f, -0.6269590574666567f, 0.1754556752239212f,
-	1.0f, 1.523868166740042f, 1.0000000000000002f, -0.1905088837907433f, 0.46207250783379256f,
-	1.0f, 1.1597755500984395f, 1.0f, 0.2015473359599888f, 0.7360563248087348f,
-	1.0f, 0.9863786735722312f, 0.9999999999999998f, 0.4012680035194619f, 0.9216758769652652f,
-	0.023759525143684755f,
 	// Elliptic N=8 F/Fs=0.28013698630136985 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.92822456778146f, 1.0000000000000002f, -0.6245073825245495f, 0.1748096291672133f,
 	1.0f, 1.52596424956024f, 1.0000000000000002f, -0.18689354810590184f, 0.46194543870737936f,
 	1.0f, 1.1630938123223613f, 1.0000000000000002f, 0.20584142561171181f, 0.7361236109082907f,
 	1.0f, 0.9901628719869924f, 1.0f, 0.4058748012755653f, 0.9217154315379842f,
 	0.02393293430666417f,
-	// Elliptic N=8 F/Fs=0.2805283757338552 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9285767914631615f, 1.0f, -0.6220523304141059f, 0.17416530918079476f,
-	1.0f, 1.5280533230881668f, 1.0f, -0.18327513041880808f, 0.46182071720827556f,
-	1.0f, 1.1664039845562761f, 0.9999999999999998f, 0.21013549614010124f, 0.7361923301426075f,
-	1.0f, 0.993939479392613f, 0.9999999999999998f, 0.41047918870202715f, 0.9217554360374169f,
-	0.02410752782492121f,
-	// Elliptic N=8 F/Fs=0.2809197651663405 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9289274849899245f, 1.0f, -0.6195938885604703f, 0.17352272181827533f,
-	1.0f, 1.5301354091513701f, 1.0000000000000002f, -0.1796536313996935f, 0.46169834856395686f,
-	1.0f, 1.169706075290683f, 0.9999999999999998f, 0.2144295309110834f, 0.7362624831659894f,
-	1.0f, 0.9977084945654963f, 1.0000000000000002f, 0.4150811418515387f, 0.9217958902036569f,
-	0.02428331328847326f,
-	// Elliptic N=8 F/Fs=0.28131115459882583 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.929276656083422f, 0.9999999999999998f, -0.6171320443428054f, 0.17288187368634472f,
-	1.0f, 1.5322105295019335f, 1.0000000000000002f, -0.1760290517453429f, 0.46157833802261455f,
-	1.0f, 1.173000093048043f, 1.0f, 0.2187235132652388f, 0.7363340706306887f,
-	1.0f, 1.0014699163499325f, 1.0f, 0.4196806367932118f, 0.9218367937748451f,
-	0.024460298333662388f,
-	// Elliptic N=8 F/Fs=0.2817025440313112 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9296243124146522f, 0.9999999999999997f, -0.6146667850940659f, 0.17224277144512146f,
-	1.0f, 1.5342787058165936f, 0.9999999999999997f, -0.17240139217934286f, 0.4614606908531988f,
-	1.0f, 1.176286046382259f, 0.9999999999999998f, 0.2230174265177148f, 0.7364070931868932f,
-	1.0f, 1.005223743657583f, 1.0000000000000002f, 0.4242776496126359f, 0.9218781464871698f,
-	0.024638490643432986f,
-	// Elliptic N=8 F/Fs=0.28209393346379646 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.929970461604322f, 1.0f, -0.6121980981007767f, 0.1716054218085065f,
-	1.0f, 1.5363399596968614f, 0.9999999999999999f, -0.16877065345233824f, 0.4613454123454627f,
-	1.0f, 1.1795639438781567f, 1.0f, 0.22731125395814078f, 0.7364815514827107f,
-	1.0f, 1.0089699754669574f, 1.0000000000000004f, 0.4288721564119366f, 0.9219199480748701f,
-	0.024817897947611148f,
-	// Elliptic N=8 F/Fs=0.2824853228962818 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9303151112232302f, 1.0000000000000002f, -0.6097259706028005f, 0.17096983154453704f,
-	1.0f, 1.5383943126691433f, 1.0000000000000002f, -0.16513683634227977f, 0.46123250781000635f,
-	1.0f, 1.182833794150971f, 1.0f, 0.23160497885055037f, 0.7365574461641525f,
-	1.0f, 1.012708610822905f, 1.0f, 0.4334641333098442f, 0.9219621982702344f,
-	0.024998528023185928f,
 	// Elliptic N=8 F/Fs=0.2828767123287671 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9306582687926435f, 0.9999999999999998f, -0.6072503897931145f, 0.1703360074757457f,
 	1.0f, 1.540441786184863f, 0.9999999999999999f, -0.16149994165468723f, 0.4611219825783201f,
 	1.0f, 1.186095605845835f, 1.0000000000000004f, 0.23589858443328682f, 0.7366347778751181f,
 	1.0f, 1.0164396488360943f, 1.0f, 0.4380535564417417f, 0.9220048968036061f,
 	0.025180388694592017f,
-	// Elliptic N=8 F/Fs=0.28326810176125244 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9309999417846762f, 1.0f, -0.6047713428175783f, 0.16970395647952133f,
-	1.0f, 1.5424824016205905f, 0.9999999999999997f, -0.15785997022289774f, 0.4610138420028287f,
-	1.0f, 1.189349387637275f, 1.0f, 0.24019205391893148f, 0.7367135472573806f,
-	1.0f, 1.0201630886825082f, 0.9999999999999998f, 0.4426404019597374f, 0.9220480434033848f,
-	0.02536348783399456f,
-	// Elliptic N=8 F/Fs=0.2836594911937378 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9313401376226556f, 1.0f, -0.6022888167747061f, 0.1690736854884731f,
-	1.0f, 1.5445161802781642f, 0.9999999999999998f, -0.15421692290833347f, 0.46090809145693395f,
-	1.0f, 1.192595148228705f, 1.0f, 0.2444853704942077f, 0.7367937549505713f,
-	1.0f, 1.0238789296029298f, 1.0000000000000002f, 0.4472246460327127f, 0.9220916377960243f,
-	0.025547833361575123f,
-	// Elliptic N=8 F/Fs=0.2840508806262231 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9316788636814957f, 1.0000000000000002f, -0.5998027987154337f, 0.16844520149079778f,
-	1.0f, 1.5465431433848211f, 0.9999999999999998f, -0.1505708006007549f, 0.4608047363350592f,
-	1.0f, 1.1958328963519298f, 0.9999999999999997f, 0.2487785173199074f, 0.7368754015921637f,
-	1.0f, 1.0275871709024382f, 1.0000000000000002f, 0.4518062648463899f, 0.9221356797060394f,
-	0.025733433245820093f,
-	// Elliptic N=8 F/Fs=0.2844422700587084 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9320161272880596f, 1.0000000000000002f, -0.5973132756428843f, 0.16781851153064886f,
-	1.0f, 1.548563312093327f, 0.9999999999999998f, -0.14692160421852207f, 0.4607037820526928f,
-	1.0f, 1.1990626407666516f, 0.9999999999999998f, 0.2530714775308051f, 0.736958487817456f,
-	1.0f, 1.0312878119499065f, 1.0000000000000002f, 0.4563852346033903f, 0.9221801688560036f,
-	0.025920295503810434f,
-	// Elliptic N=8 F/Fs=0.28483365949119377 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9323519357215224f, 1.0000000000000004f, -0.5948202345121393f, 0.16719362270851149f,
-	1.0f, 1.5505767074821069f, 1.0f, -0.14326933470886252f, 0.46060523404643f,
-	1.0f, 1.2022843902599734f, 0.9999999999999999f, 0.25736423423557064f, 0.7370430142595585f,
-	1.0f, 1.0349808521774944f, 1.0f, 0.4609615315232914f, 0.9222251049665545f,
-	0.02610842820151328f,
-	// Elliptic N=8 F/Fs=0.28522504892367906 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9326862962137297f, 1.0f, -0.5923236622299994f, 0.16657054218157713f,
-	1.0f, 1.5525833505553757f, 1.0000000000000002f, -0.139613993048131f, 0.46050909777401833f,
-	1.0f, 1.2054981536459155f, 1.0f, 0.26165677051669217f, 0.7371289815493752f,
-	1.0f, 1.038666291080152f, 1.0f, 0.46553513184268747f, 0.9222704877563926f,
-	0.026297839454075368f,
 	// Elliptic N=8 F/Fs=0.28561643835616435 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.933019215949554f, 0.9999999999999997f, -0.5898235456547499f, 0.1659492771641231f,
 	1.0f, 1.5545832622432747f, 1.0000000000000002f, -0.13595558024207752f, 0.4604153787143986f,
 	1.0f, 1.2087039397649295f, 1.0000000000000002f, 0.26594906943039087f, 0.7372163903155883f,
 	1.0f, 1.0423441282151205f, 1.0f, 0.470106011815249f, 0.9223163169422843f,
 	0.026488537426118237f,
-	// Elliptic N=8 F/Fs=0.2860078277886497 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9333507020672476f, 0.9999999999999997f, -0.5873198715959228f, 0.16532983492789566f,
-	1.0f, 1.5565764634020074f, 1.0f, -0.13229409732611197f, 0.46032408236774985f,
-	1.0f, 1.2119017574834212f, 1.0f, 0.2702411140065403f, 0.737305241184642f,
-	1.0f, 1.0460143632014378f, 0.9999999999999998f, 0.47467414771178573f, 0.9223625922390651f,
-	0.026680530332035456f,
-	// Elliptic N=8 F/Fs=0.28639921722113504 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9336807616587905f, 1.0f, -0.5848126268140607f, 0.16471222280249515f,
-	1.0f, 1.558562974813973f, 1.0f, -0.12862954536557764f, 0.4602352142555313f,
-	1.0f, 1.2150916156932674f, 1.0f, 0.27453288724858005f, 0.7373955347807277f,
-	1.0f, 1.0496769957194434f, 1.0f, 0.47923951582029567f, 0.9224093133596373f,
-	0.026873826436291177f,
-	// Elliptic N=8 F/Fs=0.28679060665362033 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9340094017702374f, 1.0f, -0.5823017980204743f, 0.1640964481757647f,
-	1.0f, 1.5605428171879072f, 1.0000000000000002f, -0.12496192545601849f, 0.46014877992052533f,
-	1.0f, 1.2182735233113495f, 1.0f, 0.27882437213343947f, 0.7374872717257642f,
-	1.0f, 1.0533320255102867f, 1.0f, 0.48380209244603506f, 0.9224564800149765f,
-	0.027068434053721023f,
-	// Elliptic N=8 F/Fs=0.2871819960861057 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9343366294020627f, 1.0f, -0.5797873718770029f, 0.1634825184941821f,
-	1.0f, 1.5625160111590197f, 1.0f, -0.12129123872345052f, 0.4600647849268814f,
-	1.0f, 1.2214474892790808f, 1.0f, 0.2831155516114525f, 0.7375804526393851f,
-	1.0f, 1.056979452375441f, 1.0f, 0.4883618539115717f, 0.9225040919141304f,
-	0.027264361549834717f,
-	// Elliptic N=8 F/Fs=0.287573385518591 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9346624515095f, 1.0f, -0.5772693349957724f, 0.1628704412632553f,
-	1.0f, 1.5644825772891364f, 0.9999999999999998f, -0.11761748632463755f, 0.45998323486015635f,
-	1.0f, 1.2246135225619408f, 0.9999999999999998f, 0.2874064086062771f, 0.7376750781389197f,
-	1.0f, 1.060619276176214f, 1.0000000000000002f, 0.49291877655684496f, 0.9225521487642225f,
-	0.027461617341120258f,
-	// Elliptic N=8 F/Fs=0.2879647749510763 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9349868750028787f, 1.0f, -0.5747476739389527f, 0.1622602240479209f,
-	1.0f, 1.5664425360668406f, 1.0f, -0.11394066944736578f, 0.4599041353273601f,
-	1.0f, 1.2277716321490133f, 0.9999999999999998f, 0.2916969260148135f, 0.7377711488393773f,
-	1.0f, 1.0642514968332624f, 1.0f, 0.497472836739223f, 0.9226006502704508f,
-	0.027660209895350472f,
 	// Elliptic N=8 F/Fs=0.28835616438356165 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9353099067479609f, 1.0000000000000002f, -0.5722223752185105f, 0.16165187447294477f,
 	1.0f, 1.5683959079076149f, 1.0000000000000002f, -0.110260789310718f, 0.45982749195699574f,
 	1.0f, 1.2309218270525282f, 1.0f, 0.29598708670712554f, 0.7378686653534308f,
 	1.0f, 1.0678761143261142f, 1.0f, 0.5020240108335652f, 0.9226495961360925f,
 	0.02786014773189097f,
-	// Elliptic N=8 F/Fs=0.28874755381604694 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.935631553566271f, 1.0000000000000002f, -0.569693425295969f, 0.16104540022332925f,
-	1.0f, 1.5703427131539864f, 1.0000000000000004f, -0.1065778471653564f, 0.4597533103991035f,
-	1.0f, 1.2340641163074049f, 0.9999999999999998f, 0.30027687352635474f, 0.7379676282913976f,
-	1.0f, 1.0714931286926808f, 0.9999999999999998f, 0.506572275232276f, 0.9226989860625051f,
-	0.028061439422010365f,
-	// Elliptic N=8 F/Fs=0.2891389432485323 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9359518222354255f, 1.0000000000000002f, -0.5671608105821548f, 0.16044080904471913f,
-	1.0f, 1.5722829720756726f, 1.0f, -0.1028918442937978f, 0.4596815963253013f,
-	1.0f, 1.237198508970803f, 1.0f, 0.30456626928864666f, 0.7380680382612261f,
-	1.0f, 1.075102540028787f, 1.0f, 0.511117606345368f, 0.9227488197491276f,
-	0.028264093589192144f,
-	// Elliptic N=8 F/Fs=0.28953033268101763 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9362707194894588f, 0.9999999999999998f, -0.5646245174369547f, 0.1598381087438152f,
-	1.0f, 1.5742167048697278f, 1.0f, -0.09920278201069782f, 0.4596123554288298f,
-	1.0f, 1.2403250141216713f, 1.0f, 0.3088552567830646f, 0.7381698958684759f,
-	1.0f, 1.0787043484876881f, 1.0f, 0.515659980600516f, 0.9227990968934814f,
-	0.028468118909448642f,
-	// Elliptic N=8 F/Fs=0.2899217221135029 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9365882520191477f, 0.9999999999999998f, -0.562084532169064f, 0.15923730718878862f,
-	1.0f, 1.5761439316606891f, 1.0f, -0.09551066166313378f, 0.4595455934245919f,
-	1.0f, 1.243443640860305f, 1.0f, 0.3131438187715126f, 0.7382732017163014f,
-	1.0f, 1.0822985542796006f, 1.0f, 0.5201993744431197f, 0.9228498171911753f,
-	0.02867352411163688f,
-	// Elliptic N=8 F/Fs=0.29031311154598827 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9369044264723299f, 1.0000000000000002f, -0.5595408410357363f, 0.1586384123096996f,
-	1.0f, 1.5780646725007275f, 1.0f, -0.0918154846308876f, 0.45948131604919484f,
-	1.0f, 1.2465543983079044f, 1.0f, 0.3174319379886554f, 0.7383779564054351f,
-	1.0f, 1.0858851576712292f, 1.0f, 0.5247357643363574f, 0.9229009803359025f,
-	0.028880317977776362f,
-	// Elliptic N=8 F/Fs=0.29070450097847356 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.937219249454221f, 0.9999999999999999f, -0.5569934302425322f, 0.15804143209891944f,
-	1.0f, 1.5799789473697945f, 0.9999999999999996f, -0.08811725232673426f, 0.4594195290609945f,
-	1.0f, 1.2496572956061358f, 1.0f, 0.3217195971418382f, 0.7384841605341705f,
-	1.0f, 1.089464158985296f, 0.9999999999999999f, 0.5292691267612477f, 0.9229525860194465f,
-	0.029088509343368665f,
 	// Elliptic N=8 F/Fs=0.2910958904109589 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9375327275277339f, 0.9999999999999998f, -0.5544422859430663f, 0.15744637461155647f,
 	1.0f, 1.5818867761757782f, 1.0f, -0.08441596619672782f, 0.4593602382401339f,
 	1.0f, 1.252752341916699f, 1.0000000000000002f, 0.32600677891100693f, 0.7385918146983413f,
 	1.0f, 1.0930355586000762f, 1.0000000000000002f, 0.5337994382167065f, 0.9230046339316798f,
 	0.029298107097719413f,
-	// Elliptic N=8 F/Fs=0.29148727984344425 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.937844867213786f, 1.0f, -0.5518873942387518f, 0.1568532479658844f,
-	1.0f, 1.5837881787546482f, 1.0f, -0.08071162772049273f, 0.45930344938858725f,
-	1.0f, 1.2558395464208945f, 0.9999999999999999f, 0.3302934659486309f, 0.73870091949131f,
-	1.0f, 1.0965993569489294f, 1.0f, 0.5383266752196043f, 0.9230571237605693f,
-	0.029509120184261807f,
-	// Elliptic N=8 F/Fs=0.29187866927592954 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9381556749916107f, 0.9999999999999999f, -0.5493287411785464f, 0.15626206034377568f,
-	1.0f, 1.5856831748706135f, 1.0f, -0.0770042384115134f, 0.4592491683302003f,
-	1.0f, 1.2589189183191976f, 1.0000000000000004f, 0.334579640879621f, 0.7388114755039432f,
-	1.0f, 1.1001555545198392f, 1.0f, 0.5428508143048235f, 0.9231100551921725f,
-	0.029721557600882333f,
-	// Elliptic N=8 F/Fs=0.2922700587084149 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9384651572990657f, 0.9999999999999999f, -0.5467663127586947f, 0.15567281999113752f,
-	1.0f, 1.587571784216275f, 1.0f, -0.07329379981742735f, 0.45919740091073236f,
-	1.0f, 1.2619904668308322f, 1.0f, 0.3388652863012555f, 0.7389234833245995f,
-	1.0f, 1.1037041518549522f, 1.0f, 0.5473718320253199f, 0.9231634279106447f,
-	0.029935428400248574f,
-	// Elliptic N=8 F/Fs=0.2926614481409002 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.938773320532935f, 1.0f, -0.5442000949224698f, 0.15508553521835128f,
-	1.0f, 1.5894540264127794f, 0.9999999999999998f, -0.06958031352032061f, 0.4591481529978959f,
-	1.0f, 1.2650542011933523f, 1.0f, 0.34315038478309823f, 0.7390369435391086f,
-	1.0f, 1.1072451495501183f, 0.9999999999999998f, 0.5518897049521759f, 0.9232172415982375f,
-	0.03015074169013887f,
-	// Elliptic N=8 F/Fs=0.2930528375733855 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9390801710492316f, 1.0f, -0.5416300735599158f, 0.1545002144007167f,
-	1.0f, 1.5913299210099752f, 1.0f, -0.06586378113702474f, 0.45910143048140073f,
-	1.0f, 1.268110130662222f, 1.0000000000000002f, 0.3474349188669186f, 0.7391518567307537f,
-	1.0f, 1.1107785482544337f, 1.0f, 0.5564044096746588f, 0.9232714959353018f,
-	0.03036750663377407f,
-	// Elliptic N=8 F/Fs=0.2934442270058708 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9393857151634966f, 1.0f, -0.5390562345075833f, 0.15391686597889823f,
-	1.0f, 1.593199487486569f, 1.0f, -0.062144204319410146f, 0.4590572392729915f,
-	1.0f, 1.271158264510403f, 1.0000000000000002f, 0.3517188710666215f, 0.7392682234802543f,
-	1.0f, 1.1143043486697888f, 0.9999999999999998f, 0.560915922800283f, 0.9233261906002885f,
-	0.030585732450151358f,
 	// Elliptic N=8 F/Fs=0.29383561643835615 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.939689959151096f, 1.0000000000000002f, -0.536478563548272f, 0.15333549845937672f,
 	1.0f, 1.5950627452502832f, 0.9999999999999996f, -0.058421584754690746f, 0.45901558530649045f,
 	1.0f, 1.2741986120279432f, 0.9999999999999998f, 0.35600222386816255f, 0.7393860443657471f,
 	1.0f, 1.117822551550415f, 1.0000000000000002f, 0.5654242209548632f, 0.9233813252697523f,
 	0.030805428414380345f,
-	// Elliptic N=8 F/Fs=0.2942270058708415 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9399929092475137f, 1.0f, -0.5338970464107635f, 0.15275612041490338f,
-	1.0f, 1.5969197136380155f, 1.0f, -0.05469592416572276f, 0.45897647453783785f,
-	1.0f, 1.2772311825215688f, 1.0f, 0.36028495972947366f, 0.7395053199627682f,
-	1.0f, 1.1213331577024326f, 1.0f, 0.5699292807825714f, 0.923436899618349f,
-	0.031026603858020696f,
-	// Elliptic N=8 F/Fs=0.2946183953033268 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9402945716486442f, 1.0000000000000002f, -0.5313116687695604f, 0.15217874048495889f,
-	1.0f, 1.5987704119159933f, 0.9999999999999998f, -0.05096722431130905f, 0.4589399129451317f,
-	1.0f, 1.2802559853142783f, 1.0f, 0.3645670610803846f, 0.7396260508442347f,
-	1.0f, 1.1248361679834051f, 1.0f, 0.5744310789459969f, 0.9234929133188433f,
-	0.031249268169422424f,
-	// Elliptic N=8 F/Fs=0.29500978473581213 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9405949525110802f, 0.9999999999999999f, -0.5287224162446166f, 0.15160336737621471f,
-	1.0f, 1.6006148592799399f, 0.9999999999999999f, -0.04723548698650026f, 0.45890590652866975f,
-	1.0f, 1.2832730297449448f, 1.0f, 0.36884851032255017f, 0.7397482375804262f,
-	1.0f, 1.1283315833018939f, 1.0000000000000002f, 0.5789295921262025f, 0.9235493660421054f,
-	0.03147343079406803f,
-	// Elliptic N=8 F/Fs=0.2954011741682975 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.940894057952401f, 0.9999999999999999f, -0.5261292744010733f, 0.1510300098630002f,
-	1.0f, 1.60245307485523f, 1.0000000000000002f, -0.043500714022905916f, 0.4588744613109874f,
-	1.0f, 1.2862823251679152f, 1.0000000000000002f, 0.37312928982936844f, 0.7398718807389649f,
-	1.0f, 1.1318194046170125f, 1.0000000000000002f, 0.5834247970227819f, 0.9236062574571151f,
-	0.0316991012349167f,
-	// Elliptic N=8 F/Fs=0.29579256360078277 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.941191894051455f, 0.9999999999999996f, -0.5235322287489897f, 0.15045867678777164f,
-	1.0f, 1.6042850776970519f, 1.0000000000000002f, -0.039762907289001545f, 0.4588455833368992f,
-	1.0f, 1.2892838809526135f, 1.0f, 0.37740938194590656f, 0.7399969808847988f,
-	1.0f, 1.1352996329379839f, 1.0f, 0.5879166703539146f, 0.9236635872309622f,
-	0.03192628905275058f,
-	// Elliptic N=8 F/Fs=0.2961839530332681 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9414884668486427f, 0.9999999999999999f, -0.5209312647430703f, 0.14988937706158617f,
-	1.0f, 1.6061108867905738f, 1.0000000000000002f, -0.0360220686904323f, 0.4588192786735389f,
-	1.0f, 1.2922777064831563f, 1.0f, 0.38168876898882975f, 0.740123538580183f,
-	1.0f, 1.1387722693237083f, 1.0f, 0.5924051888564293f, 0.9237213550288494f,
-	0.03215500386652388f,
 	// Elliptic N=8 F/Fs=0.2965753424657534 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9417837823461939f, 0.9999999999999999f, -0.5183263677823992f, 0.1493221196645808f,
 	1.0f, 1.6079305210510995f, 0.9999999999999998f, -0.03227820017033555f, 0.4587955534103983f,
 	1.0f, 1.295263811157955f, 1.0f, 0.385967433246317f, 0.740251554384658f,
 	1.0f, 1.1422373148823144f, 0.9999999999999998f, 0.5968903292858522f, 0.9237795605140942f,
 	0.032385255353712845f,
-	// Elliptic N=8 F/Fs=0.29696673189823874 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9420778465084474f, 1.0f, -0.5157175232101616f, 0.14875691364645244f,
-	1.0f, 1.6097439993242393f, 1.0f, -0.028531303709643248f, 0.4587744136593665f,
-	1.0f, 1.2982422043893385f, 0.9999999999999998f, 0.3902453569779934f, 0.7403810288550343f,
-	1.0f, 1.1456947707707361f, 1.0000000000000004f, 0.6013720684164723f, 0.9238382033481288f,
-	0.032617053250669284f,
-	// Elliptic N=8 F/Fs=0.2973581213307241 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.942370665262124f, 1.0000000000000007f, -0.513104716313375f, 0.1481937681269449f,
-	1.0f, 1.611551340386068f, 1.0f, -0.02478138132740513f, 0.45875586555477055f,
-	1.0f, 1.301212895603165f, 1.0f, 0.3945225224148503f, 0.7405119625453701f,
-	1.0f, 1.1491446381942687f, 0.9999999999999999f, 0.6058503830413923f, 0.9238972831905032f,
-	0.03285040735297519f,
-	// Elliptic N=8 F/Fs=0.2977495107632094 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9426622444965975f, 1.0000000000000002f, -0.5104879323226111f, 0.14763269229633846f,
-	1.0f, 1.613352562943292f, 0.9999999999999998f, -0.021028435081102623f, 0.4587399152534134f,
-	1.0f, 1.304175894238444f, 1.0f, 0.39879891175917254f, 0.7406443560069543f,
-	1.0f, 1.1525869184061452f, 1.0f, 0.6103252499725866f, 0.9239567996988861f,
-	0.03308532751580017f,
-	// Elliptic N=8 F/Fs=0.2981409001956947 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.942952590064169f, 1.0000000000000002f, -0.5078671564117191f, 0.14707369541594353f,
-	1.0f, 1.6151476856334184f, 1.0f, -0.01727246706696414f, 0.45872656893461367f,
-	1.0f, 1.3071312097469652f, 1.0f, 0.40307450718446663f, 0.7407782097882868f,
-	1.0f, 1.156021612707106f, 1.0000000000000002f, 0.6147966460409638f, 0.9240167525290669f,
-	0.03332182365426122f,
-	// Elliptic N=8 F/Fs=0.29853228962818 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9432417077803295f, 0.9999999999999996f, -0.5052423736975501f, 0.1465167868185993f,
-	1.0f, 1.616936727024913f, 1.0000000000000002f, -0.013513479420292854f, 0.45871583280024386f,
-	1.0f, 1.310078851592917f, 0.9999999999999997f, 0.40734929083537963f, 0.740913524435057f,
-	1.0f, 1.1594487224449668f, 0.9999999999999997f, 0.6192645480964131f, 0.9240771413349584f,
-	0.0335599057437839f,
-	// Elliptic N=8 F/Fs=0.29892367906066536 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9435296034240304f, 1.0000000000000004f, -0.5026135692396744f, 0.14596197590917537f,
-	1.0f, 1.618719705617375f, 0.9999999999999999f, -0.009751474315781593f, 0.4587077130747688f,
-	1.0f, 1.3130188292525244f, 0.9999999999999998f, 0.4116232448276346f, 0.7410503004901274f,
-	1.0f, 1.1628682490142042f, 1.0f, 0.623728933007872f, 0.9241379657685962f,
-	0.03379958382046685f,
 	// Elliptic N=8 F/Fs=0.2993150684931507 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9438162827379395f, 0.9999999999999999f, -0.49998072804010407f, 0.14540927216507854f,
 	1.0f, 1.6204966398416993f, 0.9999999999999998f, -0.0059864539678424955f, 0.4587022160052852f,
 	1.0f, 1.3159511522136758f, 0.9999999999999999f, 0.4158963512479479f, 0.7411885384935115f,
 	1.0f, 1.1662801938555207f, 1.0000000000000002f, 0.6281897776633734f, 0.9241992254801417f,
 	0.03404086798144756f,
-	// Elliptic N=8 F/Fs=0.299706457925636 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9441017514287111f, 0.9999999999999999f, -0.4973438350430094f, 0.14485868513676384f,
-	1.0f, 1.6222675480602464f, 1.0f, -0.0022184206309301016f, 0.4586993478615584f,
-	1.0f, 1.3188758299755623f, 1.0f, 0.4201685921539632f, 0.7413282389823556f,
-	1.0f, 1.1696845584554336f, 1.0f, 0.632647058970108f, 0.9242609201178836f,
-	0.03428376838527124f,
-	// Elliptic N=8 F/Fs=0.30009784735812134 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.944386015167238f, 1.0f, -0.4947028751344345f, 0.14431022444824854f,
-	1.0f, 1.6240324485670097f, 1.0f, 0.0015526234001311907f, 0.4586991149360607f,
-	1.0f, 1.321792872048316f, 1.0f, 0.42443994957417636f, 0.7414694024909181f,
-	1.0f, 1.173081344345853f, 1.0f, 0.6371007538544801f, 0.9243230493282402f,
-	0.03452829525226124f,
-	// Elliptic N=8 F/Fs=0.3004892367906067 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9446690795889097f, 0.9999999999999994f, -0.4920578331420145f, 0.14376389979763238f,
-	1.0f, 1.6257913595877844f, 0.9999999999999998f, 0.005326675789815915f, 0.45870152354401045f,
-	1.0f, 1.3247022879526515f, 0.9999999999999999f, 0.42871040550786077f, 0.7416120295505498f,
-	1.0f, 1.1764705531036639f, 0.9999999999999998f, 0.6415508392621614f, 0.9243856127557594f,
-	0.034774458864892666f,
-	// Elliptic N=8 F/Fs=0.300880626223092 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9449509502938702f, 0.9999999999999999f, -0.4894086938346877f, 0.14321972095762073f,
-	1.0f, 1.6275442992803384f, 1.0f, 0.009103734161566616f, 0.45870658002340775f,
-	1.0f, 1.327604087219511f, 1.0000000000000002f, 0.4329799419249978f, 0.7417561206896734f,
-	1.0f, 1.1798521863503149f, 0.9999999999999999f, 0.6459972921581497f, 0.9244486100431217f,
-	0.03502226956816722f,
-	// Elliptic N=8 F/Fs=0.30127201565557726 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9452316328472643f, 0.9999999999999997f, -0.48675544192240777f, 0.14267769777605246f,
-	1.0f, 1.6292912857345798f, 1.0f, 0.012883796097462414f, 0.4587142907350724f,
-	1.0f, 1.3304982793897115f, 1.0000000000000002f, 0.43724854076620456f, 0.7419016764337643f,
-	1.0f, 1.183226245751404f, 1.0000000000000002f, 0.6504400895268255f, 0.9245120408311412f,
-	0.03527173776999128f,
-	// Elliptic N=8 F/Fs=0.3016634050880626 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9455111327794936f, 0.9999999999999997f, -0.4840980620558561f, 0.14213784017643294f,
-	1.0f, 1.6310323369727293f, 1.0f, 0.01666685913788158f, 0.45872466206268236f,
-	1.0f, 1.3333848740135967f, 1.0f, 0.4415161839426622f, 0.7420486973053287f,
-	1.0f, 1.186592733016268f, 1.0f, 0.6548792083720075f, 0.9245759047587678f,
-	0.03552287394155603f,
 	// Elliptic N=8 F/Fs=0.30205479452054795 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9457894555864619f, 1.0000000000000002f, -0.4814365388261502f, 0.14160015815847055f,
 	1.0f, 1.6327674709494888f, 1.0000000000000002f, 0.02045292078116488f, 0.45873770041280915f,
 	1.0f, 1.3362638806506897f, 0.9999999999999998f, 0.4457828533360433f, 0.742197183823886f,
 	1.0f, 1.1899516498975757f, 1.0f, 0.6593146257170072f, 0.9246402014630881f,
 	0.03577568861771971f,
-	// Elliptic N=8 F/Fs=0.30244618395303324 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9460666067298202f, 1.0000000000000004f, -0.478770856764552f, 0.1410646617986181f,
-	1.0f, 1.6344967055522146f, 1.0f, 0.024241978483277454f, 0.45875341221495425f,
-	1.0f, 1.3391353088693485f, 1.0f, 0.45004853079844237f, 0.7423471365059446f,
-	1.0f, 1.1933029981909204f, 1.0f, 0.6637463186046874f, 0.9247049305793271f,
-	0.036030192397392566f,
-	// Elliptic N=8 F/Fs=0.3028375733855186 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.946342591637213f, 1.0f, -0.4761010003421737f, 0.1405313612506189f,
-	1.0f, 1.6362200586010882f, 0.9999999999999998f, 0.028034029657468495f, 0.45877180392158684f,
-	1.0f, 1.3419991682464272f, 1.0f, 0.4543131981523067f, 0.7424985558649846f,
-	1.0f, 1.1966467797344167f, 0.9999999999999998f, 0.6681742640975187f, 0.9247700917408502f,
-	0.03628639594392417f,
-	// Elliptic N=8 F/Fs=0.30322896281800393 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9466174157025202f, 1.0f, -0.4734269539696849f, 0.14000026674605767f,
-	1.0f, 1.637937547849289f, 1.0f, 0.031829071673927026f, 0.45879288200817997f,
-	1.0f, 1.3448554683669365f, 1.0f, 0.458576837190363f, 0.7426514424114349f,
-	1.0f, 1.1999829964082984f, 1.0f, 0.6725984392776336f, 0.9248356845791651f,
-	0.03654430998549295f,
-	// Elliptic N=8 F/Fs=0.3036203522504892 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9468910842860956f, 1.0f, -0.47074870199701463f, 0.13947138859491523f,
-	1.0f, 1.6396491909831636f, 1.0f, 0.03562710185943818f, 0.4588166529732449f,
-	1.0f, 1.3477042188237094f, 0.9999999999999999f, 0.4628394296755505f, 0.7428057966526541f,
-	1.0f, 1.2033116501345167f, 0.9999999999999998f, 0.6770188212468833f, 0.9249017087239222f,
-	0.03680394531549826f,
-	// Elliptic N=8 F/Fs=0.30401174168297457 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9471636027150048f, 0.9999999999999998f, -0.4680662287130535f, 0.13894473718612854f,
-	1.0f, 1.6413550056224033f, 0.9999999999999998f, 0.039428117497037486f, 0.45884312333836874f,
-	1.0f, 1.3505454292170689f, 1.0f, 0.4671009573409499f, 0.7429616190929085f,
-	1.0f, 1.206632742876345f, 1.0f, 0.6814353871268946f, 0.924968163802917f,
-	0.03706531279295498f,
-	// Elliptic N=8 F/Fs=0.30440313111545986 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.947434976283264f, 1.0000000000000002f, -0.4653795183453562f, 0.13842032298815565f,
-	1.0f, 1.6430550093202148f, 1.0f, 0.04323211582566057f, 0.4588722996482486f,
-	1.0f, 1.353379109154498f, 1.0f, 0.47136140188971415f, 0.7431189102333506f,
-	1.0f, 1.20994627663798f, 0.9999999999999998f, 0.6858481140591246f, 0.9250350494420925f,
-	0.03732842334289046f,
 	// Elliptic N=8 F/Fs=0.3047945205479452 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9477052102520689f, 1.0f, -0.4626885550598384f, 0.1378981565495443f,
 	1.0f, 1.6447492195634923f, 1.0f, 0.04703909403979509f, 0.45890418847072795f,
 	1.0f, 1.3562052682503136f, 0.9999999999999998f, 0.47562074499500145f, 0.7432776705719996f,
 	1.0f, 1.2132522534641512f, 0.9999999999999999f, 0.6902569792049185f, 0.9251023652655388f,
 	0.037593287956743944f,
-	// Elliptic N=8 F/Fs=0.30518590998043055 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9479743098500324f, 0.9999999999999999f, -0.4599933229604773f, 0.1373782484995071f,
-	1.0f, 1.6464376537729937f, 1.0f, 0.05084904928912626f, 0.4589387963968306f,
-	1.0f, 1.3590239161253423f, 0.9999999999999999f, 0.4798789682999042f, 0.7434379006037191f,
-	1.0f, 1.2165506754397244f, 1.0000000000000002f, 0.694661959745562f, 0.9251701108954961f,
-	0.03785991769276855f,
-	// Elliptic N=8 F/Fs=0.3055772994129159 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9482422802734116f, 0.9999999999999999f, -0.45729380608900594f, 0.13686060954849977f,
-	1.0f, 1.6481203293035143f, 1.0f, 0.05466197867818461f, 0.4589761300407958f,
-	1.0f, 1.3618350624065985f, 1.0000000000000002f, 0.484136053417384f, 0.7435996008201956f,
-	1.0f, 1.2198415446893154f, 1.0000000000000002f, 0.6990630328823417f, 0.9252382859523568f,
-	0.038128323676435684f,
-	// Elliptic N=8 F/Fs=0.3059686888454012 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9485091266863361f, 1.0f, -0.4545899884246102f, 0.13634525048880536f,
-	1.0f, 1.6497972634440587f, 1.0f, 0.058477879265986334f, 0.45901619604011235f,
-	1.0f, 1.364638716726965f, 1.0000000000000002f, 0.4883919819301993f, 0.7437627717099177f,
-	1.0f, 1.2231248633768987f, 0.9999999999999999f, 0.7034601758365959f, 0.925306890054665f,
-	0.03839851710084192f,
-	// Elliptic N=8 F/Fs=0.30636007827788647 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9487748542210355f, 1.0000000000000002f, -0.45188185388361884f, 0.13583218219512302f,
-	1.0f, 1.65146847341802f, 1.0f, 0.06229674806568116f, 0.459059001055554f,
-	1.0f, 1.367434888724881f, 1.0f, 0.4926467353908454f, 0.7439274137581543f,
-	1.0f, 1.226400633705427f, 0.9999999999999998f, 0.7078533658497762f, 0.9253759228191198f,
-	0.038670509227118836f,
-	// Elliptic N=8 F/Fs=0.3067514677103719 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9490394679780625f, 0.9999999999999999f, -0.4491693863191982f, 0.1353214156251616f,
-	1.0f, 1.6531339763833508f, 0.9999999999999999f, 0.06611858204418719f, 0.45910455177121134f,
-	1.0f, 1.3702235880440259f, 0.9999999999999998f, 0.4969002953214822f, 0.7440935274469329f,
-	1.0f, 1.2296688579164416f, 0.9999999999999998f, 0.7122425801834995f, 0.9254453838605771f,
-	0.038944311384844756f,
-	// Elliptic N=8 F/Fs=0.30714285714285716 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9493029730265177f, 0.9999999999999998f, -0.4464525695210439f, 0.1348129618202392f,
-	1.0f, 1.6547937894327391f, 0.9999999999999998f, 0.06994337812182778f, 0.45915285489452723f,
-	1.0f, 1.3730048243330069f, 1.0f, 0.5011526432138653f, 0.7442611132550172f,
-	1.0f, 1.2329295382896912f, 1.0000000000000002f, 0.7166277961196008f, 0.9255152727920488f,
-	0.03921993497245937f,
 	// Elliptic N=8 F/Fs=0.30753424657534245 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9495653744042685f, 1.0f, -0.4437313872150658f, 0.13430683190588624f,
 	1.0f, 1.656447929593786f, 0.9999999999999998f, 0.0737711331719725f, 0.45920391715632897f,
 	1.0f, 1.3757786072450553f, 1.0000000000000002f, 0.5054037605292873f, 0.7444301716578872f,
 	1.0f, 1.2361826771427542f, 1.0000000000000002f, 0.7210089909601959f, 0.9255855892247079f,
 	0.03949739145768126f,
-	// Elliptic N=8 F/Fs=0.3079256360078278 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9498266771181685f, 1.0000000000000004f, -0.4410058230630771f, 0.1338030370924548f,
-	1.0f, 1.658096413829179f, 1.0000000000000002f, 0.07760184402066833f, 0.4592577453108622f,
-	1.0f, 1.378544946437719f, 1.0000000000000002f, 0.5096536286985076f, 0.7446007031277145f,
-	1.0f, 1.2394282768306601f, 1.0f, 0.7253861420277339f, 0.9256563327678867f,
-	0.03977669237792752f,
-	// Elliptic N=8 F/Fs=0.30831702544031314 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9500868861442744f, 1.0000000000000002f, -0.43827586066248164f, 0.13330158867573305f,
-	1.0f, 1.6597392590368676f, 0.9999999999999998f, 0.0814355074462702f, 0.4593143461358226f,
-	1.0f, 1.3813038515725597f, 1.0f, 0.5139022291216871f, 0.7447727081333428f,
-	1.0f, 1.2426663397455127f, 1.0f, 0.7297592266650506f, 0.9257275030290804f,
-	0.04005784934073629f,
-	// Elliptic N=8 F/Fs=0.30870841487279843 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.950346006428063f, 1.0000000000000004f, -0.4355414835459581f, 0.13280249803756455f,
-	1.0f, 1.6613764820502421f, 1.0f, 0.08527212017907114f, 0.4593737264323893f,
-	1.0f, 1.3840553323148521f, 0.9999999999999999f, 0.5181495431683216f, 0.7449461871402646f,
-	1.0f, 1.245896868316113f, 1.0000000000000002f, 0.7341282222354253f, 0.9257990996139488f,
-	0.04034087402419169f,
-	// Elliptic N=8 F/Fs=0.3090998043052837 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9506040428846425f, 0.9999999999999996f, -0.4328026751811395f, 0.13230577664647253f,
-	1.0f, 1.6630080996383072f, 0.9999999999999996f, 0.08911167890093331f, 0.45943589302525606f,
-	1.0f, 1.3867993983332902f, 0.9999999999999999f, 0.5223955521771825f, 0.7451211406105975f,
-	1.0f, 1.2491198650075934f, 1.0f, 0.7384931061226387f, 0.9258711221263151f,
-	0.040625778177351884f,
-	// Elliptic N=8 F/Fs=0.3094911937377691 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.950861000398968f, 0.9999999999999998f, -0.4300594189702976f, 0.13181143605829015f,
-	1.0f, 1.6646341285058608f, 1.0000000000000002f, 0.0929541802449107f, 0.4595008527626645f,
-	1.0f, 1.3895360592996877f, 0.9999999999999998f, 0.5266402374562489f, 0.7452975690030645f,
-	1.0f, 1.252335332321044f, 1.0000000000000002f, 0.7428538557310277f, 0.9259435701681721f,
-	0.0409125736206794f,
-	// Elliptic N=8 F/Fs=0.3098825831702544 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.951116883826046f, 0.9999999999999998f, -0.42731169825002396f, 0.13131948791679626f,
-	1.0f, 1.6662545852936657f, 1.0f, 0.09679962079487166f, 0.45956861251643444f,
-	1.0f, 1.3922653248886867f, 1.0f, 0.530883580282641f, 0.7454754727729691f,
-	1.0f, 1.2555432727931402f, 0.9999999999999998f, 0.747210448485536f, 0.9260164433396785f,
-	0.041201272246473936f,
 	// Elliptic N=8 F/Fs=0.3102739726027397 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9513716979911488f, 1.0000000000000004f, -0.42455949629090395f, 0.13082994395435518f,
 	1.0f, 1.6678694865786332f, 1.0f, 0.10064799708512372f, 0.45963917918199454f,
 	1.0f, 1.3949872047774698f, 1.0f, 0.535125561902563f, 0.745654852372175f,
 	1.0f, 1.258743688995784f, 0.9999999999999998f, 0.751562861831776f, 0.9260897412391652f,
 	0.04149188601930875f,
-	// Elliptic N=8 F/Fs=0.31066536203522505 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9516254476900157f, 1.0000000000000002f, -0.421802796297195f, 0.1303428159925634f,
-	1.0f, 1.6694788488739956f, 1.0000000000000002f, 0.10449930560003291f, 0.45971255967841507f,
-	1.0f, 1.397701708645472f, 1.0f, 0.5393661635312388f, 0.7458357082490815f,
-	1.0f, 1.2619365835357363f, 1.0f, 0.7559110732360826f, 0.9261634634631328f,
-	0.041784426976468926f,
-	// Elliptic N=8 F/Fs=0.3110567514677104 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.951878137689063f, 0.9999999999999998f, -0.4190415814065046f, 0.12985811594290145f,
-	1.0f, 1.6710826886294832f, 1.0f, 0.1083535427736379f, 0.45978876094843674f,
-	1.0f, 1.4004088461740933f, 1.0f, 0.5436053663528435f, 0.7460180408486008f,
-	1.0f, 1.265121959054251f, 1.0000000000000002f, 0.7602550601855654f, 0.9262376096062569f,
-	0.0420789072283926f,
-	// Elliptic N=8 F/Fs=0.3114481409001957 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9521297727255855f, 1.0f, -0.41627583468946f, 0.12937585580739075f,
-	1.0f, 1.6726810222315032f, 1.0f, 0.11221070498926763f, 0.4598677899585017f,
-	1.0f, 1.4031086270464193f, 1.0000000000000002f, 0.5478431515204474f, 0.7462018506121362f,
-	1.0f, 1.2682998182267184f, 1.0f, 0.7645948001881673f, 0.9263121792613859f,
-	0.0423753389591152f,
-	// Elliptic N=8 F/Fs=0.311839530332681 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9523803575079552f, 0.9999999999999996f, -0.4135055391493805f, 0.12889604767925628f,
-	1.0f, 1.6742738660033163f, 1.0f, 0.1160707885791569f, 0.45994965369878305f,
-	1.0f, 1.4058010609469396f, 1.0f, 0.5520795001559541f, 0.7463871379775585f,
-	1.0f, 1.271470163762307f, 1.0f, 0.76893027077272f, 0.9263871720195453f,
-	0.042673734426716355f,
-	// Elliptic N=8 F/Fs=0.3122309197651663 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9526298967158275f, 1.0f, -0.41073067772195093f, 0.1284187037435958f,
-	1.0f, 1.6758612362052123f, 0.9999999999999999f, 0.11993378982405212f, 0.460034359183215f,
-	1.0f, 1.4084861575612713f, 1.0000000000000002f, 0.5563143933500347f, 0.7465739033791826f,
-	1.0f, 1.2746329984036027f, 1.0f, 0.773261449488996f, 0.9264625874699387f,
-	0.04297410596376931f,
-	// Elliptic N=8 F/Fs=0.31262230919765166 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9528783950003326f, 0.9999999999999998f, -0.407951233274886f, 0.12794383627805314f,
-	1.0f, 1.677443149034691f, 0.9999999999999998f, 0.12379970495282677f, 0.4601219134495204f,
-	1.0f, 1.4111639265758835f, 1.0f, 0.5605478121620736f, 0.7467621472477444f,
-	1.0f, 1.2777883249262598f, 1.0000000000000002f, 0.7775883139077696f, 0.9265384251999476f,
-	0.04327646597779384f,
 	// Elliptic N=8 F/Fs=0.313013698630137 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.953125856984278f, 0.9999999999999997f, -0.40516718860760187f, 0.1274714576534988f,
 	1.0f, 1.6790196206266357f, 1.0f, 0.12766853014208215f, 0.4602123235592415f,
 	1.0f, 1.4138343776778226f, 1.0000000000000002f, 0.5647797376200998f, 0.7469518700103768f,
 	1.0f, 1.2809361461386402f, 1.0f, 0.7819108416208654f, 0.9266146847951348f,
 	0.043580826951710984f,
-	// Elliptic N=8 F/Fs=0.31340508806262235 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9533722872623416f, 1.0000000000000002f, -0.4023785264508786f, 0.12700158033471554f,
-	1.0f, 1.680590667053493f, 1.0000000000000002f, 0.13154026151575587f, 0.46030559659776754f,
-	1.0f, 1.416497520554445f, 1.0f, 0.5690101507207345f, 0.7471430720905885f,
-	1.0f, 1.2840764648814695f, 1.0f, 0.7862290102412192f, 0.9266913658392457f,
-	0.04388720144430167f,
-	// Elliptic N=8 F/Fs=0.31379647749510764 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9536176904012634f, 1.0000000000000002f, -0.3995852294665251f, 0.12653421688108976f,
-	1.0f, 1.682156304325449f, 0.9999999999999999f, 0.13541489514472382f, 0.46040173967436226f,
-	1.0f, 1.4191533648931476f, 1.0f, 0.573239032429127f, 0.7473357539082376f,
-	1.0f, 1.2872092840274842f, 0.9999999999999998f, 0.7905427974029294f, 0.9267684679142087f,
-	0.0441956020906677f,
-	// Elliptic N=8 F/Fs=0.31418786692759293 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.953862070940041f, 1.0000000000000004f, -0.3967872802470412f, 0.126069379947309f,
-	1.0f, 1.68371654839061f, 1.0f, 0.13929242704640102f, 0.4605007599221918f,
-	1.0f, 1.421801920381102f, 1.0f, 0.5774663636788976f, 0.747529915879509f,
-	1.0f, 1.2903346064810852f, 0.9999999999999999f, 0.7948521807613169f, 0.9268459906001383f,
-	0.04450604160269554f,
-	// Elliptic N=8 F/Fs=0.31457925636007833 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.954105433390117f, 0.9999999999999998f, -0.39398466131527843f, 0.12560708228406592f,
-	1.0f, 1.685271415135176f, 1.0000000000000002f, 0.14317285318433964f, 0.46060266449835313f,
-	1.0f, 1.4244431967049933f, 1.0f, 0.5816921253720794f, 0.7477255584168911f,
-	1.0f, 1.293452435177993f, 0.9999999999999999f, 0.799157137992975f, 0.9269239334753343f,
-	0.04481853276952335f,
-	// Elliptic N=8 F/Fs=0.3149706457925636 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9543477822355724f, 1.0000000000000002f, -0.3911773551241005f, 0.1251473367387674f,
-	1.0f, 1.6868209203836189f, 0.9999999999999999f, 0.1470561694678236f, 0.4607074605838997f,
-	1.0f, 1.4270772035507542f, 0.9999999999999998f, 0.5859162983790565f, 0.7479226819291522f,
-	1.0f, 1.296562773084901f, 0.9999999999999998f, 0.8034576467958272f, 0.9270022961162853f,
-	0.04513308845801045f,
-	// Elliptic N=8 F/Fs=0.3153620352250489 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9545891219333071f, 1.0000000000000002f, -0.3883653440560386f, 0.1246901562562504f,
-	1.0f, 1.6883650798988636f, 0.9999999999999999f, 0.15094237175146533f, 0.46081515538386775f,
-	1.0f, 1.4297039506033125f, 1.0f, 0.5901388635385109f, 0.7481212868213147f,
-	1.0f, 1.2996656231991386f, 1.0000000000000002f, 0.807753684889183f, 0.9270810780976697f,
-	0.04544972161321058f,
 	// Elliptic N=8 F/Fs=0.31575342465753425 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.954829456913232f, 1.0f, -0.3855486104229483f, 0.12423555387950366f,
 	1.0f, 1.6899039093824626f, 1.0000000000000002f, 0.1548314558347965f, 0.46092575612730424f,
 	1.0f, 1.4323234475463305f, 0.9999999999999998f, 0.594359801657363f, 0.7483213734946329f,
 	1.0f, 1.3027609885483271f, 1.0f, 0.8120452300137933f, 0.9271602789923576f,
 	0.04576844525884722f,
-	// Elliptic N=8 F/Fs=0.3161448140900196 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9550687915784508f, 0.9999999999999998f, -0.38272713646566403f, 0.12378354275039537f,
-	1.0f, 1.6914374244747725f, 1.0000000000000002f, 0.15872341746185695f, 0.46103927006729034f,
-	1.0f, 1.4349357040619533f, 1.0000000000000004f, 0.5985790935107144f, 0.7485229423465677f,
-	1.0f, 1.305848872190044f, 1.0f, 0.8163322599319034f, 0.9272398983714107f,
-	0.04608927249779224f,
-	// Elliptic N=8 F/Fs=0.3165362035225049 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9553071303054435f, 1.0000000000000002f, -0.3799009043536511f, 0.12333413611040783f,
-	1.0f, 1.6929656407551343f, 0.9999999999999999f, 0.1626182523207818f, 0.46115570448096815f,
-	1.0f, 1.4375407298305536f, 1.0f, 0.6027967198417906f, 0.7487259937707614f,
-	1.0f, 1.3089292772114856f, 0.9999999999999999f, 0.8206147524273091f, 0.9273199358040851f,
-	0.046412216512547885f,
-	// Elliptic N=8 F/Fs=0.3169275929549902 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9555444774442459f, 1.0f, -0.37706989618465675f, 0.12288734730137771f,
-	1.0f, 1.6944885737420508f, 1.0f, 0.16651595604338953f, 0.4612750666695655f,
-	1.0f, 1.4401385345304876f, 0.9999999999999997f, 0.6070126613618895f, 0.7489305281570168f,
-	1.0f, 1.3120022067291346f, 1.0f, 0.8248926853054143f, 0.9274003908578327f,
-	0.04673729056573156f,
-	// Elliptic N=8 F/Fs=0.3173189823874756 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.955780837318633f, 0.9999999999999998f, -0.3742340939843583f, 0.12244318976624265f,
-	1.0f, 1.6960062388933614f, 1.0f, 0.170416524204762f, 0.46139736395841974f,
-	1.0f, 1.442729127837844f, 0.9999999999999998f, 0.6112268987503227f, 0.7491365458912689f,
-	1.0f, 1.3150676638884249f, 1.0f, 0.8291660363932841f, 0.9274812630983021f,
-	0.047064508000563214f,
-	// Elliptic N=8 F/Fs=0.31771037181996087 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9560162142262958f, 1.0f, -0.3713934797060151f, 0.12200167704979575f,
-	1.0f, 1.6975186516064213f, 1.0f, 0.17431995232282416f, 0.461522603697002f,
-	1.0f, 1.4453125194261973f, 1.0000000000000004f, 0.6154394126543562f, 0.749344047355561f,
-	1.0f, 1.3181256518634106f, 1.0f, 0.8334347835396968f, 0.9275625520893407f,
-	0.04739388224135634f,
-	// Elliptic N=8 F/Fs=0.31810176125244616 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9562506124390169f, 1.0000000000000002f, -0.3685480352301079f, 0.12156282279944364f,
-	1.0f, 1.6990258272182792f, 1.0f, 0.1782262358579274f, 0.46165079325894126f,
-	1.0f, 1.4478887189663678f, 1.0f, 0.6196501836891667f, 0.7495530329280218f,
-	1.0f, 1.3211761738564416f, 1.0f, 0.8376989046152064f, 0.9276442573929958f,
-	0.04772542679401227f,
 	// Elliptic N=8 F/Fs=0.3184931506849315 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9564840362028484f, 0.9999999999999999f, -0.3656977423639872f, 0.1211266407659741f,
 	1.0f, 1.7005277810058543f, 1.0f, 0.18213537021242232f, 0.4617819400420472f,
 	1.0f, 1.450457736126183f, 1.0000000000000002f, 0.6238591924377792f, 0.7497635029828384f,
 	1.0f, 1.3242192330978322f, 0.9999999999999998f, 0.8419583775121919f, 0.9277263785695156f,
 	0.048059155246516876f,
-	// Elliptic N=8 F/Fs=0.31888454011741685 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.956716489738286f, 0.9999999999999999f, -0.3628425828415153f, 0.12069314480432863f,
-	1.0f, 1.702024528186112f, 0.9999999999999999f, 0.18604735073023299f, 0.4619160514683334f,
-	1.0f, 1.4530195805702326f, 1.0f, 0.6280664194510158f, 0.7499754578902323f,
-	1.0f, 1.327254832845537f, 1.0f, 0.8462131801449158f, 0.9278089151773528f,
-	0.048395081269440796f,
-	// Elliptic N=8 F/Fs=0.31927592954990214 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9569479772404401f, 0.9999999999999997f, -0.35998253832270805f, 0.1202623488743823f,
-	1.0f, 1.7035160839162429f, 1.0000000000000002f, 0.18996217269642734f, 0.46205313498403794f,
-	1.0f, 1.4555742619596366f, 0.9999999999999996f, 0.6322718452474413f, 0.7501888980164346f,
-	1.0f, 1.3302829763848256f, 1.0f, 0.8504632904495745f, 0.9278918667731624f,
-	0.04873321861644269f,
-	// Elliptic N=8 F/Fs=0.3196673189823875 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.95717850287921f, 1.0000000000000002f, -0.35711759039337077f, 0.11983426704172966f,
-	1.0f, 1.7050024632938385f, 1.0000000000000002f, 0.19387983133679126f, 0.462193198059648f,
-	1.0f, 1.4581217899518113f, 0.9999999999999999f, 0.6364754503133145f, 0.75040382372366f,
-	1.0f, 1.3333036670279659f, 0.9999999999999997f, 0.8547086863843594f, 0.9279752329118057f,
-	0.04907358112477622f,
-	// Elliptic N=8 F/Fs=0.3200587084148728 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9574080707994497f, 0.9999999999999999f, -0.35424772056473897f, 0.11940891347847818f,
-	1.0f, 1.7064836813570687f, 1.0000000000000002f, 0.1978003218173917f, 0.4623362481899186f,
-	1.0f, 1.4606621742002353f, 1.0f, 0.640677215102534f, 0.7506202353700822f,
-	1.0f, 1.3363169081139001f, 1.0000000000000002f, 0.8589493459295101f, 0.9280590131463526f,
-	0.049416182715799055f,
-	// Elliptic N=8 F/Fs=0.3204500978473581 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9576366851211429f, 1.0000000000000002f, -0.35137291027311196f, 0.11898630246404841f,
-	1.0f, 1.707959753084859f, 1.0f, 0.20172363924414288f, 0.4624822928938947f,
-	1.0f, 1.4631954243542193f, 1.0f, 0.6448771200365856f, 0.7508381333098074f,
-	1.0f, 1.3393227030079269f, 1.0f, 0.8631852470873678f, 0.9281432070280802f,
-	0.049761037395486464f,
-	// Elliptic N=8 F/Fs=0.32084148727984346 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.957864349939563f, 0.9999999999999998f, -0.3484931408794901f, 0.11856644838598085f,
-	1.0f, 1.7094306933970655f, 1.0f, 0.20564977866236714f, 0.4626313397149316f,
-	1.0f, 1.46572155005868f, 1.0000000000000002f, 0.6490751455044916f, 0.7510575178928509f,
-	1.0f, 1.3423210551013847f, 0.9999999999999999f, 0.86741636788243f, 0.9282278141064757f,
-	0.05010815925494674f,
 	// Elliptic N=8 F/Fs=0.3212328767123288 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9580910693254472f, 1.0000000000000002f, -0.3456083936692022f, 0.11814936574074965f,
 	1.0f, 1.7108965171546537f, 1.0f, 0.20957873505636015f, 0.46278339622071446f,
 	1.0f, 1.468240560953913f, 1.0000000000000002f, 0.6532712718627643f, 0.7512783894651087f,
 	1.0f, 1.3453119678113408f, 0.9999999999999998f, 0.8716426863614111f, 0.9283128339292391f,
 	0.050457562470941346f,
-	// Elliptic N=8 F/Fs=0.3216242661448141 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9583168473251529f, 0.9999999999999998f, -0.34271864985154155f, 0.11773506913458397f,
-	1.0f, 1.7123572391598714f, 0.9999999999999998f, 0.21351050334894153f, 0.4629384700032782f,
-	1.0f, 1.4707524666753677f, 1.0f, 0.6574654794353489f, 0.7515007483683342f,
-	1.0f, 1.3482954445802728f, 1.0f, 0.8758641805932894f, 0.9283982660422827f,
-	0.05080926130640693f,
-	// Elliptic N=8 F/Fs=0.3220156555772994 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9585416879608286f, 0.9999999999999998f, -0.33982389055939066f, 0.11732357328429577f,
-	1.0f, 1.7138128741564298f, 1.0000000000000002f, 0.21744507840101737f, 0.46309656867902627f,
-	1.0f, 1.4732572768534298f, 1.0f, 0.6616577485135815f, 0.7517245949401103f,
-	1.0f, 1.351271488875762f, 0.9999999999999999f, 0.8800808286693697f, 0.9284841099897324f,
-	0.05116327011098182f,
-	// Elliptic N=8 F/Fs=0.3224070450097848 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9587655952305716f, 1.0f, -0.3369240968488498f, 0.1169148930181152f,
-	1.0f, 1.7152634368296742f, 1.0f, 0.22138245501113032f, 0.4632576998887477f,
-	1.0f, 1.4757550011131977f, 1.0000000000000002f, 0.6658480593561363f, 0.7519499295138266f,
-	1.0f, 1.3542401041901837f, 0.9999999999999999f, 0.8842926087033351f, 0.9285703653139309f,
-	0.05151960332153512f,
-	// Elliptic N=8 F/Fs=0.3227984344422701 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.958988573108589f, 1.0f, -0.33401924969886465f, 0.11650904327653355f,
-	1.0f, 1.716708941806764f, 1.0000000000000002f, 0.2253226279150088f, 0.4634218712976383f,
-	1.0f, 1.478245649074264f, 0.9999999999999997f, 0.6700363921889758f, 0.7521767524186478f,
-	1.0f, 1.3572012940403957f, 1.0f, 0.8884994988313013f, 0.9286570315554381f,
-	0.051878275462699075f,
-	// Elliptic N=8 F/Fs=0.32318982387475537 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9592106255453594f, 1.0000000000000002f, -0.3311093300108465f, 0.11610603911315238f,
-	1.0f, 1.7181494036568457f, 1.0f, 0.2292655917851195f, 0.4635890905953138f,
-	1.0f, 1.4807292303505049f, 1.0f, 0.6742227272053068f, 0.7524050639794941f,
-	1.0f, 1.3601550619674365f, 1.0f, 0.8927014772118737f, 0.9287441082530324f,
-	0.05223930114740551f,
-	// Elliptic N=8 F/Fs=0.3235812133072407 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9594317564677894f, 1.0f, -0.3281943186082962f, 0.1157058956955415f,
-	1.0f, 1.7195848368912312f, 0.9999999999999998f, 0.2332113412302113f, 0.4637593654958309f,
-	1.0f, 1.4832057545498618f, 1.0000000000000004f, 0.6784070445655319f, 0.7526348645170102f,
-	1.0f, 1.3631014115362199f, 0.9999999999999999f, 0.8968985220262028f, 0.9288315949437118f,
-	0.052602695077425154f,
 	// Elliptic N=8 F/Fs=0.32397260273972606 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9596519697793713f, 0.9999999999999997f, -0.3252741962364237f, 0.1153086283061031f,
 	1.0f, 1.7210152559635707f, 1.0f, 0.23715987079486012f, 0.4639327037376998f,
 	1.0f, 1.4856752312741306f, 0.9999999999999999f, 0.6825893243972014f, 0.7528661543475405f,
 	1.0f, 1.3660403463352329f, 1.0f, 0.9010906114780383f, 0.9289194911626973f,
 	0.052968472043910066f,
-	// Elliptic N=8 F/Fs=0.32436399217221135 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9598712693603397f, 0.9999999999999999f, -0.3223489435617685f, 0.11491425234294458f,
-	1.0f, 1.7224406752700274f, 1.0f, 0.24111117495900686f, 0.4641091130839032f,
-	1.0f, 1.4881376701187534f, 0.9999999999999996f, 0.6867695467949669f, 0.7530989337831032f,
-	1.0f, 1.368971869976232f, 1.0f, 0.9052777237937824f, 0.9290077964434302f,
-	0.053336646927940184f,
-	// Elliptic N=8 F/Fs=0.32475538160469664 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9600896590678243f, 1.0000000000000002f, -0.31941854117181306f, 0.11452278332075794f,
-	1.0f, 1.7238611091494556f, 1.0000000000000002f, 0.2450652481375031f, 0.46428860132190886f,
-	1.0f, 1.4905930806726109f, 0.9999999999999999f, 0.6909476918205387f, 0.7533332031313621f,
-	1.0f, 1.3718959860939497f, 1.0f, 0.9094598372225507f, 0.929096510317579f,
-	0.05370723470107297f,
-	// Elliptic N=8 F/Fs=0.32514677103718204 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9603071427360035f, 1.0f, -0.3164829695745999f, 0.11413423687170757f,
-	1.0f, 1.725276571883572f, 0.9999999999999998f, 0.2490220846796425f, 0.46447117626368645f,
-	1.0f, 1.4930414725178134f, 1.0f, 0.6951237395026391f, 0.7535689626956024f,
-	1.0f, 1.3748126983457931f, 1.0f, 0.9136369300362236f, 0.9291856323150367f,
-	0.05408025042589657f,
-	// Elliptic N=8 F/Fs=0.3255381604696673 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9605237241762585f, 0.9999999999999998f, -0.3135422091983456f, 0.11374862874632552f,
-	1.0f, 1.7266870776971337f, 1.0000000000000002f, 0.2529816788686959f, 0.46465684574572f,
-	1.0f, 1.4954828552294994f, 0.9999999999999999f, 0.6992976698369543f, 0.7538062127747003f,
-	1.0f, 1.3777220104115484f, 1.0000000000000002f, 0.9178089805294993f, 0.9292751619639221f,
-	0.05445570925658628f,
-	// Elliptic N=8 F/Fs=0.3259295499021526 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.960739407177323f, 1.0f, -0.31059624039104977f, 0.1133659748144145f,
-	1.0f, 1.728092640758108f, 1.0000000000000004f, 0.256944024921445f, 0.46484561762902327f,
-	1.0f, 1.4979172383756343f, 1.0f, 0.7034694627860979f, 0.7540449536630999f,
-	1.0f, 1.380623925993088f, 0.9999999999999998f, 0.9219759670199548f, 0.9293650987905849f,
-	0.05483362643946485f,
-	// Elliptic N=8 F/Fs=0.32632093933463796 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.960954195505431f, 1.0000000000000002f, -0.30764504342010596f, 0.1129862910659587f,
-	1.0f, 1.7294932751778507f, 1.0f, 0.2609091169877103f, 0.4650374997991495f,
-	1.0f, 1.500344631516808f, 1.0000000000000002f, 0.7076390982795608f, 0.7542851856507833f,
-	1.0f, 1.38351844881408f, 0.9999999999999998f, 0.9261378678480978f, 0.9294554423196035f,
-	0.055214017313566344f,
 	// Elliptic N=8 F/Fs=0.3267123287671233 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9611680929044688f, 0.9999999999999999f, -0.30468859847191015f, 0.1126095936120432f,
 	1.0f, 1.7308889950112785f, 0.9999999999999999f, 0.26487694914987947f, 0.4652325001662083f,
 	1.0f, 1.5027650442060376f, 0.9999999999999998f, 0.7118065562136731f, 0.7545269090232448f,
 	1.0f, 1.3864055826196946f, 1.0000000000000002f, 0.9302946613774227f, 0.9295461920737872f,
 	0.05559689731120328f,
-	// Elliptic N=8 F/Fs=0.3271037181996086 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9613811030961203f, 0.9999999999999999f, -0.3017268856514668f, 0.11223589868578068f,
-	1.0f, 1.7322798142570413f, 1.0f, 0.2688475154224287f, 0.4654306266648736f,
-	1.0f, 1.505178485988572f, 0.9999999999999996f, 0.7159718164515565f, 0.7547701240614629f,
-	1.0f, 1.3892853311763145f, 0.9999999999999998f, 0.9344463259944636f, 0.9296373475741786f,
-	0.055982281958537224f,
-	// Elliptic N=8 F/Fs=0.32749510763209394 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9615932297800136f, 0.9999999999999997f, -0.2987598849819922f, 0.11186522264324665f,
-	1.0f, 1.733665746857697f, 0.9999999999999999f, 0.27282080975144885f, 0.46563188725439664f,
-	1.0f, 1.507584966401696f, 0.9999999999999998f, 0.7201348588230895f, 0.7550148310418745f,
-	1.0f, 1.3921576982712525f, 1.0f, 0.9385928401088552f, 0.9297289083400546f,
-	0.056370186876153944f,
-	// Elliptic N=8 F/Fs=0.32788649706457923 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9618044766338667f, 1.0f, -0.2957875764045166f, 0.11149758196442239f,
-	1.0f, 1.7350468066998854f, 1.0000000000000004f, 0.27679682601416394f, 0.46583628991861614f,
-	1.0f, 1.5099844949745385f, 1.0000000000000002f, 0.7242956631248614f, 0.7552610302363452f,
-	1.0f, 1.3950226877124616f, 0.9999999999999999f, 0.9427341821533842f, 0.9298208738889273f,
-	0.056760627779641054f,
-	// Elliptic N=8 F/Fs=0.3282778864970646 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9620148473136294f, 0.9999999999999998f, -0.2928099397774868f, 0.1111329932541471f,
-	1.0f, 1.7364230076144975f, 0.9999999999999999f, 0.2807755580184462f, 0.4660438426659683f,
-	1.0f, 1.51237708122788f, 1.0000000000000002f, 0.7284542091201338f, 0.7555087219121429f,
-	1.0f, 1.3978803033282523f, 1.0f, 0.9468703305840439f, 0.9299132437365447f,
-	0.05715362048016984f,
-	// Elliptic N=8 F/Fs=0.3286692759295499 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9622243454536297f, 1.0000000000000002f, -0.289826954876364f, 0.11077147324307751f,
-	1.0f, 1.7377943633768531f, 0.9999999999999998f, 0.28475699950233346f, 0.4662545535294963f,
-	1.0f, 1.514762734673966f, 1.0000000000000002f, 0.7326104765387997f, 0.7557579063319111f,
-	1.0f, 1.40073054896701f, 1.0f, 0.9510012638800929f, 0.9300060173968947f,
-	0.057549180885080875f,
-	// Elliptic N=8 F/Fs=0.32906066536203527 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9624329746667106f, 0.9999999999999999f, -0.2868386013932216f, 0.11041303878865635f,
-	1.0f, 1.7391608877068692f, 1.0000000000000002f, 0.28874114413353835f, 0.4664684305668585f,
-	1.0f, 1.5171414648163175f, 1.0000000000000002f, 0.7367644450773444f, 0.7560085837536392f,
-	1.0f, 1.403573428496915f, 1.0000000000000004f, 0.9551269605441073f, 0.9300991943822037f,
-	0.057947324998473076f,
 	// Elliptic N=8 F/Fs=0.32945205479452055 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9626407385443765f, 0.9999999999999998f, -0.283844858936339f, 0.11005770687608916f,
 	1.0f, 1.7405225942692326f, 0.9999999999999999f, 0.29272798550896234f, 0.46668548186033726f,
 	1.0f, 1.5195132811495473f, 0.9999999999999999f, 0.7409160943988087f, 0.7562607544306352f,
 	1.0f, 1.4064089458056621f, 0.9999999999999998f, 0.9592473991020395f, 0.9301927742029394f,
 	0.05834806892179688f,
-	// Elliptic N=8 F/Fs=0.32984344422700584 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9628476406569277f, 0.9999999999999998f, -0.2808457070297963f, 0.10970549461932964f,
-	1.0f, 1.7418794966735747f, 1.0000000000000002f, 0.2967175171542f, 0.46690571551684595f,
-	1.0f, 1.5218781931591758f, 1.0f, 0.7450654041327481f, 0.7565144186114983f,
-	1.0f, 1.409237104800187f, 1.0f, 0.9633625581032714f, 0.9302867563678112f,
-	0.058751428854450706f,
-	// Elliptic N=8 F/Fs=0.33023483365949124 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.963053684553602f, 1.0000000000000004f, -0.27784112511306513f, 0.10935641926207404f,
-	1.0f, 1.743231608474639f, 1.0000000000000002f, 0.30070973252304417f, 0.4671291396679357f,
-	1.0f, 1.5242362103214482f, 0.9999999999999996f, 0.749212353875199f, 0.7567695765400905f,
-	1.0f, 1.412057909406385f, 1.0f, 0.9674724161206723f, 0.9303811403837743f,
-	0.05915742109438152f,
-	// Elliptic N=8 F/Fs=0.33062622309197653 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9632588737627084f, 1.0f, -0.27483109254060134f, 0.1090104981787642f,
-	1.0f, 1.7445789431724537f, 0.9999999999999998f, 0.3047046249969874f, 0.46735576246980115f,
-	1.0f, 1.5265873421031548f, 1.0f, 0.7533569231886366f, 0.7570262284555082f,
-	1.0f, 1.4148713635688395f, 0.9999999999999998f, 0.9715769517506482f, 0.9304759257560253f,
-	0.05956606203868887f,
-	// Elliptic N=8 F/Fs=0.3310176125244618 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9634632117917685f, 1.0000000000000004f, -0.27181558858142907f, 0.10866774887559867f,
-	1.0f, 1.7459215142125053f, 1.0000000000000002f, 0.3087021878847239f, 0.46758559210328704f,
-	1.0f, 1.5289315979614526f, 0.9999999999999998f, 0.7574990916019433f, 0.7572843745920533f,
-	1.0f, 1.4176774712505513f, 1.0f, 0.9756761436132063f, 0.93057111198801f,
-	0.059977368184233486f,
-	// Elliptic N=8 F/Fs=0.33140900195694717 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.963666702127646f, 0.9999999999999998f, -0.2687945924187286f, 0.10832818899155398f,
-	1.0f, 1.747259334985904f, 0.9999999999999997f, 0.3127024144216463f, 0.46781863677389135f,
-	1.0f, 1.5312689873436898f, 1.0000000000000002f, 0.7616388386103731f, 0.7575440151792067f,
-	1.0f, 1.4204762364326637f, 1.0f, 0.9797699703520066f, 0.9306666985814223f,
-	0.06039135612824896f,
-	// Elliptic N=8 F/Fs=0.3318003913894325 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9638693482366865f, 0.9999999999999996f, -0.26576808314942263f, 0.107991836299414f,
-	1.0f, 1.7485924188295594f, 1.0000000000000002f, 0.3167052977693368f, 0.46805490471177125f,
-	1.0f, 1.533599519687227f, 0.9999999999999998f, 0.7657761436755123f, 0.7578051504415972f,
-	1.0f, 1.4232676631141958f, 1.0f, 0.9838584106344136f, 0.9307626850362025f,
-	0.0608080425689575f,
 	// Elliptic N=8 F/Fs=0.3321917808219178 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9640711535648467f, 1.0000000000000002f, -0.2627360397837561f, 0.10765870870680888f,
 	1.0f, 1.7499207790263456f, 1.0000000000000002f, 0.3207108310150646f, 0.4682944041717443f,
 	1.0f, 1.535923204419269f, 0.9999999999999998f, 0.7699109862252506f, 0.7580677805989752f,
 	1.0f, 1.426051755311774f, 1.0000000000000002f, 0.987941443151559f, 0.9308590708505439f,
 	0.06122744430618985f,
-	// Elliptic N=8 F/Fs=0.3325831702544031 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9642721215378258f, 1.0000000000000002f, -0.25969844124487834f, 0.107328824257263f,
-	1.0f, 1.7512444288052744f, 0.9999999999999999f, 0.3247190071712711f, 0.4685371434332931f,
-	1.0f, 1.5382400509566898f, 1.0f, 0.7740433456537436f, 0.7583319058661814f,
-	1.0f, 1.4288285170593646f, 0.9999999999999996f, 0.9920190466183929f, 0.9309558555208903f,
-	0.06164957824200919f,
-	// Elliptic N=8 F/Fs=0.3329745596868885 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9644722555612f, 1.0000000000000002f, -0.25665526636842106f, 0.1070022011312518f,
-	1.0f, 1.7525633813416646f, 0.9999999999999999f, 0.3287298191750607f, 0.46878313080056594f,
-	1.0f, 1.5405500687058635f, 1.0000000000000004f, 0.7781732013213827f, 0.7585975264531202f,
-	1.0f, 1.4315979524080138f, 1.0f, 0.9960911997737433f, 0.9310530385419398f,
-	0.06207446138133848f,
-	// Elliptic N=8 F/Fs=0.3333659491193738 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.96467155902055f, 1.0000000000000004f, -0.2536064939020778f, 0.10667885764726909f,
-	1.0f, 1.7538776497573079f, 1.0000000000000002f, 0.33274325988767955f, 0.46903237460237857f,
-	1.0f, 1.5428532670624937f, 0.9999999999999999f, 0.7823005325547593f, 0.7588646425647305f,
-	1.0f, 1.4343600654255748f, 1.0000000000000002f, 1.0001578813803647f, 0.9311506194066436f,
-	0.06250211083259213f,
-	// Elliptic N=8 F/Fs=0.3337573385518591 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9648700352815898f, 0.9999999999999998f, -0.2505521025051759f, 0.10635881226290232f,
-	1.0f, 1.7551872471206404f, 1.0000000000000002f, 0.3367593220940045f, 0.4692848831922145f,
-	1.0f, 1.5451496554114528f, 0.9999999999999999f, 0.7864253186466369f, 0.7591332544009546f,
-	1.0f, 1.4371148601964572f, 1.0000000000000002f, 1.0042190702250027f, 0.931248597606209f,
-	0.06293254380831192f,
-	// Elliptic N=8 F/Fs=0.3341487279843444 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.965067687690298f, 0.9999999999999998f, -0.24749207074825166f, 0.10604208357591875f,
-	1.0f, 1.7564921864469103f, 0.9999999999999998f, 0.34077799850201806f, 0.46954066494822516f,
-	1.0f, 1.5474392431266109f, 1.0f, 0.7905475388559184f, 0.759403362156711f,
-	1.0f, 1.4398623408213604f, 0.9999999999999998f, 1.008274745118445f, 0.9313469726301016f,
-	0.0633657776258068f,
-	// Elliptic N=8 F/Fs=0.33454011741682976 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9652645195730403f, 1.0000000000000002f, -0.24442637711262308f, 0.10572869032536025f,
-	1.0f, 1.7577924806983463f, 1.0f, 0.3447992817422835f, 0.469799728273228f,
-	1.0f, 1.5497220395706741f, 1.0f, 0.7946671724076129f, 0.7596749660218642f,
-	1.0f, 1.4426025114170171f, 1.0f, 1.012324884895578f, 0.9314457439660444f,
-	0.06380182970779595f,
 	// Elliptic N=8 F/Fs=0.33493150684931505 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9654605342366964f, 0.9999999999999998f, -0.24135499998995683f, 0.10541865139264846f,
 	1.0f, 1.7590881427843235f, 0.9999999999999997f, 0.3488231643674243f, 0.470062081594706f,
 	1.0f, 1.5519980540950244f, 0.9999999999999999f, 0.7987841984928125f, 0.7599480661811959f,
 	1.0f, 1.4453353761159358f, 1.0000000000000002f, 1.0163694684154423f, 0.9315449111000209f,
 	0.06424071758305758f,
-	// Elliptic N=8 F/Fs=0.3353228962818004 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9656557349687895f, 0.9999999999999998f, -0.23827791768183706f, 0.10511198580269933f,
-	1.0f, 1.7603791855615343f, 1.0000000000000002f, 0.3528496388515921f, 0.47032773336480405f,
-	1.0f, 1.554267296039559f, 1.0f, 0.8028985962686584f, 0.7602226628143758f,
-	1.0f, 1.4480609390661456f, 0.9999999999999997f, 1.0204084745612914f, 0.9316444735162743f,
-	0.06468245888708056f,
-	// Elliptic N=8 F/Fs=0.3357142857142857 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9658501250376048f, 1.0000000000000002f, -0.23519510839933416f, 0.10480871272504819f,
-	1.0f, 1.76166562183415f, 0.9999999999999998f, 0.35687869758993346f, 0.4705966920603254f,
-	1.0f, 1.5565297747325284f, 1.0000000000000002f, 0.8070103448583119f, 0.7604987560959293f,
-	1.0f, 1.4507792044309433f, 1.0f, 1.0244418822406436f, 0.9317444306973126f,
-	0.06512707136272021f,
-	// Elliptic N=8 F/Fs=0.33610567514677103 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9660437076923143f, 1.0000000000000002f, -0.23210655026256413f, 0.10450885147498377f,
-	1.0f, 1.7629474643539935f, 0.9999999999999998f, 0.36091033289806174f, 0.47086896618272944f,
-	1.0f, 1.5587854994903834f, 1.0f, 0.8111194233509307f, 0.7607763461952113f,
-	1.0f, 1.4534901763886388f, 1.0000000000000002f, 1.0284696703853415f, 0.9318447821239058f,
-	0.06557457286085921f,
-	// Elliptic N=8 F/Fs=0.3364970645792564 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9662364861631005f, 1.0f, -0.2290122213002541f, 0.10421242151469348f,
-	1.0f, 1.7642247258207018f, 0.9999999999999998f, 0.36494453701151647f, 0.4711445642581248f,
-	1.0f, 1.5610344796176188f, 1.0f, 0.8152258108016404f, 0.7610554332763748f,
-	1.0f, 1.4561938591323058f, 0.9999999999999999f, 1.0324918179516078f, 0.9319455272750901f,
-	0.06602498134107176f,
-	// Elliptic N=8 F/Fs=0.3368884540117417 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.966428463661277f, 1.0f, -0.22591209944930246f, 0.10391944245441817f,
-	1.0f, 1.7654974188818924f, 1.0f, 0.3689813020852262f, 0.4714234948372643f,
-	1.0f, 1.5632767244066177f, 1.0f, 0.8193294862315055f, 0.7613360174983403f,
-	1.0f, 1.4588902568695337f, 1.0f, 1.0365083039200989f, 0.9320466656281667f,
-	0.06647831487229251f,
-	// Elliptic N=8 F/Fs=0.337279843444227 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9666196433794076f, 1.0000000000000002f, -0.22280616255433844f, 0.10362993405361769f,
-	1.0f, 1.7667655561333289f, 0.9999999999999998f, 0.3730206201929628f, 0.471705766495539f,
-	1.0f, 1.565512243137499f, 1.0f, 0.8234304286275056f, 0.7616180990147667f,
-	1.0f, 1.4615793738221747f, 1.0000000000000002f, 1.0405191072959612f, 0.9321481966587064f,
-	0.0669345916334893f,
 	// Elliptic N=8 F/Fs=0.3376712328767123 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9668100284914263f, 1.0f, -0.2196943883672737f, 0.1033439162221458f,
 	1.0f, 1.7680291501190883f, 1.0f, 0.37706248332680636f, 0.4719913878329706f,
 	1.0f, 1.5677410450779707f, 1.0000000000000002f, 0.8275286169425153f, 0.7619016779740214f,
 	1.0f, 1.464261214226105f, 1.0000000000000002f, 1.044524207108894f, 0.9322501198405475f,
 	0.06739382991434088f,
-	// Elliptic N=8 F/Fs=0.3380626223091977 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9669996221527568f, 1.0000000000000002f, -0.2165767545468629f, 0.10306140902143723f,
-	1.0f, 1.7692882133317234f, 1.0000000000000002f, 0.3811068833965894f, 0.4722803674742026f,
-	1.0f, 1.5699631394831746f, 1.0f, 0.8316240300952731f, 0.7621867545191485f,
-	1.0f, 1.4669357823309737f, 1.0000000000000002f, 1.0485235824131984f, 0.9323524346458001f,
-	0.0678560481159185f,
-	// Elliptic N=8 F/Fs=0.338454011741683 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.967188427500428f, 1.0000000000000002f, -0.2134532386582573f, 0.10278243266570394f,
-	1.0f, 1.770542758212426f, 1.0f, 0.3851538122293468f, 0.47257271406849144f,
-	1.0f, 1.5721785355955415f, 1.0f, 0.835716646970357f, 0.7624733287878396f,
-	1.0f, 1.4696030823999595f, 0.9999999999999996f, 1.052517212287832f, 0.9324551405448445f,
-	0.06832126475137094f,
-	// Elliptic N=8 F/Fs=0.3388454011741683 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9673764476531923f, 1.0000000000000002f, -0.2103238181725488f, 0.1025070075231427f,
-	1.0f, 1.771792797151196f, 1.0f, 0.3892032615687734f, 0.47286843628969827f,
-	1.0f, 1.574387242644646f, 1.0f, 0.8398064464181724f, 0.7627614009124041f,
-	1.0f, 1.472263118709536f, 1.0f, 1.056505075836476f, 0.9325582370063352f,
-	0.06878949844661643f,
-	// Elliptic N=8 F/Fs=0.3392367906066536 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.967563685711641f, 1.0000000000000002f, -0.20718847046632632f, 0.10223515411715331f,
-	1.0f, 1.7730383424870007f, 1.0f, 0.393255223074659f, 0.47316754283627616f,
-	1.0f, 1.576589269847059f, 1.0f, 0.8438934072549189f, 0.7630509710197371f,
-	1.0f, 1.4749158955492216f, 0.9999999999999998f, 1.0604871521875816f, 0.9326617234972002f,
-	0.06926076794103626f,
-	// Elliptic N=8 F/Fs=0.33962818003913897 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9677501447583179f, 0.9999999999999998f, -0.20404717282122065f, 0.10196689312756793f,
-	1.0f, 1.774279406507939f, 0.9999999999999999f, 0.3973096883223343f, 0.4734700424312589f,
-	1.0f, 1.5787846264062055f, 1.0000000000000002f, 0.8479775082625738f, 0.7633420392312885f,
-	1.0f, 1.477561417221346f, 1.0f, 1.0644634204944299f, 0.9327655994826435f,
-	0.06973509208817393f,
-	// Elliptic N=8 F/Fs=0.34001956947162426 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.967935827857836f, 1.0f, -0.20089990242345132f, 0.10170224539189146f,
-	1.0f, 1.7755160014514053f, 1.0000000000000002f, 0.4013666488021095f, 0.47377594382224986f,
-	1.0f, 1.5809733215122208f, 0.9999999999999999f, 0.8520587281888695f, 0.7636346056630342f,
-	1.0f, 1.4801996880408108f, 1.0000000000000002f, 1.068433859935187f, 0.9328698644261461f,
-	0.07021248985643916f,
 	// Elliptic N=8 F/Fs=0.34041095890410955 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9681207380569874f, 1.0000000000000002f, -0.19774663636336592f, 0.101441231906552f,
 	1.0f, 1.7767481395042513f, 1.0f, 0.4054260959187158f, 0.4740852557814068f,
 	1.0f, 1.5831553643418155f, 1.0000000000000002f, 0.8561370457472788f, 0.7639286704254424f,
 	1.0f, 1.4828307123348548f, 0.9999999999999998f, 1.072398449712966f, 0.9329745177894659f,
 	0.07069298032981618f,
-	// Elliptic N=8 F/Fs=0.34080234833659495 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9683048783848571f, 1.0f, -0.19458735163498642f, 0.10118387382816449f,
-	1.0f, 1.777975832802949f, 0.9999999999999999f, 0.4094880209907351f, 0.47439798710542924f,
-	1.0f, 1.5853307640581293f, 1.0f, 0.8602124396169915f, 0.7642242336234465f,
-	1.0f, 1.4854544944428203f, 0.9999999999999998f, 1.076357169055879f, 0.9330795590326428f,
-	0.07117658270857592f,
-	// Elliptic N=8 F/Fs=0.34119373776908024 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9684882518529347f, 1.0f, -0.19142202513555098f, 0.10093019247480432f,
-	1.0f, 1.77919909343375f, 1.0000000000000002f, 0.4135524152500284f, 0.474714146615542f,
-	1.0f, 1.587499529810596f, 1.0000000000000002f, 0.8642848884428923f, 0.7645212953564098f,
-	1.0f, 1.4880710387159137f, 1.0f, 1.080309997217089f, 0.933184987613995f,
-	0.07166331630999305f,
-	// Elliptic N=8 F/Fs=0.34158512720156553 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9686708614552246f, 1.0f, -0.18825063366504463f, 0.10068020932729209f,
-	1.0f, 1.78041793343285f, 1.0f, 0.4176192698411747f, 0.47503374315747954f,
-	1.0f, 1.5896616707348095f, 0.9999999999999999f, 0.8683543708355536f, 0.7648198557180961f,
-	1.0f, 1.4906803495169814f, 0.9999999999999998f, 1.0842569134748798f, 0.9332908029901243f,
-	0.07215320056906825f,
-	// Elliptic N=8 F/Fs=0.3419765166340509 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9688527101683555f, 1.0000000000000002f, -0.18507315392574197f, 0.10043394603049126f,
-	1.0f, 1.7816323647865484f, 1.0000000000000002f, 0.42168857582088887f, 0.4753567856014692f,
-	1.0f, 1.5918171959523875f, 1.0000000000000002f, 0.8724208653712102f, 0.7651199147966387f,
-	1.0f, 1.4932824312202757f, 1.0f, 1.088197897132702f, 0.9333970046159152f,
-	0.0726462550392544f,
-	// Elliptic N=8 F/Fs=0.3423679060665362 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.969033800951688f, 0.9999999999999998f, -0.18188956252173977f, 0.10019142439461654f,
-	1.0f, 1.7828423994314075f, 1.0f, 0.42576032415744697f, 0.47568328284221273f,
-	1.0f, 1.5939661145708346f, 1.0f, 0.8764843505917469f, 0.7654214726745099f,
-	1.0f, 1.4958772882112243f, 0.9999999999999998f, 1.0921329275192317f, 0.9335035919445367f,
-	0.07314249939318727f,
-	// Elliptic N=8 F/Fs=0.3427592954990215 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9692141367474256f, 0.9999999999999997f, -0.17869983595849043f, 0.09995266639655405f,
-	1.0f, 1.7840480492544144f, 1.0f, 0.4298345057301068f, 0.47601324379886767f,
-	1.0f, 1.5961084356834148f, 1.0000000000000002f, 0.880544805004679f, 0.7657245294284863f,
-	1.0f, 1.4984649248862052f, 0.9999999999999999f, 1.0960619839884298f, 0.9336105644274442f,
-	0.07364195342342092f,
 	// Elliptic N=8 F/Fs=0.34315068493150686 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9693937204807204f, 0.9999999999999999f, -0.17550395064232796f, 0.09971769418119396f,
 	1.0f, 1.7852493260931406f, 0.9999999999999998f, 0.4339111113285307f, 0.47634667741502795f,
 	1.0f, 1.5982441683690203f, 1.0f, 0.8846022070831476f, 0.7660290851296203f,
 	1.0f, 1.5010453456523216f, 0.9999999999999999f, 1.0999850459196008f, 0.9337179215143795f,
 	0.07414463704316959f,
-	// Elliptic N=8 F/Fs=0.34354207436399214 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9695725550597776f, 1.0f, -0.17230188288000486f, 0.09948653006277462f,
-	1.0f, 1.7864462417358997f, 0.9999999999999998f, 0.4379901316521913f, 0.47668359265870097f,
-	1.0f, 1.600373321692038f, 0.9999999999999998f, 0.8886565352658927f, 0.7663351398432064f,
-	1.0f, 1.5036185549271721f, 0.9999999999999996f, 1.1039020927174432f, 0.9338256626533739f,
-	0.07465057028705072f,
-	// Elliptic N=8 F/Fs=0.3439334637964775 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9697506433759633f, 1.0f, -0.16909360887821176f, 0.09925919652623902f,
-	1.0f, 1.7876388079219085f, 1.0f, 0.44207155730979336f, 0.4770239985222881f,
-	1.0f, 1.6024959047022271f, 0.9999999999999998f, 0.8927077679572519f, 0.7666426936287511f,
-	1.0f, 1.5061845571386336f, 0.9999999999999998f, 1.107813103812114f, 0.9339337872907479f,
-	0.07515977331183628f,
-	// Elliptic N=8 F/Fs=0.34432485322896283 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.969927988303909f, 0.9999999999999998f, -0.165879104743108f, 0.09903571622860373f,
-	1.0f, 1.788827036341443f, 1.0f, 0.4461553788186761f, 0.4773679040225609f,
-	1.0f, 1.6046119264345875f, 1.0f, 0.8967558835271399f, 0.766951746539939f,
-	1.0f, 1.5087433567246333f, 1.0000000000000002f, 1.111718058659279f, 0.9340422948711125f,
-	0.0756722663972063f,
-	// Elliptic N=8 F/Fs=0.3447162426614482 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9701045927016159f, 1.0f, -0.16265834647984068f, 0.09881611200033957f,
-	1.0f, 1.7900109386359984f, 1.0000000000000002f, 0.4502415866042263f, 0.47771531820063656f,
-	1.0f, 1.606721395909237f, 1.0000000000000002f, 0.9008008603110436f, 0.7672622986246024f,
-	1.0f, 1.5112949581329322f, 1.0f, 1.1156169367401767f, 0.9341511848373719f,
-	0.07618806994650956f,
-	// Elliptic N=8 F/Fs=0.34510763209393347 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9702804594105559f, 1.0000000000000002f, -0.15943130999207f, 0.09860040684676577f,
-	1.0f, 1.791190526398445f, 0.9999999999999998f, 0.4543301709992774f, 0.4780662501219542f,
-	1.0f, 1.608824322131286f, 1.0000000000000002f, 0.904842676610005f, 0.7675743499246872f,
-	1.0f, 1.5138393658209037f, 1.0f, 1.119509717561671f, 0.9342604566307242f,
-	0.07670720448752663f,
-	// Elliptic N=8 F/Fs=0.34549902152641876 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.970455591255776f, 0.9999999999999997f, -0.15619797108148617f, 0.09838862394945581f,
-	1.0f, 1.792365811173188f, 1.0f, 0.4584211222435137f, 0.4784207088762479f,
-	1.0f, 1.6109207140907156f, 0.9999999999999998f, 0.9088813106906173f, 0.7678879004762231f,
-	1.0f, 1.516376584255317f, 1.0000000000000002f, 1.1233963806563088f, 0.9343701096906607f,
-	0.07722969067323984f,
 	// Elliptic N=8 F/Fs=0.34589041095890416 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9706299910460012f, 1.0000000000000002f, -0.15295830544732614f, 0.0981807866676564f,
 	1.0f, 1.7935368044563216f, 0.9999999999999997f, 0.4625144304828716f, 0.4787787035775201f,
 	1.0f, 1.6130105807622581f, 0.9999999999999999f, 0.9129167407850162f, 0.7682029503092901f,
 	1.0f, 1.5189066179121207f, 1.0f, 1.1272769055823835f, 0.93448014345497f,
 	0.07775554928260753f,
-	// Elliptic N=8 F/Fs=0.34628180039138945 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9708036615737305f, 0.9999999999999999f, -0.14971228868589612f, 0.0979769185397195f,
-	1.0f, 1.7947035176957864f, 1.0000000000000002f, 0.4666100857689261f, 0.479140243364014f,
-	1.0f, 1.6150939311052703f, 1.0f, 0.9169489450908629f, 0.7685194994479851f,
-	1.0f, 1.521429471276224f, 1.0000000000000004f, 1.1311512719239802f, 0.9345905573597374f,
-	0.0782848012213419f,
-	// Elliptic N=8 F/Fs=0.34667318982387474 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9709766056153424f, 0.9999999999999997f, -0.14645989629007788f, 0.09777704328454728f,
-	1.0f, 1.7958659622915234f, 1.0f, 0.47070807805829495f, 0.47950533739818363f,
-	1.0f, 1.6171707740636212f, 1.0f, 0.9209779017713473f, 0.7688375479103899f,
-	1.0f, 1.523945148841287f, 1.0f, 1.135019459291046f, 0.9347013508393475f,
-	0.0788174675226945f,
-	// Elliptic N=8 F/Fs=0.3470645792563601 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9711488259311916f, 1.0f, -0.14320110364884545f, 0.0975811848030496f,
-	1.0f, 1.7970241495956338f, 1.0f, 0.4748083972120222f, 0.47987399486666416f,
-	1.0f, 1.6192411185655715f, 0.9999999999999999f, 0.9250035889551776f, 0.7691570957085407f,
-	1.0f, 1.5264536551095074f, 1.0000000000000004f, 1.1388814473194415f, 0.9348125233264845f,
-	0.07935356934824452f,
-	// Elliptic N=8 F/Fs=0.34745596868884543 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9713203252657066f, 1.0f, -0.13993588604677396f, 0.09738936717961567f,
-	1.0f, 1.7981780909125304f, 1.0000000000000002f, 0.478911032994969f, 0.4802462249802407f,
-	1.0f, 1.6213049735236575f, 0.9999999999999999f, 0.929025984736573f, 0.769478142848391f,
-	1.0f, 1.5289549945914074f, 1.0f, 1.1427372156709992f, 0.9349240742521335f,
-	0.0798931279886928f,
-	// Elliptic N=8 F/Fs=0.3478473581213307 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9714911063474903f, 1.0000000000000002f, -0.13666421866355083f, 0.09720161468359863f,
-	1.0f, 1.7993277974990916f, 0.9999999999999998f, 0.48301597507519467f, 0.4806220369738155f,
-	1.0f, 1.6233623478345753f, 1.0f, 0.9330450671752596f, 0.769800689329782f,
-	1.0f, 1.5314491718056247f, 1.0f, 1.1465867440335797f, 0.9350360030455824f,
-	0.0804361648646614f,
-	// Elliptic N=8 F/Fs=0.348238747553816 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9716611718894144f, 1.0f, -0.1333860765734793f, 0.09701795177081347f,
-	1.0f, 1.8004732805648196f, 1.0000000000000002f, 0.4871232130233427f, 0.4810014401063754f,
-	1.0f, 1.6254132503790675f, 0.9999999999999998f, 0.9370608142964694f, 0.7701247351464101f,
-	1.0f, 1.533936191278705f, 1.0000000000000002f, 1.1504300121211344f, 0.9351483091344228f,
-	0.08098270152749752f,
 	// Elliptic N=8 F/Fs=0.3486301369863014 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.971830524588718f, 1.0f, -0.13010143474498517f, 0.09683840308504894f,
 	1.0f, 1.8016145512719888f, 1.0f, 0.4912327363120179f, 0.48138444366095534f,
 	1.0f, 1.6274576900218116f, 1.0000000000000002f, 0.9410732040909332f, 0.7704502802857901f,
 	1.0f, 1.5364160575448929f, 0.9999999999999998f, 1.1542669996737573f, 0.9352609919445498f,
 	0.08153275966008301f,
-	// Elliptic N=8 F/Fs=0.3490215264187867 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9719991671271015f, 0.9999999999999998f, -0.12681026804012208f, 0.09666299345959327f,
-	1.0f, 1.8027516207358028f, 0.9999999999999996f, 0.49534453431516084f, 0.48177105694460487f,
-	1.0f, 1.6294956756113046f, 1.0000000000000002f, 0.9450822145148796f, 0.7707773247292263f,
-	1.0f, 1.5388887751459268f, 1.0f, 1.1580976864577475f, 0.935374050900167f,
-	0.08208636107764931f,
-	// Elliptic N=8 F/Fs=0.349412915851272 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9721671021708234f, 1.0f, -0.1235125512140689f, 0.09649174791877327f,
-	1.0f, 1.8038845000245474f, 1.0000000000000002f, 0.49945859630742584f, 0.4821612892883499f,
-	1.0f, 1.6315272159797574f, 1.0f, 0.9490878234900347f, 0.771105868451776f,
-	1.0f, 1.5413543486308345f, 1.0f, 1.1619220522656657f, 0.9354874854237838f,
-	0.08264352772859648f,
-	// Elliptic N=8 F/Fs=0.34980430528375733 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9723343323707916f, 1.0000000000000002f, -0.12020825891463281f, 0.09632469167950833f,
-	1.0f, 1.8050132001597383f, 0.9999999999999999f, 0.5035749114635475f, 0.48255515004715466f,
-	1.0f, 1.6335523199429827f, 1.0f, 0.9530900089036209f, 0.7714359114222177f,
-	1.0f, 1.5438127825557286f, 0.9999999999999999f, 1.165740076916392f, 0.9356012949362185f,
-	0.08320428169531911f,
-	// Elliptic N=8 F/Fs=0.3501956947162427 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9725008603626595f, 1.0f, -0.11689736568174512f, 0.09616185015287776f,
-	1.0f, 1.8061377321162797f, 1.0000000000000004f, 0.5076934688577112f, 0.4829526485998829f,
-	1.0f, 1.6355709963002887f, 1.0000000000000002f, 0.9570887486083577f, 0.7717674536030181f,
-	1.0f, 1.5462640814836073f, 1.0f, 1.1695517402551847f, 0.935715478856599f,
-	0.08376864519503634f,
-	// Elliptic N=8 F/Fs=0.35058708414872797 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9726666887669184f, 0.9999999999999999f, -0.11357984594696034f, 0.0960032489457033f,
-	1.0f, 1.8072581068226088f, 1.0f, 0.5118142574629161f, 0.48335379434925824f,
-	1.0f, 1.6375832538343693f, 1.0f, 0.9610840204224601f, 0.7721004949502966f,
-	1.0f, 1.5487082499841482f, 0.9999999999999999f, 1.1733570221537384f, 0.9358300366023657f,
-	0.08433664058062713f,
-	// Elliptic N=8 F/Fs=0.3509784735812133 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.972831820188989f, 1.0000000000000002f, -0.11025567403294727f, 0.09584891386214517f,
-	1.0f, 1.808374335160853f, 1.0f, 0.5159372661503383f, 0.4837585967218198f,
-	1.0f, 1.639589101311203f, 1.0f, 0.9650758021296442f, 0.7724350354137931f,
-	1.0f, 1.5511452926335152f, 1.0f, 1.1771559025102418f, 0.9359449675892704f,
-	0.08490829034147174f,
 	// Elliptic N=8 F/Fs=0.35136986301369866 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9729962572193123f, 1.0000000000000002f, -0.1069248241529828f, 0.09569887090531386f,
 	1.0f, 1.8094864279669767f, 1.0000000000000002f, 0.520062483688692f, 0.48416706516788266f,
 	1.0f, 1.6415885474799445f, 0.9999999999999999f, 0.9690640714791299f, 0.7727710749368344f,
 	1.0f, 1.553575214014155f, 0.9999999999999998f, 1.1809483612494378f, 0.9360602712313774f,
 	0.08548361710429833f,
-	// Elliptic N=8 F/Fs=0.35176125244618395 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9731600024334408f, 0.9999999999999998f, -0.10358727041044521f, 0.09555314627889568f,
-	1.0f, 1.810594396030931f, 1.0000000000000002f, 0.5241898987435816f, 0.48457920916149155f,
-	1.0f, 1.6435816010728235f, 1.0f, 0.9730488061856402f, 0.7731086134562983f,
-	1.0f, 1.5559980187146025f, 0.9999999999999998f, 1.1847343783226787f, 0.9361759469410681f,
-	0.0860626436340336f,
-	// Elliptic N=8 F/Fs=0.3521526418786693 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9733230583921308f, 1.0000000000000002f, -0.10024298679829968f, 0.09541176638879376f,
-	1.0f, 1.8116982500968055f, 0.9999999999999999f, 0.5283194998768601f, 0.4849950382003776f,
-	1.0f, 1.6455682708050412f, 1.0f, 0.9770299839294119f, 0.7734476509025822f,
-	1.0f, 1.558413711329285f, 1.0000000000000002f, 1.188513933707989f, 0.936291994129039f,
-	0.08664539283466142f,
-	// Elliptic N=8 F/Fs=0.35254403131115464 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9734854276414269f, 1.0f, -0.09689194719858699f, 0.09527475784478391f,
-	1.0f, 1.812798000862977f, 0.9999999999999997f, 0.5324512755459777f, 0.4854145618059088f,
-	1.0f, 1.6475485653746706f, 0.9999999999999998f, 0.9810075823561994f, 0.7737881871995682f,
-	1.0f, 1.560822296458327f, 0.9999999999999999f, 1.1922870074101224f, 0.9364084122043033f,
-	0.08723188775008506f,
-	// Elliptic N=8 F/Fs=0.3529354207436399 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9736471127127553f, 1.0f, -0.09353412538191205f, 0.095142147462186f,
-	1.0f, 1.8138936589822565f, 0.9999999999999998f, 0.5365852141033292f, 0.48583778952304546f,
-	1.0f, 1.6495224934625556f, 1.0f, 0.9849815790772762f, 0.7741302222645867f,
-	1.0f, 1.5632237787073564f, 1.0f, 1.1960535794606169f, 0.9365252005741938f,
-	0.0878221515649949f,
-	// Elliptic N=8 F/Fs=0.3533268101761252 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9738081161230097f, 1.0f, -0.09016949500692355f, 0.0950139622635504f,
-	1.0f, 1.8149852350620392f, 1.0000000000000002f, 0.5407213037956007f, 0.48626473092028855f,
-	1.0f, 1.6514900637322119f, 1.0f, 0.9889519516694513f, 0.774473756008386f,
-	1.0f, 1.5656181626873145f, 1.0000000000000002f, 1.1998136299178608f, 0.9366423586443627f,
-	0.08841620760574324f,
-	// Elliptic N=8 F/Fs=0.3537181996086106 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9739684403746387f, 1.0f, -0.0867980296197985f, 0.09489022948035976f,
-	1.0f, 1.8160727396644505f, 1.0000000000000002f, 0.5448595327631122f, 0.4866953955896318f,
-	1.0f, 1.6534512848297298f, 0.9999999999999999f, 0.9929186776750696f, 0.7748187883350942f,
-	1.0f, 1.5680054530142622f, 1.0f, 1.2035671388671452f, 0.9367598858187829f,
-	0.089014079341223f,
 	// Elliptic N=8 F/Fs=0.3541095890410959 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9741280879557332f, 1.0000000000000002f, -0.08341970265372427f, 0.09477097655474723f,
 	1.0f, 1.817156183306495f, 1.0000000000000004f, 0.5489998890391534f, 0.4871297931465074f,
 	1.0f, 1.6554061653836774f, 0.9999999999999996f, 0.9968817346020251f, 0.7751653191421877f,
 	1.0f, 1.5703856543091927f, 0.9999999999999998f, 1.2073140864207257f, 0.9368777814997507f,
 	0.0896157903837529f,
-	// Elliptic N=8 F/Fs=0.3545009784735812 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9742870613401116f, 1.0f, -0.08003448742837455f, 0.09465623114122951f,
-	1.0f, 1.8182355764602027f, 1.0000000000000004f, 0.553142360549327f, 0.48756793322973485f,
-	1.0f, 1.6573547140050056f, 0.9999999999999996f, 1.000841099923771f, 0.7755133483204544f,
-	1.0f, 1.5727587711978437f, 1.0000000000000002f, 1.2110544527178824f, 0.9369960450878843f,
-	0.09022136448996843f,
-	// Elliptic N=8 F/Fs=0.35489236790606654 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9744453629874064f, 0.9999999999999998f, -0.07664235714938776f, 0.09454602110845665f,
-	1.0f, 1.8193109295527743f, 0.9999999999999998f, 0.5572869351108763f, 0.4880098255014662f,
-	1.0f, 1.6592969392869525f, 0.9999999999999998f, 1.0047967510793292f, 0.7758628757539598f,
-	1.0f, 1.575124808310506f, 0.9999999999999998f, 1.2147882179249776f, 0.9371146759821278f,
-	0.09083082556171823f,
-	// Elliptic N=8 F/Fs=0.3552837573385519 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9746029953431485f, 1.0f, -0.07324328490784528f, 0.09444037454097787f,
-	1.0f, 1.8203822529667295f, 1.0f, 0.5614336004320184f, 0.4884554796471306f,
-	1.0f, 1.6612328498049493f, 0.9999999999999998f, 1.0087486654733027f, 0.7762139013200131f,
-	1.0f, 1.5774837702818432f, 1.0000000000000002f, 1.2185153622355132f, 0.9372336735797508f,
-	0.09144419764696594f,
-	// Elliptic N=8 F/Fs=0.3556751467710372 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9747599608388504f, 1.0000000000000002f, -0.06983724367974095f, 0.09433931974102316f,
-	1.0f, 1.821449557040049f, 0.9999999999999999f, 0.5655823441112737f, 0.48890490537537634f,
-	1.0f, 1.6631624541165309f, 1.0f, 1.012696820475891f, 0.7765664248891312f,
-	1.0f, 1.579835661750702f, 1.0f, 1.2222358658701955f, 0.9373530372763504f,
-	0.09206150494069865f,
-	// Elliptic N=8 F/Fs=0.3560665362035225 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9749162618920915f, 1.0000000000000002f, -0.06642420632545633f, 0.09424288523030203f,
-	1.0f, 1.8225128520663225f, 0.9999999999999997f, 0.5697331536367892f, 0.4893581124180135f,
-	1.0f, 1.6650857607612406f, 0.9999999999999996f, 1.0166411934229012f, 0.7769204463250035f,
-	1.0f, 1.5821804873599319f, 0.9999999999999998f, 1.2259497090769904f, 0.9374727664658531f,
-	0.09268277178584015f,
-	// Elliptic N=8 F/Fs=0.35645792563600787 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9750719009065991f, 1.0000000000000002f, -0.06300414558923179f, 0.0941510997518185f,
-	1.0f, 1.823572148294892f, 1.0f, 0.5738860163856615f, 0.4898151105299548f,
-	1.0f, 1.6670027782605432f, 0.9999999999999996f, 1.0205817616157629f, 0.7772759654844579f,
-	1.0f, 1.5845182517562018f, 1.0000000000000002f, 1.229656872131181f, 0.9375928605405117f,
-	0.09330802267417092f,
 	// Elliptic N=8 F/Fs=0.35684931506849316 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9752268802723323f, 0.9999999999999999f, -0.059577034098633554f, 0.09406399227170313f,
 	1.0f, 1.8246274559309936f, 0.9999999999999997f, 0.5780409196232561f, 0.4902759094891516f,
 	1.0f, 1.6689135151177334f, 0.9999999999999999f, 1.024518502321546f, 0.7776329822174248f,
 	1.0f, 1.5868489595898165f, 0.9999999999999999f, 1.2333573353354328f, 0.9377133188909135f,
 	0.0939372822472534f,
-	// Elliptic N=8 F/Fs=0.35724070450097845 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9753812023655641f, 1.0f, -0.05614284436402299f, 0.09398159198106162f,
-	1.0f, 1.825678785135906f, 0.9999999999999997f, 0.5821978505025249f, 0.490740519096535f,
-	1.0f, 1.6708179798178486f, 1.0f, 1.0284513927729764f, 0.7779914963669025f,
-	1.0f, 1.5891726155145414f, 0.9999999999999999f, 1.2370510790198506f, 0.9378341409059767f,
-	0.09457057529736368f,
-	// Elliptic N=8 F/Fs=0.35763209393346385 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9755348695489598f, 0.9999999999999999f, -0.05270154877802057f, 0.09390392829784115f,
-	1.0f, 1.8267261460270887f, 0.9999999999999997f, 0.5863567960633206f, 0.4912089491759494f,
-	1.0f, 1.6727161808275808f, 0.9999999999999997f, 1.0323804101684557f, 0.7783515077689216f,
-	1.0f, 1.5914892241874201f, 1.0f, 1.2407380835420376f, 0.9379553259729523f,
-	0.09520792676842894f,
-	// Elliptic N=8 F/Fs=0.35802348336594914 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9756878841716605f, 0.9999999999999999f, -0.0492531196149749f, 0.09383103086871347f,
-	1.0f, 1.8277695486783272f, 1.0000000000000002f, 0.5905177432317033f, 0.4916812095740884f,
-	1.0f, 1.6746081265951915f, 1.0f, 1.0363055316720737f, 0.7787130162525088f,
-	1.0f, 1.5937987902685957f, 1.0f, 1.2444183292871542f, 0.9380768734774263f,
-	0.09584936175697008f,
-	// Elliptic N=8 F/Fs=0.3584148727984344 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9758402485693611f, 1.0f, -0.045797529030419455f, 0.09376292957097576f,
-	1.0f, 1.8288090031198723f, 0.9999999999999998f, 0.5946806788192545f, 0.49215731016042685f,
-	1.0f, 1.6764938255504245f, 0.9999999999999999f, 1.0402267344136364f, 0.779076021639652f,
-	1.0f, 1.596101318421138f, 1.0f, 1.2480917966679819f, 0.9381987828033199f,
-	0.09649490551305255f,
-	// Elliptic N=8 F/Fs=0.35880626223091977 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.97599196506439f, 0.9999999999999999f, -0.04233474906053725f, 0.09369965451446909f,
-	1.0f, 1.8298445193385868f, 0.9999999999999996f, 0.5988455895223799f, 0.49263726082715276f,
-	1.0f, 1.6783732861044243f, 1.0f, 1.0441439954886835f, 0.7794405237452655f,
-	1.0f, 1.5983968133108657f, 0.9999999999999998f, 1.2517584661249808f, 0.9383210533328922f,
-	0.0971445834412406f,
-	// Elliptic N=8 F/Fs=0.3591976516634051 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9761430359657892f, 1.0000000000000004f, -0.03886475162162212f, 0.0936412360435149f,
-	1.0f, 1.8308761072780815f, 0.9999999999999996f, 0.603012461921609f, 0.4931210714890989f,
-	1.0f, 1.6802465166496494f, 0.9999999999999998f, 1.0480572919585056f, 0.7798065223771522f,
-	1.0f, 1.600685279606172f, 0.9999999999999999f, 1.2554183181263483f, 0.9384436844467399f,
-	0.09779842110155947f,
 	// Elliptic N=8 F/Fs=0.3595890410958904 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9762934635693892f, 1.0000000000000002f, -0.035387508509533504f, 0.09358770473886903f,
 	1.0f, 1.8319037768388584f, 1.0f, 0.6071812824808994f, 0.4936087520836693f,
 	1.0f, 1.6821135255597932f, 1.0f, 1.0519666008501745f, 0.7801740173359696f,
 	1.0f, 1.6029667219778525f, 1.0000000000000002f, 1.2590713331680825f, 0.9385666755237994f,
 	0.09845644421046355f,
-	// Elliptic N=8 F/Fs=0.35998043052837575 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9764432501578901f, 1.0f, -0.03190299139915471f, 0.0935390914196944f,
-	1.0f, 1.8329275378784498f, 1.0000000000000004f, 0.6113520375469318f, 0.49410031257076814f,
-	1.0f, 1.6839743211897003f, 0.9999999999999998f, 1.0558718991565628f, 0.7805430084151933f,
-	1.0f, 1.605241145098932f, 1.0f, 1.2627174917740416f, 0.9386900259413473f,
-	0.0991186786418098f,
-	// Elliptic N=8 F/Fs=0.3603718199608611 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9765923980009374f, 1.0f, -0.028411171843850898f, 0.09349542714555201f,
-	1.0f, 1.8339474002115572f, 1.0f, 0.6155247133484002f, 0.4945957629327243f,
-	1.0f, 1.6858289118752867f, 1.0000000000000002f, 1.0597731638363672f, 0.7809134954010806f,
-	1.0f, 1.6075085536444949f, 1.0f, 1.2663567744960011f, 0.9388137350750028f,
-	0.09978515042783817f,
-	// Elliptic N=8 F/Fs=0.3607632093933464 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9767409093551969f, 0.9999999999999999f, -0.02491202127491898f, 0.0934567432184103f,
-	1.0f, 1.8349633736101947f, 0.9999999999999999f, 0.6196992959953086f, 0.4950951131742159f,
-	1.0f, 1.6876773059334604f, 1.0000000000000004f, 1.063670371814138f, 0.7812854780726345f,
-	1.0f, 1.6097689522915144f, 1.0000000000000002f, 1.269989161913719f, 0.9389378022987271f,
-	0.10045588576015835f,
-	// Elliptic N=8 F/Fs=0.36115459882583173 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.976888786464433f, 1.0000000000000002f, -0.02140551100104115f, 0.09342307118467326f,
-	1.0f, 1.8359754678038225f, 1.0f, 0.6238757714782561f, 0.4955983733221936f,
-	1.0f, 1.6895195116620425f, 1.0f, 1.0675634999803048f, 0.7816589562015681f,
-	1.0f, 1.6120223457186849f, 0.9999999999999999f, 1.2736146346349946f, 0.9390622269848267f,
-	0.10113091099074256f,
-	// Elliptic N=8 F/Fs=0.3615459882583171 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9770360315595807f, 1.0f, -0.01789161220773991f, 0.09339444283722802f,
-	1.0f, 1.8369836924794878f, 1.0000000000000002f, 0.6280541256677212f, 0.4961055534257998f,
-	1.0f, 1.6913555373396896f, 0.9999999999999998f, 1.0714525251912006f, 0.7820339295522676f,
-	1.0f, 1.6142687386062529f, 0.9999999999999999f, 1.2772331732957265f, 0.9391870085039529f,
-	0.10181025263292437f,
-	// Elliptic N=8 F/Fs=0.36193737769080236 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.977182646858825f, 1.0f, -0.014370295956821698f, 0.09337089021751042f,
-	1.0f, 1.8379880572819611f, 0.9999999999999999f, 0.6322343443133469f, 0.4966166635562901f,
-	1.0f, 1.6931853912258183f, 1.0f, 1.0753374242690967f, 0.7824103978817558f,
-	1.0f, 1.6165081356358526f, 1.0f, 1.280844758559979f, 0.9393121462251042f,
-	0.10249393736240499f,
 	// Elliptic N=8 F/Fs=0.3623287671232877 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9773286345676708f, 1.0000000000000002f, -0.010841533185829044f, 0.09335244561759176f,
 	1.0f, 1.8389885718138763f, 0.9999999999999998f, 0.636416413043219f, 0.49713171380694976f,
 	1.0f, 1.6950090815605272f, 1.0f, 1.079218174002229f, 0.7827883609396572f,
 	1.0f, 1.6187405414903393f, 0.9999999999999999f, 1.2844493711200384f, 0.9394376395156276f,
 	0.103181992018265f,
-	// Elliptic N=8 F/Fs=0.362720156555773 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9774739968790174f, 0.9999999999999997f, -0.007305294707489106f, 0.09333914158228263f,
-	1.0f, 1.8399852456358643f, 1.0f, 0.6406003173631402f, 0.49765071429300983f,
-	1.0f, 1.6968266165645223f, 1.0f, 1.083094751144827f, 0.7831678184681587f,
-	1.0f, 1.6209659608536242f, 1.0f, 1.288046991696474f, 0.9395634877412178f,
-	0.10387444360398222f,
-	// Elliptic N=8 F/Fs=0.36311154598825834 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9776187359732356f, 1.0000000000000002f, -0.0037615512091543667f, 0.09333101091125891f,
-	1.0f, 1.8409780882666897f, 1.0f, 0.6447860426559092f, 0.49817367515156247f,
-	1.0f, 1.6986380044390446f, 1.0000000000000004f, 1.086967132417151f, 0.7835487702019752f,
-	1.0f, 1.6231843984105137f, 1.0f, 1.291637601038202f, 0.93968969026592f,
-	0.10457131928845816f,
-	// Elliptic N=8 F/Fs=0.36350293542074363 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9777628540182324f, 0.9999999999999998f, -0.0002102732522514503f, 0.09332808666120601f,
-	1.0f, 1.841967109183389f, 0.9999999999999998f, 0.6489735741805883f, 0.49870060654147386f,
-	1.0f, 1.7004432533657945f, 1.0f, 1.0908352945055213f, 0.7839312158683123f,
-	1.0f, 1.6253958588465451f, 0.9999999999999998f, 1.2952211799225457f, 0.9398162464521327f,
-	0.10527264640704825f,
-	// Elliptic N=8 F/Fs=0.363894324853229 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.977906353169532f, 0.9999999999999999f, 0.003348568728277823f, 0.09333040214798384f,
-	1.0f, 1.8429523178214036f, 0.9999999999999999f, 0.6531628970717726f, 0.4992315186432948f,
-	1.0f, 1.702242371506863f, 1.0000000000000002f, 1.0946992140623528f, 0.7843151551868283f,
-	1.0f, 1.6276003468478282f, 0.9999999999999998f, 1.2987977091552958f, 0.9399431556606049f,
-	0.10597845246260125f,
-	// Elliptic N=8 F/Fs=0.36428571428571427 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9780492355703405f, 1.0000000000000002f, 0.006915004424532665f, 0.09333799094881223f,
-	1.0f, 1.843933723574715f, 1.0f, 0.6573539963388527f, 0.49976642165916985f,
-	1.0f, 1.704035367004656f, 1.0f, 1.0985588677061908f, 0.7847005878695993f,
-	1.0f, 1.6297978671008817f, 1.0f, 1.3023671695707715f, 0.9400704172504419f,
-	0.10668876512650297f,
-	// Elliptic N=8 F/Fs=0.3646771037181996 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9781915033516189f, 0.9999999999999998f, 0.010489063656214504f, 0.0933508869044765f,
-	1.0f, 1.84491133579598f, 1.0f, 0.6615468568652829f, 0.5003053258127474f,
-	1.0f, 1.7058222479818264f, 1.0f, 1.102414232021748f, 0.7850875136210804f,
-	1.0f, 1.6319884242924771f, 1.0f, 1.3059295420318837f, 0.9401980305791018f,
-	0.10740361223972847f,
 	// Elliptic N=8 F/Fs=0.3650684931506849 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9783331586321564f, 1.0000000000000002f, 0.014070776371186752f, 0.09336912412155418f,
 	1.0f, 1.8458851637966631f, 0.9999999999999998f, 0.6657414634078354f, 0.5008482413490831f,
 	1.0f, 1.7076030225412042f, 1.0000000000000002f, 1.106265283559939f, 0.7854759321380693f,
 	1.0f, 1.63417202310948f, 0.9999999999999996f, 1.309484807430196f, 0.940325995002401f,
 	0.10812302181390067f,
-	// Elliptic N=8 F/Fs=0.36545988258317025 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9784742035186347f, 0.9999999999999998f, 0.017660172646036962f, 0.09339273697466233f,
-	1.0f, 1.8468552168471724f, 0.9999999999999998f, 0.6699378005958608f, 0.5013951785345465f,
-	1.0f, 1.709377698765727f, 1.0f, 1.110111998837923f, 0.7858658431096697f,
-	1.0f, 1.6363486682386954f, 1.0f, 1.3130329466859856f, 0.9404543098745125f,
-	0.10884702203235472f,
-	// Elliptic N=8 F/Fs=0.3658512720156556 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9786146401057034f, 0.9999999999999998f, 0.02125728268663668f, 0.09342176010872631f,
-	1.0f, 1.847821504176989f, 1.0f, 0.6741358529305392f, 0.5019461476567222f,
-	1.0f, 1.7111462847183714f, 1.0f, 1.1139543543391386f, 0.7862572462172525f,
-	1.0f, 1.6385183643667063f, 1.0000000000000004f, 1.3165739407483057f, 0.9405829745479689f,
-	0.10957564125120983f,
-	// Elliptic N=8 F/Fs=0.3662426614481409 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9787544704760447f, 1.0f, 0.02486213682870945f, 0.09345622844126947f,
-	1.0f, 1.848784034974802f, 1.0f, 0.6783356047841331f, 0.5025011590243107f,
-	1.0f, 1.7129087884420875f, 1.0f, 1.117792326513347f, 0.7866501411344193f,
-	1.0f, 1.6406811161797248f, 0.9999999999999998f, 1.3201077705950468f, 0.9407119883736617f,
-	0.11030890800044864f,
-	// Elliptic N=8 F/Fs=0.36663405088062617 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.978893696700443f, 1.0000000000000002f, 0.028474765538393492f, 0.0934961771647254f,
-	1.0f, 1.8497428183886397f, 1.0f, 0.6825370403992377f, 0.5030602229670302f,
-	1.0f, 1.7146652179597306f, 0.9999999999999997f, 1.1216258917766733f, 0.7870445275269657f,
-	1.0f, 1.6428369283634379f, 0.9999999999999998f, 1.3236344172330008f, 0.9408413507008455f,
-	0.11104685098500244f,
-	// Elliptic N=8 F/Fs=0.3670254403131116 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.979032320837853f, 1.0f, 0.03209519941280949f, 0.09354164174877053f,
-	1.0f, 1.8506978635260007f, 0.9999999999999996f, 0.686740143888025f, 0.5036233498355109f,
-	1.0f, 1.716415581273999f, 1.0f, 1.125455026511652f, 0.7874404050528427f,
-	1.0f, 1.6449858056028526f, 0.9999999999999999f, 1.3271538616979213f, 0.9409710608771349f,
-	0.11178949908584408f,
-	// Elliptic N=8 F/Fs=0.36741682974559686 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9791703449354683f, 1.0000000000000002f, 0.03572346918062076f, 0.09359265794268022f,
-	1.0f, 1.851649179453985f, 0.9999999999999998f, 0.6909448992314795f, 0.5041905500011911f,
-	1.0f, 1.718159886367362f, 1.0f, 1.129279707067261f, 0.7878377733621188f,
-	1.0f, 1.6471277525821422f, 1.0f, 1.3306660850545822f, 0.9411011182485101f,
-	0.11253688136108604f,
 	// Elliptic N=8 F/Fs=0.36780821917808215 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.979307771028785f, 0.9999999999999998f, 0.039359605702613286f, 0.0936492617777062f,
 	1.0f, 1.8525967751994248f, 0.9999999999999998f, 0.6951512902786539f, 0.5047618338562126f,
 	1.0f, 1.7198981412020053f, 1.0f, 1.1330999097589813f, 0.7882366320969428f,
 	1.0f, 1.6492627739845032f, 1.0f, 1.33417106839685f, 0.9412315221593158f,
 	0.1132890270470898f,
-	// Elliptic N=8 F/Fs=0.36819960861056755 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9794446011416726f, 0.9999999999999999f, 0.043003639972255904f, 0.09371148956947692f,
-	1.0f, 1.8535406597490143f, 1.0f, 0.6993593007458943f, 0.5053372118133114f,
-	1.0f, 1.721630353719762f, 0.9999999999999999f, 1.1369156108688339f, 0.7886369808915077f,
-	1.0f, 1.6513908744919992f, 0.9999999999999998f, 1.3376687928477373f, 0.9413622719522619f,
-	0.11404596555957729f,
-	// Elliptic N=8 F/Fs=0.36859099804305284 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9795808372864356f, 0.9999999999999998f, 0.04665560311626842f, 0.09377937792042013f,
-	1.0f, 1.8544808420494368f, 0.9999999999999999f, 0.7035689142160736f, 0.5059166943057071f,
-	1.0f, 1.72335653184205f, 1.0000000000000002f, 1.1407267866454234f, 0.7890388193720089f,
-	1.0f, 1.6535120587854137f, 0.9999999999999998f, 1.3411592395594665f, 0.9414933669684271f,
-	0.11480772649475131f,
-	// Elliptic N=8 F/Fs=0.3689823874755382 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9797164814638823f, 1.0f, 0.05031552639520062f, 0.09385296372220923f,
-	1.0f, 1.8554173310074986f, 0.9999999999999999f, 0.7077801141378328f, 0.5065002917869925f,
-	1.0f, 1.7250766834698132f, 1.0000000000000004f, 1.1445334133039968f, 0.7894421471566093f,
-	1.0f, 1.6556263315441047f, 0.9999999999999998f, 1.3446423897135364f, 0.9416248065472572f,
-	0.11557433963042564f,
-	// Elliptic N=8 F/Fs=0.36937377690802353 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9798515356633868f, 0.9999999999999999f, 0.053983441203998166f, 0.0939322841582321f,
-	1.0f, 1.8563501354902536f, 1.0000000000000002f, 0.7119928838248024f, 0.507088014731019f,
-	1.0f, 1.7267908164834584f, 0.9999999999999997f, 1.1483354670264876f, 0.7898469638554009f,
-	1.0f, 1.6577336974458565f, 1.0f, 1.3481182245207834f, 0.9417565900265688f,
-	0.11634583492715848f,
-	// Elliptic N=8 F/Fs=0.3697651663405088 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9799860018629567f, 1.0000000000000002f, 0.05765937907257484f, 0.0940173767060833f,
-	1.0f, 1.8572792643251312f, 0.9999999999999998f, 0.7162072064548308f, 0.5076798736317819f,
-	1.0f, 1.7284989387427987f, 1.0f, 1.1521329239615647f, 0.7902532690703657f,
-	1.0f, 1.659834161166734f, 1.0000000000000004f, 1.3515867252214406f, 0.941888716742548f,
-	0.11712224252939517f,
-	// Elliptic N=8 F/Fs=0.37015655577299417 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9801198820292938f, 0.9999999999999998f, 0.06134337166638887f, 0.09410827914008078f,
-	1.0f, 1.8582047263000676f, 1.0000000000000002f, 0.7204230650692076f, 0.5082758790033006f,
-	1.0f, 1.7302010580869882f, 0.9999999999999996f, 1.155925760224688f, 0.7906610623953378f,
-	1.0f, 1.6619277273809376f, 0.9999999999999998f, 1.3550478730852076f, 0.9420211860297554f,
-	0.1179035927666181f,
 	// Elliptic N=8 F/Fs=0.37054794520547946 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9802531781178612f, 1.0f, 0.06503545078701402f, 0.09420502953380545f,
 	1.0f, 1.8591265301636266f, 0.9999999999999997f, 0.7246404425718845f, 0.5088760413795018f,
 	1.0f, 1.7318971823344702f, 1.0f, 1.1597139518981592f, 0.7910703434159658f,
 	1.0f, 1.6640144007606639f, 1.0f, 1.358501649411307f, 0.9421539972211223f,
 	0.11868991615450365f,
-	// Elliptic N=8 F/Fs=0.3709393346379648 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.980385892072943f, 0.9999999999999998f, 0.06873564837271608f, 0.0943076662626654f,
-	1.0f, 1.8600446846251337f, 0.9999999999999999f, 0.7288593217286937f, 0.5094803713140967f,
-	1.0f, 1.7335873192829139f, 1.0f, 1.163497475031177f, 0.791481111709673f,
-	1.0f, 1.6660941859759562f, 0.9999999999999998f, 1.3619480355285525f, 0.9422871496479561f,
-	0.11948124339608661f,
-	// Elliptic N=8 F/Fs=0.3713307240704501 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9805180258277097f, 1.0000000000000002f, 0.07244399649902553f, 0.09441622800648479f,
-	1.0f, 1.8609591983547953f, 1.0000000000000002f, 0.7330796851665605f, 0.5100888793804574f,
-	1.0f, 1.73527147670916f, 1.0f, 1.1672763056398907f, 0.7918933668456205f,
-	1.0f, 1.6681670876945685f, 1.0f, 1.3653870127954093f, 0.9424206426399406f,
-	0.12027760538293172f,
-	// Elliptic N=8 F/Fs=0.37172211350293544 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9806495813042775f, 0.9999999999999999f, 0.07616052737931686f, 0.09453075375211666f,
-	1.0f, 1.861870079983827f, 1.0000000000000002f, 0.7373015153727196f, 0.5107015761714916f,
-	1.0f, 1.7369496623691647f, 0.9999999999999999f, 1.1710504197074587f, 0.7923071083846671f,
-	1.0f, 1.6702331105818216f, 1.0f, 1.368818562600058f, 0.9425544755251346f,
-	0.12107903319631322f,
-	// Elliptic N=8 F/Fs=0.3721135029354207 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9807805604137738f, 1.0000000000000002f, 0.07988527336538286f, 0.09465128279608132f,
-	1.0f, 1.86277733810458f, 1.0f, 0.7415247946939227f, 0.5113184722995159f,
-	1.0f, 1.738621883997943f, 0.9999999999999998f, 1.174819793184107f, 0.7927223358793329f,
-	1.0f, 1.6722922593004657f, 1.0f, 1.3722426663604594f, 0.9426886476299763f,
-	0.12188555810840206f,
-	// Elliptic N=8 F/Fs=0.37250489236790607 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9809109650563945f, 1.0f, 0.08361826694801255f, 0.0947778547472294f,
-	1.0f, 1.8636809812706647f, 1.0f, 0.7457495053356457f, 0.5119395783961251f,
-	1.0f, 1.740288149309515f, 1.0000000000000002f, 1.1785844019871845f, 0.7931390488737577f,
-	1.0f, 1.67434453851054f, 1.0000000000000002f, 1.3756593055244186f, 0.9428231582792835f,
-	0.12269721158345942f,
-	// Elliptic N=8 F/Fs=0.37289628180039136 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.981040797121468f, 1.0000000000000002f, 0.0873595407575667f, 0.09491050952943074f,
-	1.0f, 1.8645810179970725f, 1.0f, 0.7499756293612921f, 0.5125649051120618f,
-	1.0f, 1.7419484659968485f, 1.0f, 1.182344222001226f, 0.7935572469036651f,
-	1.0f, 1.6763899528692343f, 0.9999999999999998f, 1.3790684615696456f, 0.942958006796255f,
-	0.12351402527903928f,
 	// Elliptic N=8 F/Fs=0.3732876712328767 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9811700584875134f, 1.0f, 0.09110912756455837f, 0.09504928738428839f,
 	1.0f, 1.8654774567603032f, 1.0f, 0.7542031486913972f, 0.513194463117081f,
 	1.0f, 1.7436028417318106f, 1.0000000000000002f, 1.1860992290780121f, 0.7939769294963206f,
 	1.0f, 1.6784285070307559f, 1.0f, 1.3824701160038209f, 0.9430931925024695f,
 	0.12433603104719801f,
-	// Elliptic N=8 F/Fs=0.37367906066536205 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9812987510223015f, 0.9999999999999999f, 0.09486706028023105f, 0.09519422887387921f,
-	1.0f, 1.866370305998485f, 1.0f, 0.7584320451028265f, 0.5138282630998174f,
-	1.0f, 1.7452512841651113f, 1.0000000000000002f, 1.1898493990366341f, 0.7943980961704953f,
-	1.0f, 1.6804602056461888f, 1.0000000000000004f, 1.3858642503646628f, 0.9432287147178907f,
-	0.1251632609357119f,
-	// Elliptic N=8 F/Fs=0.37407045009784734 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9814268765829148f, 1.0f, 0.09863337195713369f, 0.09534537488352023f,
-	1.0f, 1.8672595741114992f, 1.0000000000000002f, 0.7626623002279684f, 0.5144663157676449f,
-	1.0f, 1.7468938009262513f, 1.0f, 1.193594707663554f, 0.7948207464364268f,
-	1.0f, 1.6824850533633604f, 0.9999999999999998f, 1.389250846219985f, 0.9433645727608659f,
-	0.12599574718930168f,
-	// Elliptic N=8 F/Fs=0.37446183953033263 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.981554437015805f, 0.9999999999999999f, 0.10240809578970429f, 0.0955027666245612f,
-	1.0f, 1.8681452694611005f, 1.0f, 0.7668938955539332f, 0.5151086318465372f,
-	1.0f, 1.7485303996234736f, 1.0f, 1.1973351307126712f, 0.7952448797957768f,
-	1.0f, 1.6845030548267104f, 0.9999999999999999f, 1.3926298851677663f, 0.9435007659481278f,
-	0.12683352225086572f,
-	// Elliptic N=8 F/Fs=0.37485322896281803 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9816814341568534f, 1.0f, 0.1061912651148494f, 0.09566644563720521f,
-	1.0f, 1.8690274003710405f, 0.9999999999999996f, 0.7711268124217434f, 0.5157552220809274f,
-	1.0f, 1.7501610878437104f, 0.9999999999999998f, 1.2010706439053924f, 0.7956704957415967f,
-	1.0f, 1.6865142146771548f, 1.0f, 1.396001348836215f, 0.9436372935947959f,
-	0.12767661876272196f,
-	// Elliptic N=8 F/Fs=0.3752446183953033 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9818078698314276f, 1.0000000000000002f, 0.10998291341251526f, 0.095836453793354f,
-	1.0f, 1.8699059751271887f, 1.0000000000000002f, 0.7753610320255149f, 0.5164060972335611f,
-	1.0f, 1.7517858731525324f, 1.0f, 1.2048012229306897f, 0.7960975937582848f,
-	1.0f, 1.6885185375519511f, 1.0f, 1.399365218883827f, 0.9437741550143779f,
-	0.1285250695678537f,
-	// Elliptic N=8 F/Fs=0.3756360078277886 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.98193374585444f, 0.9999999999999999f, 0.11378307430627879f, 0.09601283329948311f,
-	1.0f, 1.8707810019776492f, 0.9999999999999999f, 0.7795965354116531f, 0.517061268085352f,
-	1.0f, 1.7534047630941014f, 1.0000000000000002f, 1.2085268434451788f, 0.7965261733215481f,
-	1.0f, 1.6905160280845732f, 1.0000000000000002f, 1.4027214769994578f, 0.94391134951877f,
-	0.12937890771116933f,
 	// Elliptic N=8 F/Fs=0.376027397260274 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.982059064030406f, 1.0f, 0.11759178156392082f, 0.09619562669954305f,
 	1.0f, 1.871652489132888f, 1.0f, 0.7838333034780308f, 0.517720745435233f,
 	1.0f, 1.755017765191121f, 0.9999999999999998f, 1.212247481073185f, 0.7969562338983633f,
 	1.0f, 1.692506690904577f, 1.0f, 1.4060701049023847f, 0.9440488764182593f,
 	0.13023816644076527f,
-	// Elliptic N=8 F/Fs=0.3764187866927593 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9821838261534996f, 1.0f, 0.12140906909800447f, 0.09638487687788816f,
-	1.0f, 1.872520444765846f, 0.9999999999999998f, 0.7880713169731669f, 0.518384540100004f,
-	1.0f, 1.7566248869447878f, 0.9999999999999998f, 1.2159631114068126f, 0.7973877749469374f,
-	1.0f, 1.6944905306374702f, 0.9999999999999998f, 1.4094110843423697f, 0.9441867350215247f,
-	0.131102879209198f,
-	// Elliptic N=8 F/Fs=0.37681017612524464 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9823080340076102f, 1.0000000000000002f, 0.1252349709664598f, 0.09658062706223518f,
-	1.0f, 1.873384877012063f, 1.0000000000000004f, 0.7923105564954095f, 0.5190526629141816f,
-	1.0f, 1.758226135834745f, 0.9999999999999998f, 1.2196737100060198f, 0.7978207959166668f,
-	1.0f, 1.6964675519045875f, 0.9999999999999998f, 1.4127443970997262f, 0.9443249246356369f,
-	0.13197307967476665f,
-	// Elliptic N=8 F/Fs=0.37720156555773 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9824316893663996f, 1.0000000000000002f, 0.1290695213731606f, 0.0967829208266483f,
-	1.0f, 1.8742457939697914f, 0.9999999999999996f, 0.7965510024921085f, 0.5197251247298403f,
-	1.0f, 1.7598215193190354f, 0.9999999999999999f, 1.2233792523986922f, 0.7982552962480989f,
-	1.0f, 1.6984377593229596f, 1.0f, 1.416070024985386f, 0.9444634445660616f,
-	0.1328488017028002f,
-	// Elliptic N=8 F/Fs=0.3775929549902153 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9825547939933565f, 1.0000000000000002f, 0.1329127546685025f, 0.09699180209455431f,
-	1.0f, 1.8751032037001218f, 1.0f, 0.8007926352587869f, 0.5204019364164576f,
-	1.0f, 1.7614110448340539f, 1.0000000000000002f, 1.2270797140807166f, 0.7986912753728933f,
-	1.0f, 1.700401157505186f, 1.0000000000000002f, 1.419387949840959f, 0.9446022941166589f,
-	0.13373007936695458f,
-	// Elliptic N=8 F/Fs=0.3779843444227006 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9826773496418533f, 1.0f, 0.13676470534998544f, 0.09720731514178639f,
-	1.0f, 1.8759571142270928f, 1.0f, 0.805035434938316f, 0.5210831088607535f,
-	1.0f, 1.7629947197945037f, 1.0f, 1.2307750705160574f, 0.7991287327137795f,
-	1.0f, 1.702357751059312f, 0.9999999999999998f, 1.422698153538806f, 0.9447414725896867f,
-	0.13461694695051904f,
-	// Elliptic N=8 F/Fs=0.3783757338551859 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9827993580552f, 1.0000000000000002f, 0.14062540806278898f, 0.09742950459965681f,
-	1.0f, 1.8768075335378132f, 1.0000000000000004f, 0.8092793815200757f, 0.5217686529665264f,
-	1.0f, 1.7645725515933506f, 0.9999999999999999f, 1.2344652971368333f, 0.7995676676845186f,
-	1.0f, 1.7043075445887017f, 1.0f, 1.4260006179820959f, 0.9448809792857992f,
-	0.13550943894772813f,
 	// Elliptic N=8 F/Fs=0.37876712328767126 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9829208209666984f, 1.0000000000000002f, 0.1444948976003571f, 0.0976584154580601f,
 	1.0f, 1.8776544695825765f, 1.0f, 0.8135244548391309f, 0.5224585796544923f,
 	1.0f, 1.7661445476017805f, 1.0f, 1.2381503693434004f, 0.8000080796898643f,
 	1.0f, 1.7062505426919143f, 1.0f, 1.4292953251048803f, 0.9450208135040502f,
 	0.13640759006508482f,
-	// Elliptic N=8 F/Fs=0.37915851272015655 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9830417400996976f, 1.0000000000000002f, 0.14837320890496797f, 0.0978940930686051f,
-	1.0f, 1.87849793027498f, 1.0000000000000004f, 0.8177706345753821f, 0.5231528998621139f,
-	1.0f, 1.767710715169152f, 1.0f, 1.2418302625044255f, 0.8004499681255213f,
-	1.0f, 1.7081867499625796f, 0.9999999999999999f, 1.4325822568721502f, 0.9451609745418941f,
-	0.1373114352226898f,
-	// Elliptic N=8 F/Fs=0.3795499021526419 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9831621171676463f, 1.0f, 0.15226037706831963f, 0.09813658314777837f,
-	1.0f, 1.8793379234920362f, 0.9999999999999996f, 0.8220179002527354f, 0.5238516245434346f,
-	1.0f, 1.7692710616229574f, 1.0000000000000002f, 1.2455049519569734f, 0.8008933323781058f,
-	1.0f, 1.7101161709892783f, 1.0f, 1.4358613952799089f, 0.9453014616951853f,
-	0.1382210095555803f,
-	// Elliptic N=8 F/Fs=0.3799412915851272 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9832819538741473f, 0.9999999999999997f, 0.1561564373321007f, 0.09838593178013719f,
-	1.0f, 1.8801744570742938f, 1.0f, 0.8262662312382526f, 0.5245547646689044f,
-	1.0f, 1.7708255942687765f, 1.0f, 1.2491744130065834f, 0.8013381718251056f,
-	1.0f, 1.7120388103554158f, 1.0f, 1.4391327223552322f, 0.9454422742581818f,
-	0.13913634841507705f,
-	// Elliptic N=8 F/Fs=0.38033268101761253 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9834012519130104f, 1.0f, 0.16006142508857535f, 0.09864218542153409f,
-	1.0f, 1.8810075388259464f, 0.9999999999999998f, 0.8305156067413156f, 0.5252623312252072f,
-	1.0f, 1.7723743203902393f, 1.0f, 1.2528386209273616f, 0.8017844858348397f,
-	1.0f, 1.713954672639108f, 0.9999999999999998f, 1.4423962201563414f, 0.9455834115235451f,
-	0.14005748737014048f,
-	// Elliptic N=8 F/Fs=0.3807240704500978 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9835200129683033f, 1.0000000000000002f, 0.16397537588114958f, 0.09890539090237208f,
-	1.0f, 1.8818371765149515f, 0.9999999999999999f, 0.83476600581277f, 0.5259743352150841f,
-	1.0f, 1.7739172472489797f, 1.0f, 1.2564975509620584f, 0.8022322737664191f,
-	1.0f, 1.7158637624130546f, 0.9999999999999999f, 1.4456518707726624f, 0.9457248727823429f,
-	0.14098446220873362f,
-	// Elliptic N=8 F/Fs=0.38111545988258316 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9836382387144054f, 1.0f, 0.1678983254049543f, 0.09917559543089192f,
-	1.0f, 1.8826633778731419f, 0.9999999999999997f, 0.8390174073440827f, 0.5266907876571543f,
-	1.0f, 1.775454382084599f, 0.9999999999999999f, 1.2601511783221582f, 0.8026815349697041f,
-	1.0f, 1.717766084244425f, 1.0f, 1.4488996563248964f, 0.9458666573240471f,
-	0.1419173089391963f,
 	// Elliptic N=8 F/Fs=0.3815068493150685 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9837559308160604f, 1.0f, 0.17183030950741734f, 0.09945284659649091f,
 	1.0f, 1.8834861505963416f, 1.0000000000000002f, 0.8432697900664871f, 0.5274116995857336f,
 	1.0f, 1.7769857321146236f, 1.0000000000000002f, 1.2637994781879691f, 0.8031322687852669f,
 	1.0f, 1.7196616426947369f, 1.0f, 1.4521395589650863f, 0.9460087644365394f,
 	0.14285606379162527f,
-	// Elliptic N=8 F/Fs=0.3818982387475538 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9838730909284257f, 1.0f, 0.1757713641888346f, 0.09973719237307364f,
-	1.0f, 1.8843055023444741f, 1.0000000000000002f, 0.8475231325501279f, 0.5281370820506507f,
-	1.0f, 1.7785113045344647f, 1.0f, 1.2674424257087074f, 0.8035844745443484f,
-	1.0f, 1.7215504423197407f, 1.0f, 1.4553715608766793f, 0.9461511934061084f,
-	0.14380076321926522f,
-	// Elliptic N=8 F/Fs=0.3822896281800391 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9839897206971246f, 1.0000000000000002f, 0.179721525602947f, 0.10002868112243554f,
-	1.0f, 1.88512144074168f, 0.9999999999999998f, 0.8517774132032074f, 0.52886694611706f,
-	1.0f, 1.780031106517383f, 1.0000000000000002f, 1.2710799960025936f, 0.8040381515688203f,
-	1.0f, 1.7234324876693028f, 1.0000000000000002f, 1.4585956442745984f, 0.9462939435174538f,
-	0.144751443899907f,
-	// Elliptic N=8 F/Fs=0.3826810176125245 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9841058217582965f, 1.0000000000000002f, 0.18368083005751104f, 0.10032736159767983f,
-	1.0f, 1.8859339733764275f, 0.9999999999999999f, 0.8560326102711272f, 0.5296013028652545f,
-	1.0f, 1.7815451452144462f, 1.0000000000000002f, 1.2747121641569423f, 0.8044932991711427f,
-	1.0f, 1.7253077832872892f, 1.0f, 1.4618117914053081f, 0.9464370140536862f,
-	0.1457081427372961f,
-	// Elliptic N=8 F/Fs=0.3830724070450098 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9842213957386488f, 1.0000000000000002f, 0.1876493140148655f, 0.10063328294666596f,
-	1.0f, 1.8867431078016208f, 0.9999999999999998f, 0.8602887018356209f, 0.5303401633904721f,
-	1.0f, 1.7830534277544927f, 1.0f, 1.278338905228251f, 0.804949916654323f,
-	1.0f, 1.7271763337114503f, 1.0f, 1.4650199845468779f, 0.9465804042963284f,
-	0.14667089686254797f,
-	// Elliptic N=8 F/Fs=0.38346379647749507 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.984336444255504f, 1.0000000000000002f, 0.19162701409250663f, 0.1009464947154937f,
-	1.0f, 1.887548851534715f, 0.9999999999999998f, 0.8645456658138981f, 0.5310835388027024f,
-	1.0f, 1.7845559612440962f, 1.0000000000000002f, 1.2819601942423031f, 0.8054080033118785f,
-	1.0f, 1.729038143473308f, 0.9999999999999998f, 1.4682202060090548f, 0.9467241135253178f,
-	0.14763974363557522f,
-	// Elliptic N=8 F/Fs=0.38385518590998047 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9844509689168524f, 1.0f, 0.1956139670636532f, 0.1012670468520196f,
-	1.0f, 1.8883512120578252f, 1.0f, 0.8688034799577755f, 0.5318314402264908f,
-	1.0f, 1.7860527527675252f, 1.0f, 1.2855760061942592f, 0.8058675584277923f,
-	1.0f, 1.7308932170980431f, 1.0000000000000004f, 1.4714124381333273f, 0.9468681410190064f,
-	0.1486147206465204f,
 	// Elliptic N=8 F/Fs=0.38424657534246576 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9845649713213993f, 0.9999999999999998f, 0.19961020985781122f, 0.10159498970940786f,
 	1.0f, 1.8891501968178348f, 1.0f, 0.8730621218528063f, 0.5325838788007375f,
 	1.0f, 1.7875438093867098f, 0.9999999999999998f, 1.2891863160487511f, 0.8063285812764729f,
 	1.0f, 1.7327415591043775f, 1.0f, 1.4745966632929914f, 0.9470124860541618f,
 	0.14959586571719957f,
-	// Elliptic N=8 F/Fs=0.3846379647749511 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9846784530586148f, 0.9999999999999994f, 0.20361577956134483f, 0.10193037404971694f,
-	1.0f, 1.889945813226509f, 1.0000000000000004f, 0.8773215689174155f, 0.533340865678497f,
-	1.0f, 1.7890291381412058f, 1.0f, 1.2927910987399893f, 0.8067910711227156f,
-	1.0f, 1.7345831740044715f, 1.0000000000000002f, 1.4777728638932235f, 0.9471571479059704f,
-	0.15058321690255666f,
-	// Elliptic N=8 F/Fs=0.38502935420743645 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.984791415708783f, 1.0000000000000002f, 0.20763071341803357f, 0.1022732510475193f,
-	1.0f, 1.8907380686605988f, 0.9999999999999999f, 0.8815817984020229f, 0.5341024120267736f,
-	1.0f, 1.790508746048157f, 1.0f, 1.2963903291718541f, 0.8072550272216588f,
-	1.0f, 1.7364180663038031f, 0.9999999999999999f, 1.4809410223711406f, 0.9473021258480356f,
-	0.15157681249212251f,
-	// Elliptic N=8 F/Fs=0.38542074363992174 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9849038608430463f, 0.9999999999999998f, 0.2116550488296392f, 0.10262367229355789f,
-	1.0f, 1.8915269704619557f, 1.0f, 0.88584278738817f, 0.5348685290263122f,
-	1.0f, 1.7919826401022636f, 1.0f, 1.2999839822180037f, 0.8077204488187449f,
-	1.0f, 1.7382462405010666f, 1.0000000000000002f, 1.4841011211958746f, 0.9474474191523823f,
-	0.15257669101148733f,
-	// Elliptic N=8 F/Fs=0.3858121330724071 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.98501579002346f, 0.9999999999999999f, 0.21568882335646508f, 0.10298168979843805f,
-	1.0f, 1.8923125259376343f, 1.0f, 0.8901045127876454f, 0.5356392278713906f,
-	1.0f, 1.793450827275747f, 1.0f, 1.3035720327219744f, 0.808187335149679f,
-	1.0f, 1.7400677010880572f, 0.9999999999999998f, 1.4872531428686386f, 0.9475930270894564f,
-	0.15358289122378033f,
-	// Elliptic N=8 F/Fs=0.38620352250489237 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9851272048030335f, 0.9999999999999997f, 0.21973207471791092f, 0.10334735599635445f,
-	1.0f, 1.8930947423600026f, 1.0f, 0.8943669513416003f, 0.5364145197696055f,
-	1.0f, 1.7949133145183145f, 0.9999999999999996f, 1.3071544554972843f, 0.8086556854403872f,
-	1.0f, 1.741882452549565f, 1.0000000000000002f, 1.4903970699227904f, 0.9477389489281256f,
-	0.15459545213115788f,
-	// Elliptic N=8 F/Fs=0.3865949119373777 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9852381067257823f, 1.0000000000000002f, 0.22378484079303512f, 0.10372072374885594f,
-	1.0f, 1.8938736269668492f, 1.0000000000000002f, 0.8986300796196734f, 0.5371944159416572f,
-	1.0f, 1.7963701087571307f, 1.0f, 1.3107312253275398f, 0.8091254989069756f,
-	1.0f, 1.7436904993632667f, 0.9999999999999998f, 1.4935328849239078f, 0.9478851839356819f,
-	0.155614412976304f,
 	// Elliptic N=8 F/Fs=0.386986301369863 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9853484973267697f, 0.9999999999999999f, 0.22784715962110536f, 0.10410184634864626f,
 	1.0f, 1.894649186961489f, 0.9999999999999998f, 0.9028938740191045f, 0.5379789276211313f,
 	1.0f, 1.7978212168967784f, 0.9999999999999999f, 1.3143023169665446f, 0.8095967747556898f,
 	1.0f, 1.7454918459996198f, 1.0f, 1.496660570469851f, 0.9480317313778421f,
 	0.15663981324393625f,
-	// Elliptic N=8 F/Fs=0.38737769080234835 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9854583781321593f, 1.0000000000000002f, 0.23191906940215312f, 0.10449077752342203f,
-	1.0f, 1.8954214295128717f, 0.9999999999999999f, 0.9071583107638513f, 0.5387680660542788f,
-	1.0f, 1.7992666458192335f, 1.0f, 1.317867705138406f, 0.8100695121828732f,
-	1.0f, 1.7472864969217543f, 1.0f, 1.4997801091908347f, 0.9481785905187492f,
-	0.15767169266232486f,
-	// Elliptic N=8 F/Fs=0.38776908023483364 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9855677506592546f, 0.9999999999999997f, 0.23600060849752028f, 0.10488757143974857f,
-	1.0f, 1.8961903617556841f, 1.0f, 0.9114233659036973f, 0.5395618424997902f,
-	1.0f, 1.8007064023838268f, 1.0f, 1.3214273645376429f, 0.810543710374924f,
-	1.0f, 1.749074456585368f, 1.0f, 1.5028914837494942f, 0.9483257606209742f,
-	0.15871009120481772f,
-	// Elliptic N=8 F/Fs=0.388160469667319 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9856766164165525f, 1.0f, 0.2400918154304117f, 0.10529228270697343f,
-	1.0f, 1.8969559907904578f, 1.0f, 0.9156890153133698f, 0.5403602682285709f,
-	1.0f, 1.8021404934272187f, 1.0f, 1.3249812698293026f, 0.8110193685082578f,
-	1.0f, 1.7508557294386229f, 1.0f, 1.5059946768409571f, 0.9484732409455172f,
-	0.1597550490913776f,
-	// Elliptic N=8 F/Fs=0.3885518590998043 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9857849769037808f, 1.0000000000000002f, 0.24419272888643775f, 0.10570496638117874f,
-	1.0f, 1.8977183236836745f, 1.0000000000000004f, 0.9199552346916425f, 0.5411633545235098f,
-	1.0f, 1.8035689257633647f, 1.0f, 1.3285293956490702f, 0.8114964857492628f,
-	1.0f, 1.7526303199220403f, 1.0000000000000002f, 1.5090896711929076f, 0.9486210307518064f,
-	0.16080660679012854f,
-	// Elliptic N=8 F/Fs=0.3889432485322896 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.985892833611948f, 0.9999999999999998f, 0.24830338771415827f, 0.10612567796917151f,
-	1.0f, 1.8984773674678677f, 1.0f, 0.9242219995604474f, 0.5419711126792497f,
-	1.0f, 1.8049917061834866f, 0.9999999999999999f, 1.3320717166033837f, 0.8119750612542594f,
-	1.0f, 1.7543982324683975f, 0.9999999999999998f, 1.5121764495656616f, 0.9487691292977043f,
-	0.16186480501890999f,
-	// Elliptic N=8 F/Fs=0.38933463796477497 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.986000188023389f, 1.0f, 0.2524238309256196f, 0.10655447343251354f,
-	1.0f, 1.8992331291417297f, 1.0f, 0.9284892852639723f, 0.5427835540019478f,
-	1.0f, 1.806408841456043f, 1.0f, 1.3356082072695483f, 0.812455094169459f,
-	1.0f, 1.7561594715026259f, 0.9999999999999999f, 1.5152549947522287f, 0.9489175358395039f,
-	0.1629296847468424f,
 	// Elliptic N=8 F/Fs=0.38972602739726026 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9861070416118056f, 0.9999999999999999f, 0.2565540976968964f, 0.10699140919159164f,
 	1.0f, 1.8999856156702135f, 1.0000000000000002f, 0.9327570669677723f, 0.5436006898090419f,
 	1.0f, 1.8078203383266995f, 1.0f, 1.3391388421958559f, 0.8129365836309224f,
 	1.0f, 1.7579140414417083f, 0.9999999999999998f, 1.5183252895783872f, 0.9490662496319329f,
 	0.16400128719590282f,
-	// Elliptic N=8 F/Fs=0.39011741682974554 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9862133958423145f, 0.9999999999999998f, 0.26069422736862335f, 0.10743654212972634f,
-	1.0f, 1.9007348339846348f, 1.0000000000000002f, 0.937025319657865f, 0.5444225314290064f,
-	1.0f, 1.8092262035183004f, 1.0f, 1.342663595901703f, 0.8134195287645174f,
-	1.0f, 1.7596619466945798f, 1.0f, 1.521387316902751f, 0.9492152699281533f,
-	0.16507965384250814f,
-	// Elliptic N=8 F/Fs=0.39050880626223095 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9863192521714883f, 0.9999999999999994f, 0.2648442594465279f, 0.1078899295973223f,
-	1.0f, 1.9014807909827762f, 0.9999999999999997f, 0.9412940181398325f, 0.5452490902011096f,
-	1.0f, 1.8106264437308406f, 0.9999999999999999f, 1.3461824428777103f, 0.8139039286858785f,
-	1.0f, 1.7614031916620252f, 0.9999999999999999f, 1.5244410596168403f, 0.9493645959797654f,
-	0.16616482641911048f,
-	// Elliptic N=8 F/Fs=0.39090019569471623 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9864246120474025f, 1.0f, 0.26900423360195447f, 0.10835162941605841f,
-	1.0f, 1.9022234935289897f, 0.9999999999999998f, 0.9455631370379152f, 0.546080377475165f,
-	1.0f, 1.8120210656414373f, 1.0000000000000004f, 1.3496953575858437f, 0.8143897825003636f,
-	1.0f, 1.7631377807365811f, 1.0f, 1.5274865006451486f, 0.9495142270368055f,
-	0.16725684691580073f,
-	// Elliptic N=8 F/Fs=0.3912915851272015 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9865294769096735f, 1.0000000000000002f, 0.27317418967239526f, 0.10882169988312049f,
-	1.0f, 1.9029629484542951f, 0.9999999999999997f, 0.9498326507941124f, 0.5469164046112832f,
-	1.0f, 1.8134100759043006f, 0.9999999999999997f, 1.3532023144595395f, 0.8148770893030144f,
-	1.0f, 1.7648657183024368f, 1.0f, 1.5305236229452155f, 0.9496641623477495f,
-	0.1683557575819233f,
-	// Elliptic N=8 F/Fs=0.3916829745596869 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9866338481895065f, 0.9999999999999998f, 0.2773541676620096f, 0.10930019977547467f,
-	1.0f, 1.9036991625564854f, 1.0000000000000002f, 0.9541025336672739f, 0.547757182979618f,
-	1.0f, 1.8147934811507136f, 0.9999999999999999f, 1.3567032879038285f, 0.8153658481785122f,
-	1.0f, 1.7665870087353366f, 1.0000000000000002f, 1.5335524095076976f, 0.9498144011595149f,
-	0.16946160092770038f,
-	// Elliptic N=8 F/Fs=0.3920743639921722 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.986737727309737f, 1.0000000000000002f, 0.2815442077421349f, 0.10978718835418264f,
-	1.0f, 1.9044321426002222f, 1.0f, 0.9583727597321868f, 0.5486027239601086f,
-	1.0f, 1.816171287988996f, 1.0000000000000002f, 1.3601982522954577f, 0.8158560582011387f,
-	1.0f, 1.76830165640248f, 1.0000000000000002f, 1.5365728433564307f, 0.9499649427174588f,
-	0.17057441972586412f,
 	// Elliptic N=8 F/Fs=0.39246575342465756 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9868411156848698f, 0.9999999999999997f, 0.28574435025181494f, 0.11028272536876094f,
 	1.0f, 1.9051618953171419f, 1.0000000000000002f, 0.9626433028786786f, 0.5494530389422239f,
 	1.0f, 1.8175435030044849f, 0.9999999999999998f, 1.3636871819830254f, 0.8163477184347305f,
 	1.0f, 1.7700096656624298f, 1.0000000000000002f, 1.5395849075485122f, 0.9501157862653817f,
 	0.17169425701330376f,
-	// Elliptic N=8 F/Fs=0.3928571428571429 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9869440147211268f, 1.0f, 0.2899546356982968f, 0.11078687106158158f,
-	1.0f, 1.9058884274059504f, 0.9999999999999999f, 0.9669141368106915f, 0.5503081393246958f,
-	1.0f, 1.8189101327595085f, 1.0f, 1.367170051287105f, 0.8168408279326418f,
-	1.0f, 1.771711040865011f, 0.9999999999999997f, 1.5425885851743615f, 0.9502669310455294f,
-	0.17282115609271764f,
-	// Elliptic N=8 F/Fs=0.3932485322896282 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9870464258164824f, 0.9999999999999999f, 0.29417510475754327f, 0.11129968617231682f,
-	1.0f, 1.9066117455325258f, 1.0000000000000002f, 0.9711852350453779f, 0.5511680365152573f,
-	1.0f, 1.8202711837933574f, 1.0000000000000002f, 1.3706468345003757f, 0.8173353857376987f,
-	1.0f, 1.7734057863512198f, 1.0f, 1.5455838593577937f, 0.9504183762985925f,
-	0.1739551605342785f,
-	// Elliptic N=8 F/Fs=0.39363992172211354 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9871483503607101f, 1.0000000000000002f, 0.298405798274736f, 0.11182123194242855f,
-	1.0f, 1.9073318563300137f, 1.0f, 0.9754565709121854f, 0.5520327419303717f,
-	1.0f, 1.8216266626222632f, 1.0000000000000002f, 1.374117505887757f, 0.8178313908821586f,
-	1.0f, 1.775093906453126f, 1.0000000000000002f, 1.5485707132560929f, 0.9505701212637085f,
-	0.17509631417730784f,
-	// Elliptic N=8 F/Fs=0.39403131115459883 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9872497897354202f, 1.0000000000000002f, 0.3026467572647712f, 0.11235157011970065f,
-	1.0f, 1.9080487663989296f, 0.9999999999999998f, 0.9797281175519384f, 0.5529022669949625f,
-	1.0f, 1.8229765757393728f, 0.9999999999999999f, 1.377582039686541f, 0.8183288423876689f,
-	1.0f, 1.77677540549378f, 0.9999999999999998f, 1.5515491300600786f, 0.950722165178463f,
-	0.1762446611319617f,
-	// Elliptic N=8 F/Fs=0.3944227005870842 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9873507453141024f, 1.0000000000000002f, 0.3068980229127543f, 0.11289076296281725f,
-	1.0f, 1.9087624823072542f, 1.0f, 0.9839998479159219f, 0.5537766231421359f,
-	1.0f, 1.824320929614725f, 0.9999999999999999f, 1.381040410106528f, 0.8188277392652239f,
-	1.0f, 1.7784502877871229f, 1.0f, 1.5545190929941803f, 0.9508745072788913f,
-	0.1774002457809244f,
-	// Elliptic N=8 F/Fs=0.39481409001956946 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9874512184621653f, 1.0f, 0.31115963657448636f, 0.11343887324598537f,
-	1.0f, 1.9094730105905298f, 1.0f, 0.9882717347649596f, 0.5546558218129053f,
-	1.0f, 1.8256597306952256f, 1.0000000000000002f, 1.3844925913301602f, 0.8193280805151226f,
-	1.0f, 1.7801185576378866f, 0.9999999999999998f, 1.5574805853165044f, 0.9510271467994788f,
-	0.1785631127811147f,
 	// Elliptic N=8 F/Fs=0.3952054794520548 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9875512105369781f, 1.0f, 0.3154316397769548f, 0.11399596426360514f,
 	1.0f, 1.9101803577519603f, 1.0f, 0.9925437506685003f, 0.5555398744559086f,
 	1.0f, 1.8269929854046256f, 1.0000000000000002f, 1.387938557512667f, 0.8198298651269278f,
 	1.0f, 1.781780219341511f, 0.9999999999999998f, 1.5604335903189106f, 0.951180082973163f,
 	0.17973330706540222f,
-	// Elliptic N=8 F/Fs=0.3955968688845401 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9876507228879083f, 0.9999999999999998f, 0.31971407421880454f, 0.11456209983498362f,
-	1.0f, 1.910884530262506f, 1.0000000000000002f, 0.9968158680036867f, 0.5564287925271226f,
-	1.0f, 1.8283207001434973f, 0.9999999999999998f, 1.3913782827821963f, 0.8203330920794228f,
-	1.0f, 1.783435277184046f, 0.9999999999999999f, 1.5633780913270796f, 0.9513333150313368f,
-	0.1809108738443332f,
-	// Elliptic N=8 F/Fs=0.39598825831702544 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9877497568563638f, 0.9999999999999999f, 0.3240069817708191f, 0.11513734430909772f,
-	1.0f, 1.9115855345609787f, 1.0f, 1.0010880589544395f, 0.557322587489577f,
-	1.0f, 1.8296428812892147f, 1.0f, 1.3948117412399612f, 0.8208377603405692f,
-	1.0f, 1.7850837354420641f, 0.9999999999999998f, 1.5663140717005846f, 0.9514868422038446f,
-	0.18209585860786795f,
-	// Elliptic N=8 F/Fs=0.39637964774951073 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.98784831377583f, 1.0000000000000004f, 0.3283104044763839f, 0.11572176256940278f,
-	1.0f, 1.9122833770541392f, 1.0f, 1.0053602955105267f, 0.5582212708130607f,
-	1.0f, 1.8309595351959265f, 1.0000000000000004f, 1.39823890696038f, 0.8213438688674652f,
-	1.0f, 1.78672559838257f, 1.0000000000000002f, 1.5692415148329635f, 0.9516406637189891f,
-	0.1832883071271267f,
-	// Elliptic N=8 F/Fs=0.3967710371819961 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9879463949719092f, 0.9999999999999999f, 0.33262438455195825f, 0.1163154200386903f,
-	1.0f, 1.912978064116792f, 1.0000000000000002f, 1.009632549466646f, 0.55912485397383f,
-	1.0f, 1.8322706681945387f, 0.9999999999999998f, 1.401659753991225f, 0.821851416606304f,
-	1.0f, 1.788360870262912f, 1.0000000000000002f, 1.5721604041517945f, 0.9517947788035304f,
-	0.1844882654561508f,
-	// Elliptic N=8 F/Fs=0.3971624266144814 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9880440017623622f, 0.9999999999999999f, 0.3369489643875242f, 0.1169183826839924f,
-	1.0f, 1.913669602091878f, 0.9999999999999999f, 1.0139047924214877f, 0.5600333484543083f,
-	1.0f, 1.8335762865926937f, 1.0000000000000002f, 1.4050742563537628f, 0.8223604024923298f,
-	1.0f, 1.7899895553306926f, 0.9999999999999999f, 1.57507072311876f, 0.9519491866826855f,
-	0.18569577993366784f,
-	// Elliptic N=8 F/Fs=0.3975538160469667 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.988141135457143f, 1.0f, 0.3412841865470439f, 0.11753071702153557f,
-	1.0f, 1.914357997290572f, 1.0000000000000002f, 1.0181769957768105f, 0.560946765742784f,
-	1.0f, 1.834876396674744f, 0.9999999999999997f, 1.4084823880429045f, 0.8228708254497964f,
-	1.0f, 1.7916116578236823f, 1.0000000000000002f, 1.5779724552297254f, 0.9521038865801337f,
-	0.18691089718487258f,
 	// Elliptic N=8 F/Fs=0.397945205479452 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9882377973584389f, 1.0f, 0.34563009376890624f, 0.11815249012174464f,
 	1.0f, 1.915043255992373f, 0.9999999999999999f, 1.0224491307365149f, 0.5618651173331098f,
 	1.0f, 1.8361710047017399f, 1.0000000000000004f, 1.4118841230273544f, 0.8233826843919246f,
 	1.0f, 1.7932271819697296f, 1.0000000000000002f, 1.5808655840148076f, 0.9522588777180132f,
 	0.18813366412321755f,
-	// Elliptic N=8 F/Fs=0.3983365949119374 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.988333988760708f, 0.9999999999999997f, 0.34998672896636984f, 0.11878376961429538f,
-	1.0f, 1.915725384445201f, 0.9999999999999999f, 1.0267211683057107f, 0.5627884147243902f,
-	1.0f, 1.8374601169114018f, 0.9999999999999998f, 1.4152794352497664f, 0.8238959782208621f,
-	1.0f, 1.7948361319866795f, 1.0f, 1.583750093038453f, 0.952414159316928f,
-	0.18936412795221375f,
-	// Elliptic N=8 F/Fs=0.3987279843444227 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9884297109507187f, 0.9999999999999997f, 0.3543541352279872f, 0.11942462369321663f,
-	1.0f, 1.9164043888654865f, 1.0000000000000002f, 1.0309930792897786f, 0.5637166694206718f,
-	1.0f, 1.8387437395181059f, 1.0000000000000002f, 1.418668298626882f, 0.8244107058276354f,
-	1.0f, 1.7964385120822817f, 1.0000000000000004f, 1.5866259658994992f, 0.9525697305959433f,
-	0.1906023361672401f,
-	// Elliptic N=8 F/Fs=0.399119373776908 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9885249652075838f, 1.0f, 0.35873235581804336f, 0.1200751211220458f,
-	1.0f, 1.9170802754382648f, 0.9999999999999998f, 1.0352648342934456f, 0.564649892930627f,
-	1.0f, 1.8400218787128602f, 0.9999999999999999f, 1.4220506870496996f, 0.8249268660921145f,
-	1.0f, 1.7980343264541083f, 1.0000000000000002f, 1.5894931862312587f, 0.9527255907725914f,
-	0.19184833655736888f,
-	// Elliptic N=8 F/Fs=0.3995107632093934 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.988619752802799f, 0.9999999999999998f, 0.36312143417697595f, 0.1207353312390338f,
-	1.0f, 1.9177530503172693f, 1.0f, 1.039536403719852f, 0.5655880967672382f,
-	1.0f, 1.841294540663292f, 1.0000000000000002f, 1.4254265743836239f, 0.8254444578829654f,
-	1.0f, 1.7996235792894721f, 0.9999999999999998f, 1.5923517377015868f, 0.9528817390628704f,
-	0.19310217720719908f,
-	// Elliptic N=8 F/Fs=0.39990215264187867 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9887140750002816f, 1.0f, 0.36752141392177845f, 0.12140532396240096f,
-	1.0f, 1.9184227196250183f, 0.9999999999999997f, 1.0438077577696048f, 0.5665312924474715f,
-	1.0f, 1.84256173151362f, 1.0f, 1.4287959344686179f, 0.8259634800576093f,
-	1.0f, 1.8012062747653375f, 1.0000000000000002f, 1.5952016040129526f, 0.953038174681248f,
-	0.19436390649869706f,
-	// Elliptic N=8 F/Fs=0.400293542074364 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9888079330564044f, 0.9999999999999998f, 0.3719323388464212f, 0.12208516979564846f,
-	1.0f, 1.9190892894529126f, 1.0f, 1.0480788664398542f, 0.5674794914919536f,
-	1.0f, 1.8438234573846453f, 1.0f, 1.4321587411193706f, 0.8264839314621801f,
-	1.0f, 1.8027824170482394f, 1.0f, 1.5980427689025163f, 0.9531948968406596f,
-	0.1956335731130566f,
 	// Elliptic N=8 F/Fs=0.40068493150684936 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.988901328220034f, 0.9999999999999999f, 0.37635425292224317f, 0.12277493983291991f,
 	1.0f, 1.9197527658613194f, 0.9999999999999997f, 1.0523496995233526f, 0.5684327054246432f,
 	1.0f, 1.845079724373728f, 1.0f, 1.4355149681254529f, 0.8270058109314824f,
 	1.0f, 1.8043520102942023f, 1.0000000000000002f, 1.6008752161421995f, 0.9533519047525123f,
 	0.196911226032563f,
-	// Elliptic N=8 F/Fs=0.40107632093933465 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9889942617325653f, 0.9999999999999997f, 0.38078720029834456f, 0.12347470576441738f,
-	1.0f, 1.9204131548796681f, 0.9999999999999999f, 1.056620226607513f, 0.5693909457724946f,
-	1.0f, 1.84633053855477f, 1.0f, 1.4388645892514764f, 0.8275291172889465f,
-	1.0f, 1.8059150586486543f, 0.9999999999999997f, 1.6036989295387596f, 0.9535091976266858f,
-	0.19819691454247015f,
-	// Elliptic N=8 F/Fs=0.40146771037182 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9890867348279595f, 1.0000000000000004f, 0.3852312253019753f, 0.12418453988187227f,
-	1.0f, 1.9210704625065367f, 1.0f, 1.0608904170734783f, 0.5703542240651259f,
-	1.0f, 1.8475759059781995f, 1.0f, 1.442207578237264f, 0.8280538493465907f,
-	1.0f, 1.8074715662463514f, 1.0f, 1.6065138929338627f, 0.9536667746715322f,
-	0.19949068823289062f,
-	// Elliptic N=8 F/Fs=0.4018590998043053 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9891787487327746f, 0.9999999999999999f, 0.38968637243890775f, 0.12490451508406941f,
-	1.0f, 1.9217246947097417f, 1.0f, 1.0651602400951763f, 0.5713225518344753f,
-	1.0f, 1.8488158326709527f, 0.9999999999999998f, 1.4455439087980113f, 0.8285800059049735f,
-	1.0f, 1.8090215372112903f, 1.0000000000000004f, 1.609320090204159f, 0.9538246350938804f,
-	0.20079259700069488f,
-	// Elliptic N=8 F/Fs=0.40225048923679063 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9892703046662086f, 0.9999999999999997f, 0.394152686393808f, 0.12563470488242795f,
-	1.0f, 1.9223758574264278f, 0.9999999999999999f, 1.0694296646383816f, 0.5722959406144579f,
-	1.0f, 1.8500503246364588f, 1.0f, 1.4488735546244529f, 0.8291075857531545f,
-	1.0f, 1.8105649756566327f, 1.0000000000000002f, 1.6121175052613543f, 0.9539827780990344f,
-	0.20210269105142228f,
-	// Elliptic N=8 F/Fs=0.4026418786692759 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.989361403840129f, 1.0000000000000004f, 0.39863021203059257f, 0.12637518340663623f,
-	1.0f, 1.9230239565631557f, 0.9999999999999999f, 1.073698659459775f, 0.5732744019406195f,
-	1.0f, 1.8512793878546203f, 1.0f, 1.4521964893830301f, 0.8296365876686491f,
-	1.0f, 1.8121018856846236f, 1.0000000000000004f, 1.6149061220522842f, 0.9541412028907761f,
-	0.20342102090120298f,
-	// Elliptic N=8 F/Fs=0.40303326810176127 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9894520474591058f, 0.9999999999999997f, 0.40311899439278365f, 0.1271260254103449f,
-	1.0f, 1.92366899799599f, 0.9999999999999999f, 1.0779671931060038f, 0.5742579473497842f,
-	1.0f, 1.8525030282818007f, 1.0f, 1.4555126867160657f, 0.8301670104173892f,
-	1.0f, 1.8136322713865132f, 1.0f, 1.61768592455899f, 0.9542999086713666f,
-	0.20474763737869212f,
 	// Elliptic N=8 F/Fs=0.40342465753424656 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.989542236720454f, 1.0000000000000004f, 0.4076190787038498f, 0.1278873062769161f,
 	1.0f, 1.9243109875705873f, 1.0000000000000002f, 1.082235233912739f, 0.5752465883797002f,
 	1.0f, 1.8537212518508066f, 1.0f, 1.4588221202419314f, 0.8306988527536778f,
 	1.0f, 1.8151561368424791f, 0.9999999999999999f, 1.6204568967987911f, 0.9544588946415473f,
 	0.20608259162701484f,
-	// Elliptic N=8 F/Fs=0.4038160469667319 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9896319728142577f, 1.0f, 0.41213051036754006f, 0.12865910202522995f,
-	1.0f, 1.9249499311022817f, 1.0000000000000002f, 1.0865027500037343f, 0.5762403365686803f,
-	1.0f, 1.854934064470874f, 0.9999999999999999f, 1.4621247635552235f, 0.8312321134201476f,
-	1.0f, 1.8166734861215477f, 1.0000000000000002f, 1.6232190228243615f, 0.9546181600005428f,
-	0.20742593510572205f,
-	// Elliptic N=8 F/Fs=0.4042074363992172 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9897212569234133f, 1.0f, 0.4166533349682056f, 0.1294414893155497f,
-	1.0f, 1.9255858343761731f, 1.0f, 1.0907697092898805f, 0.5772392034552395f,
-	1.0f, 1.8561414720276515f, 0.9999999999999999f, 1.4654205902269348f, 0.8317667911477171f,
-	1.0f, 1.8181843232815147f, 0.9999999999999999f, 1.6259722867237993f, 0.9547777039460585f,
-	0.20877771959275848f,
-	// Elliptic N=8 F/Fs=0.40459882583170254 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9898100902236575f, 1.0000000000000004f, 0.42118759827111846f, 0.13023454545544558f,
-	1.0f, 1.9262187031472138f, 0.9999999999999999f, 1.0950360794682679f, 0.5782432005777295f,
-	1.0f, 1.857343480383186f, 0.9999999999999997f, 1.468709573804638f, 0.8323028846555506f,
-	1.0f, 1.8196886523688738f, 0.9999999999999998f, 1.6287166726207094f, 0.954937525674288f,
-	0.21013799718644194f,
-	// Elliptic N=8 F/Fs=0.4049902152641879 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9898984738836016f, 0.9999999999999999f, 0.42573334622277464f, 0.1310383484057785f,
-	1.0f, 1.9268485431402924f, 1.0f, 1.0993018280212394f, 0.5792523394739673f,
-	1.0f, 1.8585400953759106f, 1.0f, 1.4719916878126582f, 0.8328403926510128f,
-	1.0f, 1.8211864774187365f, 0.9999999999999997f, 1.6314521646742706f, 0.9550976243799076f,
-	0.21150682030745388f,
-	// Elliptic N=8 F/Fs=0.40538160469667317 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9899864090647688f, 1.0000000000000002f, 0.4302906249511848f, 0.13185297678674224f,
-	1.0f, 1.9274753600503198f, 1.0000000000000002f, 1.1035669222154478f, 0.5802666316808623f,
-	1.0f, 1.859731322820626f, 1.0000000000000002f, 1.4752669057522545f, 0.8333793138296279f,
-	1.0f, 1.8226778024547576f, 0.9999999999999997f, 1.6341787470793145f, 0.9552579992560832f,
-	0.21288424170084094f,
-	// Elliptic N=8 F/Fs=0.40577299412915846 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9900738969216207f, 1.0000000000000004f, 0.43485948076616465f, 0.13267850988396845f,
-	1.0f, 1.9280991595423147f, 1.0000000000000002f, 1.1078313291009125f, 0.5812860887340376f,
-	1.0f, 1.8609171685084906f, 1.0000000000000002f, 1.4785352011018027f, 0.8339196468750344f,
-	1.0f, 1.824162631489061f, 0.9999999999999997f, 1.636896404066401f, 0.9554186494944695f,
-	0.21427031443802982f,
 	// Elliptic N=8 F/Fs=0.40616438356164386 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9901609386015953f, 1.0f, 0.439439960159605f, 0.13351502765469142f,
 	1.0f, 1.9287199472514875f, 0.9999999999999998f, 1.1120950155100766f, 0.582310722167448f,
 	1.0f, 1.862097638207005f, 0.9999999999999998f, 1.4817965473169803f, 0.8344613904589466f,
 	1.0f, 1.8256409685221657f, 1.0f, 1.6396051199018915f, 0.9555795742852111f,
 	0.21566509191885272f,
-	// Elliptic N=8 F/Fs=0.40655577299412915 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9902475352451379f, 0.9999999999999997f, 0.4440321098057328f, 0.13436261073397504f,
-	1.0f, 1.9293377287833255f, 1.0f, 1.11635794805686f, 0.583340543512995f,
-	1.0f, 1.8632727376599998f, 0.9999999999999998f, 1.4850509178309486f, 0.8350045432411082f,
-	1.0f, 1.8271128175429092f, 0.9999999999999997f, 1.6423048788880246f, 0.9557407728169443f,
-	0.21706862787358214f,
-	// Elliptic N=8 F/Fs=0.40694716242661444 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9903336879857338f, 0.9999999999999999f, 0.4486359765613657f, 0.1352213404410029f,
-	1.0f, 1.9299525097136738f, 0.9999999999999999f, 1.1206200931357195f, 0.5843755643001362f,
-	1.0f, 1.8644424725876223f, 1.0000000000000002f, 1.4882982860545417f, 0.835549103869251f,
-	1.0f, 1.82857818252838f, 1.0000000000000004f, 1.6449956653629931f, 0.9559022442767993f,
-	0.21848097636498265f,
-	// Elliptic N=8 F/Fs=0.40733855185909984 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9904193979499383f, 0.9999999999999998f, 0.4532516074661511f, 0.13609129878543152f,
-	1.0f, 1.9305642955888218f, 1.0f, 1.1248814169207033f, 0.5854157960554927f,
-	1.0f, 1.8656068486863226f, 1.0000000000000004f, 1.491538625376456f, 0.8360950709790524f,
-	1.0f, 1.830037067443838f, 1.0f, 1.64767746370102f, 0.9560639878504008f,
-	0.2199021917903693f,
-	// Elliptic N=8 F/Fs=0.40772994129158513 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9905046662574117f, 1.0000000000000002f, 0.45787904974279003f, 0.13697256847380615f,
-	1.0f, 1.931173091925583f, 1.0f, 1.1291418853645043f, 0.5864612503024496f,
-	1.0f, 1.8667658716288422f, 1.0f, 1.494771909163437f, 0.8366424431940924f,
-	1.0f, 1.8314894762426484f, 0.9999999999999998f, 1.6503502583124305f, 0.9562260027218694f,
-	0.22133232888367904f,
-	// Elliptic N=8 F/Fs=0.4081213307240705 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.990589494020948f, 1.0f, 0.46251835079725956f, 0.13786523291604386f,
-	1.0f, 1.931778904211379f, 1.0000000000000002f, 1.1334014641975225f, 0.5875119385607561f,
-	1.0f, 1.8679195470642034f, 1.0f, 1.4979981107604776f, 0.8371912191258117f,
-	1.0f, 1.832935412866208f, 0.9999999999999998f, 1.6530140336437338f, 0.9563882880738243f,
-	0.22277144271755717f,
-	// Elliptic N=8 F/Fs=0.4085127201565558 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9906738823465089f, 0.9999999999999998f, 0.46716955821900913f, 0.13876937623197838f,
-	1.0f, 1.9323817379043216f, 1.0000000000000002f, 1.1376601189269147f, 0.5885678723461185f,
-	1.0f, 1.8690678806176944f, 1.0f, 1.5012172034910047f, 0.8377413973734671f,
-	1.0f, 1.8343748812438734f, 1.0f, 1.6556687741776925f, 0.9565508430873815f,
-	0.22421958870545006f,
 	// Elliptic N=8 F/Fs=0.4089041095890411 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9907578323332538f, 1.0000000000000002f, 0.4718327197811569f, 0.13968508325797457f,
 	1.0f, 1.932981598433292f, 1.0f, 1.1419178148356566f, 0.58962906316979f,
 	1.0f, 1.8702108778908595f, 0.9999999999999998f, 1.504429160657081f, 0.8382929765240907f,
 	1.0f, 1.835807885292891f, 0.9999999999999999f, 1.658314464433406f, 0.9567136669421603f,
 	0.22567682260371463f,
-	// Elliptic N=8 F/Fs=0.40929549902152645 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9908413450735691f, 1.0000000000000004f, 0.4765078834406649f, 0.1406124395536068f,
-	1.0f, 1.9335784911980256f, 0.9999999999999998f, 1.1461745169815984f, 0.5906955225381582f,
-	1.0f, 1.8713485444614884f, 0.9999999999999998f, 1.5076339555395997f, 0.8388459551524468f,
-	1.0f, 1.837234428918329f, 0.9999999999999998f, 1.6609510889663819f, 0.9568767588162799f,
-	0.22714320051373688f,
-	// Elliptic N=8 F/Fs=0.40968688845401174 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9909244216531012f, 1.0f, 0.4811950973384999f, 0.14155153140840496f,
-	1.0f, 1.9341724215691887f, 0.9999999999999999f, 1.15043019019652f, 0.5917672619523251f,
-	1.0f, 1.8724808858836028f, 1.0000000000000002f, 1.510831561398482f, 0.8394003318209884f,
-	1.0f, 1.838654516013006f, 0.9999999999999997f, 1.6635786323686133f, 0.9570401178863637f,
-	0.22861877888406246f,
-	// Elliptic N=8 F/Fs=0.4100782778864971 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.991007063150787f, 0.9999999999999999f, 0.4858944097997897f, 0.1425024458486704f,
-	1.0f, 1.9347633948884606f, 0.9999999999999997f, 1.1546847990851916f, 0.5928442929076854f,
-	1.0f, 1.873607907687448f, 1.0000000000000002f, 1.5140219514728819f, 0.8399561050798157f,
-	1.0f, 1.8400681504574232f, 0.9999999999999999f, 1.666197079268658f, 0.9572037433275404f,
-	0.23010361451254116f,
-	// Elliptic N=8 F/Fs=0.4104696673189824 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.991089270638883f, 1.0f, 0.49060586933395467f, 0.14346527064435807f,
-	1.0f, 1.935351416468614f, 1.0f, 1.1589383080244318f, 0.5939266268935004f,
-	1.0f, 1.87472961537948f, 0.9999999999999997f, 1.5172050989813854f, 0.8405132734666323f,
-	1.0f, 1.841475336119696f, 1.0000000000000002f, 1.6688064143317125f, 0.9573676343134441f,
-	0.23159776454847988f,
-	// Elliptic N=8 F/Fs=0.4108610567514677 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9911710451829947f, 1.0f, 0.49532952463483293f, 0.1444400943160304f,
-	1.0f, 1.9359364915935917f, 0.9999999999999997f, 1.1631906811621682f, 0.5950142753924683f,
-	1.0f, 1.875846014442359f, 0.9999999999999997f, 1.5203809771222176f, 0.841071835506704f,
-	1.0f, 1.8428760768554866f, 1.0000000000000002f, 1.6714066222596928f, 0.9575317900162187f,
-	0.23310128649481265f,
-	// Elliptic N=8 F/Fs=0.411252446183953 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9912523878421087f, 1.0000000000000002f, 0.5000654245807823f, 0.14542700614187898f,
-	1.0f, 1.9365186255185896f, 1.0000000000000002f, 1.1674418824164903f, 0.5961072498802851f,
-	1.0f, 1.876957110334935f, 1.0f, 1.5235495590734454f, 0.8416317897128145f,
-	1.0f, 1.8442703765079356f, 0.9999999999999999f, 1.6739976877913043f, 0.9576962096065145f,
-	0.2346142382102748f,
 	// Elliptic N=8 F/Fs=0.41164383561643836 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9913332996686186f, 0.9999999999999996f, 0.504813618234778f, 0.14642609616481947f,
 	1.0f, 1.9370978234701293f, 0.9999999999999998f, 1.1716918754747194f, 0.5972055618252103f,
 	1.0f, 1.8780629084922398f, 1.0000000000000002f, 1.5267108179931894f, 0.8421931345852243f,
 	1.0f, 1.8456582389075982f, 0.9999999999999997f, 1.6765795957021286f, 0.9578608922534954f,
 	0.23613667791159856f,
-	// Elliptic N=8 F/Fs=0.41203522504892365 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9914137817083604f, 0.9999999999999998f, 0.5095741548444853f, 0.1474374551996568f,
-	1.0f, 1.9376740906461432f, 0.9999999999999999f, 1.1759406237924634f, 0.5983092226876203f,
-	1.0f, 1.8791634143254776f, 0.9999999999999999f, 1.5298647270198302f, 0.8427558686116265f,
-	1.0f, 1.8470396678723762f, 1.0000000000000002f, 1.6791523308046936f, 0.9580258371248362f,
-	0.23766866417571325f,
-	// Elliptic N=8 F/Fs=0.412426614481409 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9914938350006348f, 0.9999999999999999f, 0.5143470838423216f, 0.14846117484032295f,
-	1.0f, 1.9382474322160461f, 0.9999999999999997f, 1.1801880905926831f, 0.5994182439195624f,
-	1.0f, 1.8802586332220173f, 1.0f, 1.5330112592722236f, 0.8433199902671071f,
-	1.0f, 1.848414667207451f, 1.0f, 1.6817158779485555f, 0.9581910433867262f,
-	0.23921025594196121f,
-	// Elliptic N=8 F/Fs=0.41281800391389434 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9915734605782405f, 0.9999999999999998f, 0.5191324548454973f, 0.1494973474671874f,
-	1.0f, 1.938817853320816f, 0.9999999999999998f, 1.1844342388647497f, 0.6005326369643005f,
-	1.0f, 1.881348570545379f, 1.0f, 1.5361503878499094f, 0.8438854980140991f,
-	1.0f, 1.8497832407052217f, 1.0000000000000002f, 1.6842702220203722f, 0.9583565102038692f,
-	0.24076151251432307f,
-	// Elliptic N=8 F/Fs=0.4132093933463796 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9916526594675017f, 1.0f, 0.5239303176560488f, 0.15054606625444378f,
-	1.0f, 1.939385359073069f, 0.9999999999999999f, 1.1886790313635152f, 0.6016524132558605f,
-	1.0f, 1.8824332316352301f, 1.0000000000000002f, 1.539282085833329f, 0.8444523903023404f,
-	1.0f, 1.8511453921452379f, 0.9999999999999999f, 1.6868153479439876f, 0.958522236739488f,
-	0.242322493563659f,
-	// Elliptic N=8 F/Fs=0.4136007827788649 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.991731432688296f, 1.0000000000000002f, 0.5287407222608446f, 0.15160742517756778f,
-	1.0f, 1.9399499545571366f, 1.0f, 1.1929224306083734f, 0.6027775842185688f,
-	1.0f, 1.8835126218073726f, 1.0000000000000002f, 1.542406326284043f, 0.8450206655688342f,
-	1.0f, 1.8525011252941384f, 0.9999999999999998f, 1.6893512406805022f, 0.9586882221553205f,
-	0.24389325912995874f,
-	// Elliptic N=8 F/Fs=0.4139921722113503 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.991809781254084f, 1.0000000000000004f, 0.5335637188315798f, 0.15268151902085308f,
-	1.0f, 1.940511644829141f, 0.9999999999999996f, 1.197164398882329f, 0.6039081612665869f,
-	1.0f, 1.8845867463537378f, 1.0f, 1.5455230822449495f, 0.8455903222378042f,
-	1.0f, 1.8538504439055856f, 1.0000000000000002f, 1.6918778852283591f, 0.9588544656116279f,
-	0.24547386962460435f,
 	// Elliptic N=8 F/Fs=0.4143835616438356 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9918877061719353f, 0.9999999999999999f, 0.5383993577247492f, 0.15376844338502205f,
 	1.0f, 1.941070434917073f, 1.0000000000000002f, 1.2014048982310608f, 0.6050441558034405f,
 	1.0f, 1.8856556105423765f, 1.0f, 1.5486323267405007f, 0.8461613587206508f,
 	1.0f, 1.855193351720201f, 1.0f, 1.694395266623414f, 0.9590209662671907f,
 	0.24706438583264478f,
-	// Elliptic N=8 F/Fs=0.4147749510763209 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9919652084425603f, 1.0f, 0.5432476894816073f, 0.15486829469491492f,
-	1.0f, 1.9416263298208611f, 0.9999999999999997f, 1.2056438904619968f, 0.6061855792215486f,
-	1.0f, 1.8867192196174507f, 0.9999999999999998f, 1.5517340327769318f, 0.8467337734159126f,
-	1.0f, 1.8565298524655076f, 1.0f, 1.6969033699390212f, 0.9591877232793129f,
-	0.24866486891508555f,
-	// Elliptic N=8 F/Fs=0.4151663405088063 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9920422890603324f, 0.9999999999999997f, 0.5481087648281051f, 0.15598117020725577f,
-	1.0f, 1.942179334512455f, 0.9999999999999997f, 1.2098813371433805f, 0.6073324429017412f,
-	1.0f, 1.887777578799228f, 0.9999999999999998f, 1.554828173342481f, 0.8473075647092205f,
-	1.0f, 1.857859949855864f, 0.9999999999999999f, 1.6994021802861088f, 0.9593547358038239f,
-	0.25027538041118613f,
-	// Elliptic N=8 F/Fs=0.4155577299412916 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.992118949013321f, 1.0000000000000002f, 0.5529826346748055f, 0.15710716801849614f,
-	1.0f, 1.942729453935892f, 1.0f, 1.214117199603341f, 0.6084847582127774f,
-	1.0f, 1.8888306932840706f, 0.9999999999999997f, 1.557914721407614f, 0.8478827309732564f,
-	1.0f, 1.8591836475924028f, 0.9999999999999998f, 1.7018916828132562f, 0.9595220029950784f,
-	0.25189598224077087f,
-	// Elliptic N=8 F/Fs=0.41594911937377693 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.992195189283313f, 0.9999999999999999f, 0.5578693501167891f, 0.15824638707274152f,
-	1.0f, 1.943276693007375f, 1.0000000000000002f, 1.2183514389289725f, 0.6096425365108591f,
-	1.0f, 1.8898785682444326f, 1.0000000000000002f, 1.5609936499252568f, 0.8484592705677116f,
-	1.0f, 1.8605009493629727f, 0.9999999999999999f, 1.704371862706776f, 0.9596895240059582f,
-	0.2535267367065553f,
-	// Elliptic N=8 F/Fs=0.4163405088062623 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9922710108458461f, 1.0f, 0.5627689624335261f, 0.15939892716975357f,
-	1.0f, 1.9438210566153444f, 0.9999999999999998f, 1.2225840159654016f, 0.6108057891391362f,
-	1.0f, 1.8909212088288467f, 0.9999999999999998f, 1.5640649318310198f, 0.8490371818392428f,
-	1.0f, 1.861811858842074f, 0.9999999999999998f, 1.7068427051907926f, 0.9598572979878762f,
-	0.25516770649647846f,
-	// Elliptic N=8 F/Fs=0.41673189823874757 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.99234641467023f, 0.9999999999999999f, 0.5676815230887382f, 0.1605648889730369f,
-	1.0f, 1.9443625496205532f, 1.0f, 1.2268148913148684f, 0.6119745274272117f,
-	1.0f, 1.8919586201619245f, 1.0f, 1.567128540043433f, 0.8496164631214322f,
-	1.0f, 1.863116379690801f, 0.9999999999999997f, 1.709304195527318f, 0.9600253240907743f,
-	0.25681895468605304f,
 	// Elliptic N=8 F/Fs=0.4171232876712329 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9924214017195772f, 0.9999999999999997f, 0.5726070837302415f, 0.16174437401800792f,
 	1.0f, 1.9449011768561373f, 1.0000000000000002f, 1.2310440253358086f, 0.6131487626906402f,
 	1.0f, 1.8929908073443444f, 1.0f, 1.5701844474641793f, 0.8501971127347432f,
 	1.0f, 1.8644145155567837f, 1.0000000000000002f, 1.7117563190163376f, 0.9601936014631276f,
 	0.25848054474072574f,
-	// Elliptic N=8 F/Fs=0.4175146771037182 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9924959729508278f, 1.0000000000000004f, 0.5775456961897498f, 0.16293748472024205f,
-	1.0f, 1.9454369431276872f, 0.9999999999999998f, 1.235271378141923f, 0.61432850623042f,
-	1.0f, 1.8940177754528467f, 0.9999999999999998f, 1.5732326269783254f, 0.8507791289864779f,
-	1.0f, 1.8657062700741236f, 0.9999999999999999f, 1.714199060995883f, 0.960362129251945f,
-	0.2601525405182462f,
-	// Elliptic N=8 F/Fs=0.41790606653620355 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9925701293147728f, 0.9999999999999998f, 0.5824974124826823f, 0.16414432438381155f,
-	1.0f, 1.9459698532133245f, 0.9999999999999998f, 1.2394969096012711f, 0.6155137693324848f,
-	1.0f, 1.8950395295402291f, 0.9999999999999999f, 1.5762730514545646f, 0.8513625101707377f,
-	1.0f, 1.8669916468633418f, 1.0000000000000002f, 1.7166324068421173f, 0.9605309066027715f,
-	0.26183500627105466f,
-	// Elliptic N=8 F/Fs=0.41829745596868884 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.992643871756088f, 1.0000000000000002f, 0.5874622848079226f, 0.16536499720970013f,
-	1.0f, 1.9464999118637671f, 0.9999999999999997f, 1.243720579335346f, 0.6167045632671861f,
-	1.0f, 1.8960560746353372f, 0.9999999999999999f, 1.5793056937454488f, 0.8519472545683768f,
-	1.0f, 1.8682706495313144f, 1.0f, 1.7190563419694087f, 0.9606999326596872f,
-	0.2635280066486747f,
-	// Elliptic N=8 F/Fs=0.4186888454011742 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9927172012133503f, 1.0f, 0.5924403655475807f, 0.16659960830431125f,
-	1.0f, 1.9470271238024055f, 0.9999999999999999f, 1.2479423467181718f, 0.6179008992887761f,
-	1.0f, 1.8970674157430623f, 1.0000000000000002f, 1.5823305266876386f, 0.8525333604469654f,
-	1.0f, 1.869543281671221f, 1.0f, 1.7214708518304198f, 0.9608692065653139f,
-	0.2652316067001259f,
-	// Elliptic N=8 F/Fs=0.41908023483365947 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9927901186190706f, 0.9999999999999998f, 0.5974317072667041f, 0.1678482636880542f,
-	1.0f, 1.9475514937253688f, 0.9999999999999997f, 1.2521621708753785f, 0.6191027886348783f,
-	1.0f, 1.8980735578443315f, 1.0f, 1.5853475231021352f, 0.8531208260607425f,
-	1.0f, 1.8708095468624821f, 1.0f, 1.7238759219161777f, 0.9610387274608118f,
-	0.2669458718763387f,
-	// Elliptic N=8 F/Fs=0.4194716242661448 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9928626248997168f, 1.0000000000000002f, 0.6024363627129891f, 0.16911107030402434f,
-	1.0f, 1.9480730263016002f, 1.0000000000000004f, 1.256380010683304f, 0.620310242525962f,
-	1.0f, 1.8990745058961067f, 1.0f, 1.5883566557945317f, 0.8537096496505765f,
-	1.0f, 1.8720694486707055f, 1.0f, 1.72627153775616f, 0.9612084944858827f,
-	0.2686708680325915f,
 	// Elliptic N=8 F/Fs=0.4198630136986301 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9929347209757364f, 0.9999999999999998f, 0.6074543848164525f, 0.1703881360267677f,
 	1.0f, 1.94859172617292f, 1.0000000000000002f, 1.2605958247680844f, 0.6215232721648075f,
 	1.0f, 1.900070264831376f, 1.0f, 1.591357897555258f, 0.8542998294439238f,
 	1.0f, 1.8733229906476292f, 0.9999999999999998f, 1.7286576849183757f, 0.9613785067787742f,
 	0.2704066614309521f,
-	// Elliptic N=8 F/Fs=0.42025440313111545 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9930064077615872f, 0.9999999999999999f, 0.6124858266890839f, 0.17167956967113485f,
-	1.0f, 1.949107597954102f, 1.0f, 1.2648095715047472f, 0.6227418887359646f,
-	1.0f, 1.9010608395591504f, 1.0f, 1.5943512211598285f, 0.8548913636547852f,
-	1.0f, 1.8745701763310667f, 1.0000000000000004f, 1.7310343490094424f, 0.9615487634762766f,
-	0.2721533187427356f,
-	// Elliptic N=8 F/Fs=0.4206457925636008 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9930776861657575f, 1.0000000000000002f, 0.61753074162447f, 0.17298548100122588f,
-	1.0f, 1.9496206462329384f, 1.0000000000000002f, 1.269021209016312f, 0.6239661034052107f,
-	1.0f, 1.9020462349644571f, 1.0f, 1.5973365993690911f, 0.8554842504836649f,
-	1.0f, 1.8758110092448472f, 1.0000000000000002f, 1.73340151567467f, 0.9617192637137287f,
-	0.2739109070509711f,
-	// Elliptic N=8 F/Fs=0.4210371819960861 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.993148557090792f, 1.0000000000000002f, 0.6225891830973928f, 0.1743059807394245f,
-	1.0f, 1.9501308755703088f, 1.0000000000000004f, 1.2732306951728891f, 0.6251959273190008f,
-	1.0f, 1.9030264559083359f, 1.0000000000000002f, 1.6003140049294788f, 0.8560784881175274f,
-	1.0f, 1.8770454928987677f, 1.0000000000000002f, 1.7357591705981386f, 0.9618900066250166f,
-	0.27567949385288326f,
-	// Elliptic N=8 F/Fs=0.4214285714285714 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9932190214333176f, 1.0000000000000002f, 0.6276612047634088f, 0.17564118057552722f,
-	1.0f, 1.950638290500249f, 1.0f, 1.2774379875907904f, 0.6264313716039162f,
-	1.0f, 1.9040015072278347f, 1.0000000000000002f, 1.6032834105732692f, 0.8566740747297588f,
-	1.0f, 1.8782736307885324f, 0.9999999999999998f, 1.7381072995027844f, 0.9620609913425778f,
-	0.27745914706238545f,
-	// Elliptic N=8 F/Fs=0.4218199608610568 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9932890800840664f, 1.0f, 0.6327468604583866f, 0.1769911931759604f,
-	1.0f, 1.9511428955300198f, 0.9999999999999997f, 1.2816430436316286f, 0.6276724473661034f,
-	1.0f, 1.9049713937360044f, 0.9999999999999998f, 1.6062447890188318f, 0.8572710084801205f,
-	1.0f, 1.879495426395704f, 1.0000000000000002f, 1.7404458881504763f, 0.9622322169974f,
-	0.2792499350125812f,
-	// Elliptic N=8 F/Fs=0.42221135029354206 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9933587339279006f, 0.9999999999999999f, 0.6378462041980202f, 0.17835613219309307f,
-	1.0f, 1.9516446951401727f, 1.0f, 1.2858458204014247f, 0.6289191656907103f,
-	1.0f, 1.9059361202218952f, 1.0f, 1.6091981129708894f, 0.857869287514712f,
-	1.0f, 1.8807108831876431f, 1.0f, 1.7427749223420972f, 0.9624036827190259f,
-	0.28105192645828064f,
 	// Elliptic N=8 F/Fs=0.42260273972602735 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9934279838438358f, 0.9999999999999997f, 0.6429592901773308f, 0.1797361122746478f,
 	1.0f, 1.9521436937846164f, 0.9999999999999999f, 1.2900462747497337f, 0.6301715376413219f,
 	1.0f, 1.9068956914505522f, 1.0000000000000004f, 1.6121433551207804f, 0.858468909965926f,
 	1.0f, 1.8819200046174627f, 0.9999999999999997f, 1.7450943879176304f, 0.962575387635552f,
 	0.2828651905785312f,
-	// Elliptic N=8 F/Fs=0.42299412915851275 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.993496830705066f, 1.0f, 0.648086172770114f, 0.18113124907320116f,
-	1.0f, 1.9526398958906863f, 0.9999999999999998f, 1.294244363268748f, 0.631429574259383f,
-	1.0f, 1.9078501121630098f, 0.9999999999999998f, 1.6150804881467173f, 0.8590698739524094f,
-	1.0f, 1.8831227941239719f, 1.0f, 1.7474042707562372f, 0.9627473308736326f,
-	0.2846897969791538f,
-	// Elliptic N=8 F/Fs=0.42338551859099804 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9935652753789843f, 0.9999999999999998f, 0.6532269065283681f, 0.18254165925578336f,
-	1.0f, 1.9531333058592082f, 1.0000000000000002f, 1.2984400422924174f, 0.6326932865636198f,
-	1.0f, 1.908799387076292f, 0.9999999999999997f, 1.6180094847140465f, 0.8596721775790186f,
-	1.0f, 1.8843192551316212f, 1.0f, 1.7497045567763365f, 0.9629195115584793f,
-	0.28652581569529356f,
-	// Elliptic N=8 F/Fs=0.4237769080234834 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9936333187272108f, 1.0f, 0.6583815461817002f, 0.1839674605135774f,
-	1.0f, 1.9536239280645642f, 1.0000000000000004f, 1.3026332678955799f, 0.63396268554946f,
-	1.0f, 1.9097435208834055f, 1.0f, 1.6209303174755214f, 0.8602758189367816f,
-	1.0f, 1.885509391050456f, 1.0f, 1.7519952319356935f, 0.9630919288138651f,
-	0.2883733171939868f,
-	// Elliptic N=8 F/Fs=0.42416829745596873 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9937009616056112f, 0.9999999999999997f, 0.6635501466366881f, 0.18540877157171404f,
-	1.0f, 1.9541117668547594f, 1.0f, 1.3068239958930807f, 0.6352377821884418f,
-	1.0f, 1.9106825182533356f, 1.0f, 1.6238429590715635f, 0.8608807961028535f,
-	1.0f, 1.886693205276061f, 0.9999999999999999f, 1.7542762822314966f, 0.9632645817621238f,
-	0.2902323723767314f,
-	// Elliptic N=8 F/Fs=0.424559686888454 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9937682048643237f, 0.9999999999999999f, 0.6687327629762124f, 0.1868657121991656f,
-	1.0f, 1.9545968265514864f, 0.9999999999999997f, 1.311012181838903f, 0.6365185874276217f,
-	1.0f, 1.9116163838310458f, 1.0f, 1.6267473821305336f, 0.8614871071404776f,
-	1.0f, 1.8878707011895115f, 0.9999999999999998f, 1.7565476937004403f, 0.9634374695241534f,
-	0.292103052582074f,
-	// Elliptic N=8 F/Fs=0.42495107632093937 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9938350493477794f, 1.0000000000000002f, 0.6739294504587648f, 0.18833840321874412f,
-	1.0f, 1.9550791114501909f, 1.0000000000000002f, 1.3151977810253013f, 0.6378051121889747f,
-	1.0f, 1.9125451222374723f, 0.9999999999999999f, 1.6296435592690022f, 0.8620947500989422f,
-	1.0f, 1.8890418821573223f, 1.0f, 1.7588094524188098f, 0.963610591219417f,
-	0.293985429588209f,
 	// Elliptic N=8 F/Fs=0.42534246575342466 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9939014958947252f, 1.0f, 0.6791402645177131f, 0.1898269665171973f,
 	1.0f, 1.9555586258201318f, 1.0000000000000002f, 1.3193807484819398f, 0.6390973673687926f,
 	1.0f, 1.913468738069523f, 1.0f, 1.6325314630920238f, 0.8627037230135408f,
 	1.0f, 1.8902067515313967f, 1.0f, 1.7610615445025608f, 0.9637839459659437f,
 	0.29587957561558575f,
-	// Elliptic N=8 F/Fs=0.42573385518591 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9939675453382482f, 1.0f, 0.684365260760537f, 0.1913315250554085f,
-	1.0f, 1.9560353739044511f, 1.0f, 1.3235610389750325f, 0.6403953638370754f,
-	1.0f, 1.9143872359000718f, 0.9999999999999998f, 1.6354110661934107f, 0.8633140239055311f,
-	1.0f, 1.891365312648978f, 0.9999999999999999f, 1.7633039561074042f, 0.9639575328803325f,
-	0.2977855633295302f,
-	// Elliptic N=8 F/Fs=0.4261252446183953 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9940331985057957f, 1.0000000000000002f, 0.689604494968025f, 0.19285220287869986f,
-	1.0f, 1.956509359920233f, 0.9999999999999998f, 1.3277386070064843f, 0.641699112436915f,
-	1.0f, 1.915300620277959f, 1.0000000000000002f, 1.6382823411560075f, 0.8639256507820912f,
-	1.0f, 1.8925175688326001f, 1.0000000000000004f, 1.765536673428888f, 0.9641313510777529f,
-	0.29970346584287527f,
-	// Elliptic N=8 F/Fs=0.42651663405088064 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.994098456219199f, 1.0f, 0.6948580230934435f, 0.19438912512724116f,
-	1.0f, 1.9569805880585696f, 1.0000000000000002f, 1.3319134068130452f, 0.6430086239838788f,
-	1.0f, 1.916208895727986f, 1.0000000000000004f, 1.6411452605519747f, 0.8645386016362824f,
-	1.0f, 1.8936635233900367f, 1.0f, 1.7677596827024795f, 0.9643053996719447f,
-	0.30163335671860453f,
-	// Elliptic N=8 F/Fs=0.42690802348336593 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9941633192946948f, 1.0f, 0.7001259012616619f, 0.19594241804656326f,
-	1.0f, 1.9574490624846195f, 0.9999999999999997f, 1.3360853923654612f, 0.6443239092653859f,
-	1.0f, 1.917112066750914f, 1.0000000000000002f, 1.643999796943066f, 0.8651528744470061f,
-	1.0f, 1.894803179614257f, 1.0f, 1.7699729702036513f, 0.9644796777752243f,
-	0.3035753099725065f,
-	// Elliptic N=8 F/Fs=0.4272994129158513 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.994227788542947f, 1.0000000000000002f, 0.7054081857682437f, 0.19751220899817856f,
-	1.0f, 1.957914787337677f, 0.9999999999999999f, 1.3402545173676315f, 0.6456449790400761f,
-	1.0f, 1.9180101378234633f, 1.0f, 1.646845922880912f, 0.8657684671789632f,
-	1.0f, 1.8959365407833735f, 1.0000000000000002f, 1.7721765222479609f, 0.9646541844984811f,
-	0.30552940007584f,
-	// Elliptic N=8 F/Fs=0.42769080234833656 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.994291864769068f, 1.0000000000000002f, 0.7107049330784978f, 0.1990986264703088f,
-	1.0f, 1.9583777667312265f, 0.9999999999999996f, 1.3444207352557682f, 0.6469718440371763f,
-	1.0f, 1.918903113398308f, 1.0f, 1.6496836109073034f, 0.8663853777826138f,
-	1.0f, 1.8970636101605955f, 0.9999999999999998f, 1.7743703251911365f, 0.964828918951184f,
-	0.3074957019580087f,
 	// Elliptic N=8 F/Fs=0.4280821917808219 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9943555487726414f, 1.0000000000000004f, 0.7160161998264957f, 0.20070180008872343f,
 	1.0f, 1.9588380047530105f, 1.0000000000000004f, 1.3485839991975663f, 0.6483045149558606f,
 	1.0f, 1.9197909979040768f, 1.0f, 1.6525128335544799f, 0.8670036041941359f,
 	1.0f, 1.8981843909941842f, 1.0f, 1.7765543654291593f, 0.9650038802413796f,
 	0.309474291009249f,
-	// Elliptic N=8 F/Fs=0.42847358121330725 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9944188413477413f, 0.9999999999999999f, 0.7213420428140453f, 0.2023218606276866f,
-	1.0f, 1.9592955054650834f, 0.9999999999999998f, 1.3527442620913734f, 0.6496430024646065f,
-	1.0f, 1.920673795745349f, 1.0000000000000002f, 1.6553335633454167f, 0.867623144335385f,
-	1.0f, 1.8992988865174025f, 1.0f, 1.778728629398349f, 0.9651790674756964f,
-	0.3114652430833294f,
-	// Elliptic N=8 F/Fs=0.42886497064579254 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.994481743282957f, 1.0f, 0.7266825190096219f, 0.20395894002101445f,
-	1.0f, 1.9597502729038816f, 1.0f, 1.3569014765653624f, 0.6509873172005423f,
-	1.0f, 1.9215515113026533f, 1.0f, 1.6581457727941165f, 0.8682439961138547f,
-	1.0f, 1.9004070999484708f, 1.0000000000000002f, 1.7808931035754445f, 0.9653544797593446f,
-	0.3134686345002556f,
-	// Elliptic N=8 F/Fs=0.42925636007827783 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9945442553614092f, 1.0f, 0.7320376855472654f, 0.20561317137324714f,
-	1.0f, 1.9602023110802753f, 0.9999999999999997f, 1.3610555949767171f, 0.6523374697687944f,
-	1.0f, 1.9224241489324674f, 1.0000000000000002f, 1.6609494344059f, 0.868866157422634f,
-	1.0f, 1.9015090344905194f, 0.9999999999999998f, 1.7830477744776911f, 0.9655301161961202f,
-	0.31548454204899323f,
-	// Elliptic N=8 F/Fs=0.42964774951076323 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9946063783607753f, 1.0000000000000004f, 0.7374075997254298f, 0.20728468897093233f,
-	1.0f, 1.9606516239796343f, 0.9999999999999999f, 1.3652065694108142f, 0.6536934707418242f,
-	1.0f, 1.9232917129672142f, 0.9999999999999998f, 1.6637445206777024f, 0.8694896261403685f,
-	1.0f, 1.9026046933315461f, 1.0f, 1.7851926286629232f, 0.965705975888404f,
-	0.31751304299019484f,
-	// Elliptic N=8 F/Fs=0.4300391389432485 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9946681130533055f, 0.9999999999999999f, 0.7427923190057879f, 0.20897362829402263f,
-	1.0f, 1.9610982155618835f, 0.9999999999999999f, 1.3693543516804139f, 0.6550553306587631f,
-	1.0f, 1.9241542077152642f, 1.0000000000000004f, 1.6665310040983683f, 0.8701144001312205f,
-	1.0f, 1.9036940796443655f, 0.9999999999999998f, 1.787327652729648f, 0.9658820579371665f,
-	0.3195542150589402f,
-	// Elliptic N=8 F/Fs=0.4304305283757338 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9947294602058492f, 1.0000000000000002f, 0.7481919010120006f, 0.2106801260273912f,
-	1.0f, 1.961542089761565f, 0.9999999999999997f, 1.3734988933248584f, 0.656423060024741f,
-	1.0f, 1.9250116374609278f, 1.0000000000000002f, 1.6693088571489503f, 0.8707404772448275f,
-	1.0f, 1.9047771965865699f, 1.0f, 1.7894528333171316f, 0.9660583614419674f,
-	0.3216081364674876f,
 	// Elliptic N=8 F/Fs=0.4308219178082192 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9947904205798694f, 1.0f, 0.7536064035284337f, 0.21240432007246157f,
 	1.0f, 1.961983250487896f, 0.9999999999999996f, 1.3776401456092722f, 0.6577966693102093f,
 	1.0f, 1.9258640064644619f, 1.0000000000000002f, 1.6720780523030103f, 0.8713678553162624f,
 	1.0f, 1.9058540473004801f, 0.9999999999999999f, 1.7915681571054811f, 0.9662348855009573f,
 	0.3236748859080338f,
-	// Elliptic N=8 F/Fs=0.4312133072407045 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9948509949314666f, 1.0f, 0.7590358844988273f, 0.21414634955895537f,
-	1.0f, 1.962421701624827f, 0.9999999999999998f, 1.3817780595237643f, 0.6591761689502569f,
-	1.0f, 1.9267113189620624f, 1.0000000000000002f, 1.6748385620269202f, 0.8719965321659948f,
-	1.0f, 1.9069246349131055f, 1.0000000000000002f, 1.7936736108157323f, 0.9664116292108822f,
-	0.32575454255548203f,
-	// Elliptic N=8 F/Fs=0.43160469667318985 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9949111840113978f, 1.0000000000000002f, 0.7644804020249308f, 0.21590635485676246f,
-	1.0f, 1.9628574470311002f, 0.9999999999999998f, 1.3859125857826495f, 0.6605615693439261f,
-	1.0f, 1.927553579165867f, 1.0f, 1.6775903587801682f, 0.8726265055998503f,
-	1.0f, 1.9079889625360962f, 0.9999999999999999f, 1.7957691812099321f, 0.966588591667082f,
-	0.3278471860702262f,
-	// Elliptic N=8 F/Fs=0.4319960861056752 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9949709885650952f, 1.0f, 0.7699400143650733f, 0.21768447758792606f,
-	1.0f, 1.963290490540307f, 1.0000000000000002f, 1.3900436748236578f, 0.661952880853516f,
-	1.0f, 1.9283907912639533f, 1.0000000000000002f, 1.680333415015662f, 0.8732577734089688f,
-	1.0f, 1.9090470332657037f, 1.0f, 1.7978548550912243f, 0.9667657719634948f,
-	0.32995289660093685f,
-	// Elliptic N=8 F/Fs=0.4323874755381605 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9950304093326885f, 1.0000000000000002f, 0.7754147799326999f, 0.2194808606387541f,
-	1.0f, 1.9637208359609444f, 0.9999999999999997f, 1.3941712768071637f, 0.6633501138038864f,
-	1.0f, 1.929222959420337f, 1.0f, 1.6830677031800407f, 0.8738903333697686f,
-	1.0f, 1.910098850182735f, 1.0f, 1.799930619303935f, 0.9669431691926571f,
-	0.33207175478736217f,
-	// Elliptic N=8 F/Fs=0.4327788649706458 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9950894470490215f, 1.0000000000000002f, 0.7809047572948514f, 0.22129564817205105f,
-	1.0f, 1.9641484870764763f, 1.0000000000000004f, 1.3982953416154142f, 0.6647532784817516f,
-	1.0f, 1.9300500877749738f, 0.9999999999999999f, 1.685793195713983f, 0.8745241832439032f,
-	1.0f, 1.9111444163525113f, 1.0000000000000002f, 1.8019964607336585f, 0.9671207824457071f,
-	0.3342038417631375f,
-	// Elliptic N=8 F/Fs=0.4331702544031311 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9951481024436726f, 0.9999999999999996f, 0.7864100051705881f, 0.2231289856394712f,
-	1.0f, 1.9645734476453822f, 1.0000000000000002f, 1.4024158188517633f, 0.6661623851349726f,
-	1.0f, 1.9308721804437565f, 1.0000000000000002f, 1.6885098650525183f, 0.8751593207782244f,
-	1.0f, 1.9121837348248252f, 0.9999999999999999f, 1.8040523663073391f, 0.9672986108123844f,
-	0.33634923915860077f,
 	// Elliptic N=8 F/Fs=0.43356164383561646 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.995206376240977f, 1.0000000000000002f, 0.7919305824293802f, 0.22498101979400398f,
 	1.0f, 1.9649957214012217f, 1.0000000000000002f, 1.4065326578399198f, 0.6675774439718423f,
 	1.0f, 1.9316892415185154f, 0.9999999999999998f, 1.6912176836253456f, 0.8757957437047412f,
 	1.0f, 1.9132168086339008f, 1.0f, 1.8060983229933647f, 0.9674766533810366f,
 	0.338508029103624f,
-	// Elliptic N=8 F/Fs=0.43395303326810175 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9952642691600384f, 0.9999999999999996f, 0.7974665480894186f, 0.22685189870257594f,
-	1.0f, 1.9654153120526852f, 1.0000000000000002f, 1.410645807623188f, 0.6689984651603628f,
-	1.0f, 1.9325012750670192f, 1.0000000000000002f, 1.6939166238571433f, 0.8764334497405815f,
-	1.0f, 1.9142436407983487f, 1.0f, 1.8081343178016411f, 0.9676549092386137f,
-	0.3406802942304423f,
-	// Elliptic N=8 F/Fs=0.4343444227005871 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9953217819147577f, 1.0f, 0.8030179613158988f, 0.2287417717587895f,
-	1.0f, 1.9658322232836505f, 1.0f, 1.41475521696373f, 0.6704254588275217f,
-	1.0f, 1.9333082851329721f, 1.0f, 1.6966066581678934f, 0.8770724365879526f,
-	1.0f, 1.9152642343211286f, 0.9999999999999999f, 1.810160337783689f, 0.9678333774706778f,
-	0.3428661176765063f,
-	// Elliptic N=8 F/Fs=0.4347358121330724 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9953789152138424f, 1.0000000000000002f, 0.8085848814192261f, 0.23065078969578237f,
-	1.0f, 1.9662464587532393f, 1.0f, 1.418860834341821f, 0.6718584350585585f,
-	1.0f, 1.9341102757360171f, 1.0000000000000004f, 1.6992877589731958f, 0.8777127019341013f,
-	1.0f, 1.916278592189506f, 1.0000000000000004f, 1.8121763700327211f, 0.9680120571613992f,
-	0.3450655830873284f,
-	// Elliptic N=8 F/Fs=0.43512720156555773 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.995435669760831f, 1.0f, 0.8141673678531887f, 0.23257910459922482f,
-	1.0f, 1.96665802209587f, 1.0f, 1.4229626079551256f, 0.6732974038962294f,
-	1.0f, 1.9349072508717329f, 1.0000000000000002f, 1.7019598986845985f, 0.8783542434512771f,
-	1.0f, 1.9172867173750126f, 1.0f, 1.8141824016837358f, 0.9681909473935617f,
-	0.3472787746193508f,
-	// Elliptic N=8 F/Fs=0.435518590998043 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9954920462541104f, 0.9999999999999999f, 0.8197654802130464f, 0.23452686992043972f,
-	1.0f, 1.967066916921313f, 0.9999999999999999f, 1.4270604857179656f, 0.6747423753400631f,
-	1.0f, 1.9356992145116358f, 1.0f, 1.704623049709913f, 0.8789970587966907f,
-	1.0f, 1.918288612833407f, 0.9999999999999998f, 1.8161784199135962f, 0.9683700472485627f,
-	0.3495057769428083f,
-	// Elliptic N=8 F/Fs=0.43590998043052837 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9955480453869328f, 1.0f, 0.8253792782335867f, 0.23649424048966283f,
-	1.0f, 1.9674731468147455f, 1.0000000000000004f, 1.4311544152606075f, 0.6761933593456129f,
-	1.0f, 1.9364861706031804f, 1.0000000000000002f, 1.7072771844535481f, 0.879641145612477f,
-	1.0f, 1.9192842815046347f, 0.9999999999999998f, 1.8181644119411233f, 0.9685493558064169f,
-	0.3517466752446114f,
 	// Elliptic N=8 F/Fs=0.4363013698630137 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.995603667847435f, 1.0000000000000002f, 0.8310088217871004f, 0.23848137252943052f,
 	1.0f, 1.9678767153368013f, 0.9999999999999999f, 1.4352443439285494f, 0.6776503658237023f,
 	1.0f, 1.9372681230697573f, 1.0f, 1.7099222753168328f, 0.8802865015256561f,
 	1.0f, 1.9202737263127883f, 1.0f, 1.8201403650271766f, 0.9687288721457556f,
 	0.3540015552312277f,
-	// Elliptic N=8 F/Fs=0.436692759295499 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9956589143186554f, 1.0f, 0.836654170881312f, 0.24048842366810733f,
-	1.0f, 1.968277626023631f, 1.0f, 1.4393302187818204f, 0.6791134046396665f,
-	1.0f, 1.938045075810696f, 1.0f, 1.7125582946983502f, 0.8809331241480949f,
-	1.0f, 1.921256950166068f, 1.0f, 1.8221062664747452f, 0.9689085953438319f,
-	0.3562705031315772f,
-	// Elliptic N=8 F/Fs=0.4370841487279843 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9957137854785538f, 1.0000000000000002f, 0.8423153856572391f, 0.24251555295354751f,
-	1.0f, 1.9686758823869481f, 1.0000000000000002f, 1.4434119865942834f, 0.6805824856125859f,
-	1.0f, 1.9388170327012646f, 0.9999999999999999f, 1.7151852149942688f, 0.8815810110764685f,
-	1.0f, 1.922233955956745f, 0.9999999999999999f, 1.824062103629032f, 0.9690885244765195f,
-	0.35855360569993083f,
-	// Elliptic N=8 F/Fs=0.4374755381604697 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9957682820000264f, 0.9999999999999999f, 0.8479925263869883f, 0.244562920866893f,
-	1.0f, 1.9690714879140845f, 0.9999999999999999f, 1.447489593852949f, 0.6820576185145166f,
-	1.0f, 1.93958399759267f, 0.9999999999999998f, 1.717803008598676f, 0.8822301598922215f,
-	1.0f, 1.9232047465611222f, 1.0f, 1.826007863877543f, 0.9692686586183173f,
-	0.36085095021881736f,
-	// Elliptic N=8 F/Fs=0.437866927592955 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9958224045509267f, 1.0000000000000002f, 0.853685653471491f, 0.24663068933651325f,
-	1.0f, 1.9694644460680437f, 1.0000000000000002f, 1.4515629867572915f, 0.6835388130697112f,
-	1.0f, 1.940345974312059f, 0.9999999999999999f, 1.7204116479039149f, 0.882880568161531f,
-	1.0f, 1.9241693248394949f, 0.9999999999999999f, 1.8279435346501693f, 0.9694489968423484f,
-	0.3631626245019366f,
-	// Elliptic N=8 F/Fs=0.43825831702544027 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9958761537940786f, 1.0000000000000002f, 0.8593948274381694f, 0.24871902175208255f,
-	1.0f, 1.9698547602875494f, 1.0000000000000002f, 1.4556321112185817f, 0.68502607895384f,
-	1.0f, 1.941102966662518f, 0.9999999999999996f, 1.7230111053009238f, 0.8835322334352675f,
-	1.0f, 1.9251276936361164f, 1.0f, 1.829869103419283f, 0.969629538220367f,
-	0.36548871689708046f,
-	// Elliptic N=8 F/Fs=0.43864970645792567 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9959295303872973f, 1.0f, 0.8651201089385406f, 0.25082808297880216f,
-	1.0f, 1.9702424339870999f, 1.0f, 1.4596969128592199f, 0.6865194257932006f,
-	1.0f, 1.9418549784230759f, 1.0f, 1.725601353179576f, 0.884185153248958f,
-	1.0f, 1.9260798557791576f, 1.0000000000000002f, 1.8317845576998169f, 0.969810281822755f,
-	0.3678293162890597f,
 	// Elliptic N=8 F/Fs=0.43904109589041096 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.995982534983406f, 1.0000000000000002f, 0.8708615587457395f, 0.2529580393717597f,
 	1.0f, 1.970627470557018f, 1.0f, 1.4637573370120798f, 0.688018863163925f,
 	1.0f, 1.9426020133487014f, 0.9999999999999999f, 1.7281823639290212f, 0.8848393251227472f,
 	1.0f, 1.9270258140806715f, 1.0f, 1.8336898850493535f, 0.9699912267185264f,
 	0.37018451210263303f,
-	// Elliptic N=8 F/Fs=0.4394324853228963 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9960351682302495f, 0.9999999999999998f, 0.8766192377519902f, 0.2551090587904405f,
-	1.0f, 1.9710098733635015f, 1.0000000000000002f, 1.4678133287198625f, 0.6895244005911803f,
-	1.0f, 1.9433440751703086f, 0.9999999999999999f, 1.7307541099380326f, 0.885494746561361f,
-	1.0f, 1.9279655713365578f, 1.0000000000000002f, 1.8355850730682157f, 0.9701723719753297f,
-	0.37255439430545f,
-	// Elliptic N=8 F/Fs=0.43982387475538165 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.996087430770717f, 1.0000000000000002f, 0.8823932069659862f, 0.257281310613376f,
-	1.0f, 1.9713896457486733f, 0.9999999999999998f, 1.4718648327344548f, 0.6910360475483628f,
-	1.0f, 1.9440811675947538f, 0.9999999999999998f, 1.73331656359535f, 0.8861514150540679f,
-	1.0f, 1.928899130326524f, 1.0000000000000002f, 1.8374701093995516f, 0.9703537166594495f,
-	0.37493905341098777f,
-	// Elliptic N=8 F/Fs=0.44021526418786694 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9961393232427522f, 1.0f, 0.8881835275102152f, 0.2594749657529471f,
-	1.0f, 1.9717667910306327f, 0.9999999999999996f, 1.475911793516302f, 0.6925538134562885f,
-	1.0f, 1.9448132943048402f, 1.0000000000000004f, 1.7358696972900327f, 0.8868093280746434f,
-	1.0f, 1.929826493814052f, 0.9999999999999999f, 1.839344981729425f, 0.9705352598358093f,
-	0.3773385804815056f,
-	// Elliptic N=8 F/Fs=0.4406066536203523 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9961908462793745f, 0.9999999999999996f, 0.8939902606181973f, 0.26169019667032983f,
-	1.0f, 1.972141312503504f, 1.0f, 1.4799541552337845f, 0.6940777076823758f,
-	1.0f, 1.9455404589593137f, 0.9999999999999996f, 1.7384134834118063f, 0.8874684830813303f,
-	1.0f, 1.9307476645463622f, 0.9999999999999999f, 1.8412096777868998f, 0.9707170005679706f,
-	0.37975306713099455f,
-	// Elliptic N=8 F/Fs=0.4409980430528376 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9962420005086945f, 1.0f, 0.899813467631648f, 0.26392717739059196f,
-	1.0f, 1.9725132134374848f, 0.9999999999999999f, 1.483991861762604f, 0.6956077395398224f,
-	1.0f, 1.946262665192873f, 1.0000000000000002f, 1.740947894351417f, 0.8881288775168036f,
-	1.0f, 1.9316626452543764f, 0.9999999999999999f, 1.8430641853441319f, 0.9708989379181396f,
-	0.3821826055281337f,
-	// Elliptic N=8 F/Fs=0.4413894324853229 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9962927865539282f, 1.0000000000000002f, 0.9056532099975755f, 0.2661860835179441f,
-	1.0f, 1.9728824970788965f, 0.9999999999999997f, 1.4880248566851817f, 0.6971439182867777f,
-	1.0f, 1.9469799166161599f, 0.9999999999999998f, 1.7434729025009863f, 0.888790508808133f,
-	1.0f, 1.9325714386526849f, 0.9999999999999998f, 1.8449084922164543f, 0.9710810709471642f,
-	0.3846272883992545f,
 	// Elliptic N=8 F/Fs=0.4417808219178082 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9963432050334142f, 0.9999999999999998f, 0.9115095492652838f, 0.26846709225113846f,
 	1.0f, 1.9732491666502334f, 1.0f, 1.4920530832900643f, 0.6986862531255096f,
 	1.0f, 1.9476922168157709f, 0.9999999999999999f, 1.745988480254369f, 0.8894533743667469f,
 	1.0f, 1.933474047439512f, 1.0000000000000002f, 1.846742586262469f, 0.9712633987145407f,
 	0.38708720903130395f,
-	// Elliptic N=8 F/Fs=0.44217221135029355 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9963932565606326f, 0.9999999999999997f, 0.9173825470833061f, 0.27077038239902457f,
-	1.0f, 1.9736132253502074f, 0.9999999999999998f, 1.4960764845713377f, 0.7002347532015636f,
-	1.0f, 1.948399569354251f, 0.9999999999999996f, 1.7484946000075097f, 0.8901174715883937f,
-	1.0f, 1.9343704742966794f, 0.9999999999999998f, 1.8485664553841332f, 0.9714459202784135f,
-	0.3895624612748131f,
-	// Elliptic N=8 F/Fs=0.44256360078277884 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9964429417442167f, 1.0000000000000002f, 0.923272265196246f, 0.27309613439625663f,
-	1.0f, 1.9739746763538006f, 1.0000000000000002f, 1.5000950032280507f, 0.7017894276029171f,
-	1.0f, 1.9491019777701006f, 0.9999999999999999f, 1.7509912341588034f, 0.890782797853107f,
-	1.0f, 1.9352607218895757f, 0.9999999999999999f, 1.850380087526847f, 0.9716286346955761f,
-	0.39205313954686816f,
-	// Elliptic N=8 F/Fs=0.4429549902152642 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9964922611879687f, 0.9999999999999999f, 0.9291787654415488f, 0.2754445303191636f,
-	1.0f, 1.9743335228123087f, 1.0000000000000002f, 1.5041085816636537f, 0.7033502853591297f,
-	1.0f, 1.9497994455777727f, 1.0f, 1.7534783551094633f, 0.8914493505251704f,
-	1.0f, 1.9361447928671196f, 0.9999999999999996f, 1.852183470679546f, 0.9718115410214764f,
-	0.39455933883408595f,
-	// Elliptic N=8 F/Fs=0.4433463796477495 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9965412154908802f, 0.9999999999999998f, 0.935102109746174f, 0.2778157539017706f,
-	1.0f, 1.9746897678533897f, 0.9999999999999999f, 1.508117161985438f, 0.7049173354404832f,
-	1.0f, 1.9504919762676771f, 0.9999999999999999f, 1.7559559352638785f, 0.8921171269530777f,
-	1.0f, 1.9370226898617298f, 0.9999999999999998f, 1.8539765928747864f, 0.9719946383102159f,
-	0.39708115469558847f,
-	// Elliptic N=8 F/Fs=0.4437377690802348 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9965898052471418f, 0.9999999999999997f, 0.9410423601231883f, 0.28020999055198376f,
-	1.0f, 1.9750434145811122f, 1.0f, 1.512120686003995f, 0.7064905867571215f,
-	1.0f, 1.951179573306183f, 1.0000000000000002f, 1.7584239470299885f, 0.8927861244695012f,
-	1.0f, 1.937894415489289f, 0.9999999999999999f, 1.8557594421888368f, 0.9721779256145531f,
-	0.39961868326598116f,
-	// Elliptic N=8 F/Fs=0.44412915851272017 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9966380310461622f, 0.9999999999999998f, 0.9469995786682628f, 0.28262742736793317f,
-	1.0f, 1.9753944660759986f, 1.0f, 1.5161190952326757f, 0.7080700481581796f,
-	1.0f, 1.9518622401356163f, 0.9999999999999996f, 1.7608823628196446f, 0.8934563403912521f,
-	1.0f, 1.9387599723491127f, 1.0f, 1.8575320067417658f, 0.9723614019859061f,
-	0.4021720212583313f,
 	// Elliptic N=8 F/Fs=0.44452054794520546 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9966858934725813f, 0.9999999999999998f, 0.9529738275560907f, 0.2850682531544819f,
 	1.0f, 1.9757429253950731f, 0.9999999999999999f, 1.5201123308870708f, 0.70965572843091f,
 	1.0f, 1.952539980174268f, 1.0f, 1.7633311550489879f, 0.8941277720192474f,
 	1.0f, 1.9396193630239171f, 1.0f, 1.8592942746975314f, 0.9725450664743531f,
 	0.40474126596715065f,
-	// Elliptic N=8 F/Fs=0.44491193737769075 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.996733393106287f, 1.0000000000000004f, 0.9589651690367015f, 0.28753265843989495f,
-	1.0f, 1.9760887955719082f, 1.0f, 1.5241003338844934f, 0.7112476362998013f,
-	1.0f, 1.9532127968163893f, 1.0000000000000002f, 1.7657702961388182f, 0.8948004166384733f,
-	1.0f, 1.9404725900797866f, 0.9999999999999998f, 1.8610462342640726f, 0.9727289181286367f,
-	0.407326515271373f,
-	// Elliptic N=8 F/Fs=0.44530332681017615 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9967805305224264f, 0.9999999999999998f, 0.9649736654316876f, 0.29002083549267543f,
-	1.0f, 1.9764320796166677f, 0.9999999999999999f, 1.5280830448434772f, 0.7128457804256925f,
-	1.0f, 1.9538806934321977f, 1.0f, 1.7681997585149714f, 0.8954742715179494f,
-	1.0f, 1.9413196560661437f, 1.0000000000000004f, 1.8627878736933967f, 0.972912955996164f,
-	0.4099278676373379f,
-	// Elliptic N=8 F/Fs=0.44569471624266144 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.996827306291427f, 0.9999999999999994f, 0.9709993791303235f, 0.2925329783385633f,
-	1.0f, 1.976772780516153f, 0.9999999999999999f, 1.5320604040832795f, 0.7144501694048795f,
-	1.0f, 1.9545436733678778f, 0.9999999999999998f, 1.770619514608694f, 0.8961493339106952f,
-	1.0f, 1.9421605635157118f, 0.9999999999999997f, 1.864519181281668f, 0.97309717912301f,
-	0.4125454221217659f,
-	// Elliptic N=8 F/Fs=0.4460861056751467 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9968737209790064f, 1.0f, 0.9770423725856121f, 0.2950692827777117f,
-	1.0f, 1.9771109012338486f, 1.0000000000000002f, 1.5360323516234076f, 0.7160608117682193f,
-	1.0f, 1.9552017399455843f, 1.0000000000000002f, 1.7730295368570277f, 0.8968256010536936f,
-	1.0f, 1.9429953149444947f, 1.0000000000000002f, 1.8662401453693027f, 0.9732815865539198f,
-	0.41517927837474394f,
-	// Elliptic N=8 F/Fs=0.4464774951076321 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.996919775146186f, 1.0000000000000004f, 0.9831027083102023f, 0.29762994640202206f,
-	1.0f, 1.9774464447099638f, 0.9999999999999999f, 1.5399988271831424f, 0.7176777159802236f,
-	1.0f, 1.9558548964634417f, 1.0000000000000004f, 1.7754297977031848f, 0.8975030701678554f,
-	1.0f, 1.943823912851735f, 1.0000000000000004f, 1.867950754341054f, 0.9734661773323102f,
-	0.4178295366427001f,
-	// Elliptic N=8 F/Fs=0.4468688845401174 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9969654693493089f, 1.0000000000000004f, 0.9891804488722122f, 0.3002151686126516f,
-	1.0f, 1.9777794138614795f, 0.9999999999999998f, 1.5439597701810774f, 0.7193008904381484f,
-	1.0f, 1.9565031461955467f, 1.0f, 1.7778202695969338f, 0.8981817384579869f,
-	1.0f, 1.944646359719888f, 0.9999999999999999f, 1.8696509966261026f, 0.9736509505002718f,
-	0.42049629777137465f,
 	// Elliptic N=8 F/Fs=0.44726027397260276 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9970108041400518f, 0.9999999999999996f, 0.9952756568909722f, 0.3028251506377049f,
 	1.0f, 1.9781098115821907f, 0.9999999999999999f, 1.5479151197346814f, 0.7209303434710819f,
 	1.0f, 1.9571464923919748f, 1.0f, 1.7802009249949884f, 0.898861603112754f,
 	1.0f, 1.9454626580145953f, 1.0000000000000002f, 1.871340860698152f, 0.9738359050985737f,
 	0.4231796632088032f,
-	// Elliptic N=8 F/Fs=0.4476516634050881 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.997055780065443f, 1.0000000000000002f, 1.0013883950326226f, 0.30546009555008147f,
-	1.0f, 1.9784376407427484f, 0.9999999999999999f, 1.5518648146598515f, 0.7225660833390183f,
-	1.0f, 1.9577849382787769f, 1.0000000000000004f, 1.78257173636139f, 0.8995426613046479f,
-	1.0f, 1.946272810184647f, 0.9999999999999996f, 1.873020335075511f, 0.97402104016666f,
-	0.4258797350082786f,
-	// Elliptic N=8 F/Fs=0.4480430528375734 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9971003976678685f, 1.0000000000000002f, 1.007518726005632f, 0.30812020828551145f,
-	1.0f, 1.9787629041907044f, 0.9999999999999998f, 1.5558087934704958f, 0.7242081182319327f,
-	1.0f, 1.958418487057982f, 0.9999999999999998f, 1.7849326761678987f, 0.9002249101899505f,
-	1.0f, 1.94707681866196f, 1.0f, 1.874689408321191f, 0.9742063547426592f,
-	0.42859661583132036f,
-	// Elliptic N=8 F/Fs=0.44843444227005874 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9971446574850935f, 1.0000000000000002f, 1.0136667125561987f, 0.3108056956607652f,
-	1.0f, 1.9790856047505536f, 1.0000000000000004f, 1.5597469943781233f, 0.7258564562688481f,
-	1.0f, 1.9590471419076052f, 1.0f, 1.787283716894387f, 0.9009083469087018f,
-	1.0f, 1.947874685861542f, 1.0f, 1.8763480690429923f, 0.9743918478633805f,
-	0.431330408950636f,
-	// Elliptic N=8 F/Fs=0.44882583170254403 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9971885600502723f, 0.9999999999999998f, 1.0198324174635334f, 0.3135167663920379f,
-	1.0f, 1.9794057452237739f, 1.0000000000000002f, 1.5636793552914392f, 0.7275111054968937f,
-	1.0f, 1.9596709059816428f, 1.0f, 1.7896248310292315f, 0.9015929685846649f,
-	1.0f, 1.9486664141814676f, 1.0000000000000002f, 1.877996305893598f, 0.9745775185643197f,
-	0.4340812182530804f,
-	// Elliptic N=8 F/Fs=0.4492172211350294 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9972321058919644f, 1.0000000000000002f, 1.026015903535035f, 0.3162536311135177f,
-	1.0f, 1.9797233283888716f, 1.0f, 1.5676058138159652f, 0.7291720738903625f,
-	1.0f, 1.9602897824100796f, 1.0000000000000002f, 1.7919559910697105f, 0.9022787723252933f,
-	1.0f, 1.9494520060028457f, 0.9999999999999997f, 1.8796341075706628f, 0.9747633658796598f,
-	0.43684914824260596f,
-	// Elliptic N=8 F/Fs=0.44960861056751467 Rp=0.1dB Rs=80.0dB
-	1.0f, 1.9972752955341437f, 0.9999999999999999f, 1.0322172336013389f, 0.3190165023961305f,
-	1.0f, 1.98003835700142f, 0.9999999999999997f, 1.5715263072536587f, 0.7308393693497578f,
-	1.0f, 1.960903774298887f, 0.9999999999999999f, 1.7942771695223985f, 0.9029657552216965f,
-	1.0f, 1.950231463689795f, 1.0f, 1.8812614628169049f, 0.9749493888422748f,
-	0.4396343040432082f,
 	// Elliptic N=8 F/Fs=0.45 Rp=0.1dB Rs=80.0dB
 	1.0f, 1.9973181294962172f, 1.0000000000000002f, 1.0384364705112628f, 0.32180559476647413f,
 	1.0f, 1.9803508337941034f, 1.0f, 1.575440772602557f, 0.7325129997008372f,
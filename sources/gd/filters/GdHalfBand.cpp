@@ -0,0 +1,170 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "GdHalfBand.h"
+#include <simde/x86/sse.h>
+#include <cstring>
+#include <cassert>
+
+alignas(16) const float GdHalfBand::Narrow::Branch[NB] = {
+    -6.9657438459e-05f, 7.7143974373e-04f, -3.0730659070e-03f, 8.6264175017e-03f,
+    -2.0053493505e-02f, 4.2408900197e-02f, -9.1893865527e-02f, 3.1328332494e-01f,
+    3.1328332494e-01f, -9.1893865527e-02f, 4.2408900197e-02f, -2.0053493505e-02f,
+    8.6264175017e-03f, -3.0730659070e-03f, 7.7143974373e-04f, -6.9657438459e-05f,
+};
+
+alignas(16) const float GdHalfBand::Wide::Branch[NB] = {
+    -3.8696640490e-05f, 1.8586173611e-04f, -5.1346396093e-04f, 1.1342061336e-03f,
+    -2.1960797215e-03f, 3.8878270280e-03f, -6.4508786582e-03f, 1.0208703546e-02f,
+    -1.5639518810e-02f, 2.3562206196e-02f, -3.5661117439e-02f, 5.6292032920e-02f,
+    -1.0152916991e-01f, 3.1675808759e-01f, 3.1675808759e-01f, -1.0152916991e-01f,
+    5.6292032920e-02f, -3.5661117439e-02f, 2.3562206196e-02f, -1.5639518810e-02f,
+    1.0208703546e-02f, -6.4508786582e-03f, 3.8878270280e-03f, -2.1960797215e-03f,
+    1.1342061336e-03f, -5.1346396093e-04f, 1.8586173611e-04f, -3.8696640490e-05f,
+};
+
+// computes the branch filter for consecutive outputs, where the window of
+// each output starts one frame after the previous
+template <class Design>
+static void computeBranch(const float *frames, float *output, unsigned count)
+{
+    constexpr unsigned K = Design::K;
+    constexpr unsigned NB = Design::NB;
+    const float *coeffs = Design::Branch;
+    static_assert(K % 2 == 0, "the branch must be computed in pairs of coefficients");
+
+    // the branch is symmetric, add the frames which share a coefficient
+    simde__m128 vectorCoeffs[K];
+    for (unsigned i = 0; i < K; ++i)
+        vectorCoeffs[i] = simde_mm_set1_ps(coeffs[i]);
+
+    unsigned j = 0;
+
+    for (; j + 3 < count; j += 4) {
+        // accumulate in two sums, which do not wait on each other
+        simde__m128 sum1 = simde_mm_setzero_ps();
+        simde__m128 sum2 = simde_mm_setzero_ps();
+        for (unsigned i = 0; i < K; i += 2) {
+            simde__m128 pair1 = simde_mm_add_ps(simde_mm_loadu_ps(&frames[j + i]), simde_mm_loadu_ps(&frames[j + NB - 1 - i]));
+            simde__m128 pair2 = simde_mm_add_ps(simde_mm_loadu_ps(&frames[j + i + 1]), simde_mm_loadu_ps(&frames[j + NB - 2 - i]));
+            sum1 = simde_mm_add_ps(sum1, simde_mm_mul_ps(vectorCoeffs[i], pair1));
+            sum2 = simde_mm_add_ps(sum2, simde_mm_mul_ps(vectorCoeffs[i + 1], pair2));
+        }
+        simde_mm_storeu_ps(&output[j], simde_mm_add_ps(sum1, sum2));
+    }
+
+    for (; j < count; ++j) {
+        float sum = 0;
+        for (unsigned i = 0; i < K; ++i)
+            sum += coeffs[i] * (frames[j + i] + frames[j + NB - 1 - i]);
+        output[j] = sum;
+    }
+}
+
+//==============================================================================
+template <class Design>
+unsigned GdHalfBandDecimator<Design>::process(const float *input, float *output, unsigned count)
+{
+    float *odd = odd_;
+    float *even = even_;
+    bool hasPending = hasPending_;
+    float pending = pending_;
+
+    unsigned outputCount = 0;
+    unsigned i = 0;
+
+    while (i < count) {
+        // separate the phases of a chunk
+        unsigned n = 0;
+        for (; i < count && n < Chunk; ++i) {
+            if (!hasPending)
+                pending = input[i];
+            else {
+                even[K - 1 + n] = pending;
+                odd[NB - 1 + n] = input[i];
+                ++n;
+            }
+            hasPending = !hasPending;
+        }
+
+        ///
+        float *chunkOutput = output + outputCount;
+        computeBranch<Design>(odd, chunkOutput, n);
+        for (unsigned j = 0; j < n; ++j)
+            chunkOutput[j] += 0.5f * even[j];
+        outputCount += n;
+
+        ///
+        std::memmove(odd, odd + n, (NB - 1) * sizeof(float));
+        std::memmove(even, even + n, (K - 1) * sizeof(float));
+    }
+
+    hasPending_ = hasPending;
+    pending_ = pending;
+
+    return outputCount;
+}
+
+//==============================================================================
+template <class Design>
+void GdHalfBandInterpolator<Design>::process(const float *input, unsigned inputCount, float *output, unsigned outputCount)
+{
+    float *history = history_;
+
+    unsigned o = 0;
+
+    if (hasPending_ && outputCount > 0) {
+        output[o++] = pending_;
+        hasPending_ = false;
+    }
+
+    for (unsigned i = 0; i < inputCount; ) {
+        unsigned n = (inputCount - i < Chunk) ? (inputCount - i) : Chunk;
+        std::memcpy(history + NB - 1, input + i, n * sizeof(float));
+        i += n;
+
+        ///
+        float first[Chunk];
+        computeBranch<Design>(history, first, n);
+
+        for (unsigned j = 0; j < n; ++j) {
+            assert(o < outputCount);
+            output[o++] = 2.0f * first[j];
+            // the center tap, in the middle of the window
+            float second = history[j + K];
+            if (o < outputCount)
+                output[o++] = second;
+            else {
+                pending_ = second;
+                hasPending_ = true;
+            }
+        }
+
+        ///
+        std::memmove(history, history + n, (NB - 1) * sizeof(float));
+    }
+
+    assert(o == outputCount);
+}
+
+//==============================================================================
+template class GdHalfBandDecimator<GdHalfBand::Narrow>;
+template class GdHalfBandInterpolator<GdHalfBand::Narrow>;
+template class GdHalfBandDecimator<GdHalfBand::Wide>;
+template class GdHalfBandInterpolator<GdHalfBand::Wide>;
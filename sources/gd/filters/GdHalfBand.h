@@ -0,0 +1,113 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#pragma once
+
+// Half-band FIR resamplers by a factor of 2, in polyphase form
+//
+// The filter has N=4K-1 taps, designed by windowing the ideal half-band
+// response with Kaiser β=7.637. Except the center tap of 0.5, every other tap
+// is zero; the remaining 2K form a single branch of the polyphase filter.
+namespace GdHalfBand {
+
+// number of frames at the lower rate which are filtered at once
+static constexpr unsigned Chunk = 64;
+
+// a passband to 0.17 Fs with 0.0024 dB of ripple, and a stopband from 0.33 Fs
+// with 71 dB of rejection, for the stages which only keep a part of the band
+struct Narrow {
+    static constexpr unsigned K = 8;
+    static constexpr unsigned NB = 2 * K;
+
+    // edge of the passband, relative to the higher sample rate
+    static constexpr float Passband = 0.17f;
+
+    // latency of a decimator followed by an interpolator, at the higher rate
+    static constexpr unsigned RoundTripLatency = 4 * K - 2;
+
+    // the coefficients of the branch, which is symmetric
+    static const float Branch[NB];
+};
+
+// a passband to 0.2 Fs with 0.0011 dB of ripple, and a stopband from 0.3 Fs
+// with 78 dB of rejection, for the stage which oversamples the sample rate,
+// where the band must stay whole up to the limit of hearing
+struct Wide {
+    static constexpr unsigned K = 14;
+    static constexpr unsigned NB = 2 * K;
+
+    // edge of the passband, relative to the higher sample rate
+    static constexpr float Passband = 0.2f;
+
+    // latency of a decimator followed by an interpolator, at the higher rate
+    static constexpr unsigned RoundTripLatency = 4 * K - 2;
+
+    // the coefficients of the branch, which is symmetric
+    static const float Branch[NB];
+};
+
+} // namespace GdHalfBand
+
+//==============================================================================
+template <class Design>
+class GdHalfBandDecimator {
+public:
+    void clear();
+    // produces the output at half the rate, and returns its frame count
+    unsigned process(const float *input, float *output, unsigned count);
+    template <class Archive> void archiveState(Archive &archive);
+
+private:
+    static constexpr unsigned K = Design::K;
+    static constexpr unsigned NB = Design::NB;
+    static constexpr unsigned Chunk = GdHalfBand::Chunk;
+
+    // the odd frames for the branch, after the history of the past chunk
+    float odd_[NB - 1 + Chunk] {};
+    // the even frames for the center tap, after the history of the past chunk
+    float even_[K - 1 + Chunk] {};
+    // the even frame which waits its odd frame
+    bool hasPending_ = false;
+    float pending_ = 0;
+};
+
+//==============================================================================
+template <class Design>
+class GdHalfBandInterpolator {
+public:
+    void clear();
+    // produces the output at twice the rate, consuming the number of frames
+    // which makes this output; the input count must be what the matching
+    // decimator produced for the same output count, or half the output count
+    void process(const float *input, unsigned inputCount, float *output, unsigned outputCount);
+    template <class Archive> void archiveState(Archive &archive);
+
+private:
+    static constexpr unsigned K = Design::K;
+    static constexpr unsigned NB = Design::NB;
+    static constexpr unsigned Chunk = GdHalfBand::Chunk;
+
+    // the input frames, after the history of the past chunk
+    float history_[NB - 1 + Chunk] {};
+    // the frame which was computed ahead of the output
+    bool hasPending_ = true;
+    float pending_ = 0;
+};
+
+#include "GdHalfBand.hpp"
@@ -0,0 +1,57 @@
+/* Delay Architect
+ * Copyright (C) 2021  Jean Pierre Cimalando
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "GdHalfBand.h"
+#include <cstring>
+
+template <class Design>
+inline void GdHalfBandDecimator<Design>::clear()
+{
+    std::memset(odd_, 0, sizeof(odd_));
+    std::memset(even_, 0, sizeof(even_));
+    hasPending_ = false;
+    pending_ = 0;
+}
+
+template <class Design>
+template <class Archive>
+inline void GdHalfBandDecimator<Design>::archiveState(Archive &archive)
+{
+    archive.value(odd_);
+    archive.value(even_);
+    archive.value(hasPending_);
+    archive.value(pending_);
+}
+
+template <class Design>
+inline void GdHalfBandInterpolator<Design>::clear()
+{
+    std::memset(history_, 0, sizeof(history_));
+    hasPending_ = true;
+    pending_ = 0;
+}
+
+template <class Design>
+template <class Archive>
+inline void GdHalfBandInterpolator<Design>::archiveState(Archive &archive)
+{
+    archive.value(history_);
+    archive.value(hasPending_);
+    archive.value(pending_);
+}
@@ -18,16 +18,21 @@
  */
 
 #pragma once
-#include <vector>
+#include "utility/MemoryPool.h"
 
 #define GD_SHIFTER_UPDATES_AT_K_RATE 0
 #define GD_SHIFTER_CAN_REPORT_LATENCY 0
+#define GD_SHIFTER_CAN_COPY_STATE 1
 
 class GdShifter {
 public:
     void clear();
     void setSampleRate(float sampleRate);
     void setBufferSize(unsigned bufferSize) { (void)bufferSize; }
+    void copyState(const GdShifter &other);
+    // the line is written at every frame, even when there is no shift
+    bool isPassThrough() const { return false; }
+    template <class Archive> void archiveState(Archive &archive);
     float processOne(float input, float shiftLinear);
     void process(const float *input, float *output, const float *shiftLinear, unsigned count);
 
@@ -41,7 +46,7 @@ private:
     float w_ = 0;
     float fs_ = 0;
     unsigned li_ = 0;
-    std::vector<float> l_;
+    PoolVector<float> l_;
 };
 
 #include "GdShifterSimple.hpp"
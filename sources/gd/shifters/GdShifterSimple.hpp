@@ -18,7 +18,9 @@
  */
 
 #include "GdShifterSimple.h"
+#include <algorithm>
 #include <cmath>
+#include <cassert>
 
 inline void GdShifter::clear()
 {
@@ -27,6 +29,23 @@ inline void GdShifter::clear()
     li_ = 0;
 }
 
+inline void GdShifter::copyState(const GdShifter &other)
+{
+    assert(l_.size() == other.l_.size());
+    std::copy(other.l_.begin(), other.l_.end(), l_.begin());
+    d_ = other.d_;
+    li_ = other.li_;
+}
+
+template <class Archive> inline void GdShifter::archiveState(Archive &archive)
+{
+    archive.frames(l_.data(), l_.size());
+    archive.value(d_);
+    archive.value(li_);
+    archive.check(li_ < l_.size() || li_ == 0);
+    archive.check(std::fabs(d_) <= (float)l_.size());
+}
+
 inline float GdShifter::processOne(float input, float shiftLinear)
 {
     float output;
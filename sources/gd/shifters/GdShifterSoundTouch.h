@@ -22,6 +22,7 @@
 
 #define GD_SHIFTER_UPDATES_AT_K_RATE 1
 #define GD_SHIFTER_CAN_REPORT_LATENCY 1
+#define GD_SHIFTER_CAN_COPY_STATE 0
 
 class GdShifter {
 public:
@@ -32,6 +33,8 @@ public:
     void setSampleRate(float sampleRate);
     void setBufferSize(unsigned bufferSize) { (void)bufferSize; }
     void setShift(float shiftLinear);
+    // whether the output is a copy of the input, at the current shift
+    bool isPassThrough() const { return shift_ == 1.0f; }
     float processOne(float input);
     void process(const float *input, float *output, unsigned count);
     float getLatency() const;
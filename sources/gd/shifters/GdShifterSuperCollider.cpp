@@ -26,6 +26,7 @@
 #include "utility/NextPowerOfTwo.h"
 #include <algorithm>
 #include <cmath>
+#include <cassert>
 #include <cstdio>
 #include <cstring>
 
@@ -175,6 +176,24 @@ void GdShifter::setShift(float shiftLinear)
         calc_ = &GdShifter::copyNext;
 }
 
+void GdShifter::copyState(const GdShifter &other)
+{
+    shift_ = other.shift_;
+    calc_ = other.calc_;
+
+    // when pass-through, the state is cleared before it's used again
+    if (shift_ == 1.0f)
+        return;
+
+    assert(delayBuffer_.size() == other.delayBuffer_.size());
+    std::copy(other.delayBuffer_.begin(), other.delayBuffer_.end(), delayBuffer_.begin());
+    rgen_ = other.rgen_;
+
+    float *dlybuf = unit_.dlybuf;
+    unit_ = other.unit_;
+    unit_.dlybuf = dlybuf;
+}
+
 void GdShifter::postUpdateSampleRateOrBufferSize()
 {
     PitchShift *unit = &unit_;
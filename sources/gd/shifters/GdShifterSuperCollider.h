@@ -22,11 +22,14 @@
 */
 
 #pragma once
-#include <vector>
+#include "utility/MemoryPool.h"
+#include <initializer_list>
+#include <cmath>
 #include <cstdint>
 
 #define GD_SHIFTER_UPDATES_AT_K_RATE 1
 #define GD_SHIFTER_CAN_REPORT_LATENCY 0
+#define GD_SHIFTER_CAN_COPY_STATE 1
 
 class GdShifter {
 public:
@@ -37,6 +40,10 @@ public:
     void setSampleRate(float sampleRate);
     void setBufferSize(unsigned bufferSize);
     void setShift(float shiftLinear);
+    // whether the output is a copy of the input, at the current shift
+    bool isPassThrough() const;
+    void copyState(const GdShifter &other);
+    template <class Archive> void archiveState(Archive &archive);
     float processOne(float input);
     void process(const float *input, float *output, unsigned count);
 
@@ -75,9 +82,56 @@ private:
     };
     PitchShift unit_{};
 
-    std::vector<float> delayBuffer_;
+    PoolVector<float> delayBuffer_;
 };
 
+template <class Archive> inline void GdShifter::archiveState(Archive &archive)
+{
+    archive.value(shift_);
+    archive.value(rgen_);
+
+    // the processing function, by its index
+    void (GdShifter::*const calcs[])(const float *, float *, unsigned) = {
+        &GdShifter::processNextZ, &GdShifter::processNext, &GdShifter::copyNext,
+    };
+    unsigned calcIndex = 0;
+    while (calcIndex < 3 && calcs[calcIndex] != calc_)
+        ++calcIndex;
+    archive.value(calcIndex);
+    archive.check(calcIndex < 3);
+    calc_ = calcs[(calcIndex < 3) ? calcIndex : 0];
+
+    // the unit points into the delay buffer, which stays where it is
+    const PitchShift fixed = unit_;
+    archive.value(unit_);
+    unit_.dlybuf = fixed.dlybuf;
+
+    // the sizes follow from the sample rate, and the positions must be in
+    // range, the fractional ones because they get converted to integers
+    const PitchShift &u = unit_;
+    archive.check(u.idelaylen == fixed.idelaylen && u.mask == fixed.mask &&
+                  u.framesize == fixed.framesize && u.fdelaylen == fixed.fdelaylen &&
+                  u.slope == fixed.slope);
+    archive.check(u.iwrphase >= 0 && u.iwrphase <= u.mask);
+    archive.check(u.counter >= 0 && u.counter <= (u.framesize >> 2));
+    archive.check(u.stage >= 0 && u.stage < 4);
+    const float fmax = (float)u.idelaylen;
+    for (float dsamp : {u.dsamp1, u.dsamp2, u.dsamp3, u.dsamp4})
+        archive.check(std::fabs(dsamp) <= fmax);
+    for (float other : {u.dsamp1_slope, u.dsamp2_slope, u.dsamp3_slope, u.dsamp4_slope,
+                        u.ramp1, u.ramp2, u.ramp3, u.ramp4,
+                        u.ramp1_slope, u.ramp2_slope, u.ramp3_slope, u.ramp4_slope})
+        archive.check(std::isfinite(other));
+    archive.check(std::isfinite(shift_));
+
+    archive.frames(delayBuffer_.data(), delayBuffer_.size());
+}
+
+inline bool GdShifter::isPassThrough() const
+{
+    return calc_ == &GdShifter::copyNext;
+}
+
 inline void GdShifter::process(const float *input, float *output, unsigned count)
 {
     (this->*calc_)(input, output, count);
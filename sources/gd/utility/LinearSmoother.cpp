@@ -42,6 +42,13 @@ void LinearSmoother::setTarget(float newTarget) noexcept
     }
 }
 
+void LinearSmoother::rampFromZero() noexcept
+{
+    // a whole segment to the target, which starts from zero
+    fMem = 0.0f;
+    updateStep();
+}
+
 void LinearSmoother::nextBlock(float *__restrict output, uint32_t count) noexcept
 {
     float target = fTarget;
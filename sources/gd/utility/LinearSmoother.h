@@ -48,11 +48,14 @@ public:
     void setTarget(float newTarget) noexcept;
     void clear() noexcept;
     void clearToTarget() noexcept;
+    void rampFromZero() noexcept;
     float next() noexcept;
 #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
     simde__m128 nextPS() noexcept;
 #endif
     void nextBlock(float *__restrict output, uint32_t count) noexcept;
+    void skip(uint32_t count) noexcept;
+    template <class Archive> void archiveState(Archive &archive);
 
 private:
     void updateStep() noexcept;
@@ -92,6 +95,21 @@ HEDLEY_ALWAYS_INLINE float LinearSmoother::next() noexcept
     return (fMem = y0 + std::copysign(std::fmin(std::abs(dy), std::abs(fStep)), dy));
 }
 
+HEDLEY_ALWAYS_INLINE void LinearSmoother::skip(uint32_t count) noexcept
+{
+    float y0 = fMem;
+    float dy = fTarget - y0;
+    fMem = y0 + std::copysign(std::fmin(std::abs(dy), std::abs(fStep) * (float)count), dy);
+}
+
+template <class Archive> inline void LinearSmoother::archiveState(Archive &archive)
+{
+    archive.value(fStep);
+    archive.value(fTarget);
+    archive.value(fMem);
+    archive.check(std::isfinite(fStep) && std::isfinite(fTarget) && std::isfinite(fMem));
+}
+
 #if SIMDE_NATURAL_VECTOR_SIZE_GE(128)
 HEDLEY_ALWAYS_INLINE simde__m128 LinearSmoother::nextPS() noexcept
 {
@@ -0,0 +1,237 @@
+/* Copyright (c) 2021, Jean Pierre Cimalando
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+#include <jsl/allocator>
+#include <vector>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief A memory area of fixed size for the buffers of an instance
+ *
+ * Blocks are handed out by bumping a pointer forward, every one of them
+ * starting at a boundary of `kAlignment` bytes, and they are only released
+ * all at once, with the pool itself. A pool without memory allocates its
+ * blocks on the heap, and only measures the size they would take.
+ *
+ * The allocators take the pool which is current on the thread when they are
+ * constructed, so the containers which are made in the scope of a pool keep
+ * allocating there for their lifetime.
+ */
+class MemoryPool {
+public:
+    enum { kAlignment = 64 };
+
+    class Scope;
+
+    // a pool which measures, and allocates on the heap
+    MemoryPool() noexcept = default;
+    // makes a pool at the start of `memory`, which hands out the rest of it
+    static MemoryPool *createIn(void *memory, size_t size) noexcept;
+    // the size of the memory for a pool to hand out what a measure has taken
+    static size_t getSizeToCreate(size_t sizeInUse) noexcept;
+
+    size_t getSizeInUse() const noexcept { return position_; }
+    void *allocate(size_t size, size_t alignment);
+    void deallocate(void *block, size_t size) noexcept;
+
+    // the pool of the current scope, or null
+    static MemoryPool *getCurrent() noexcept { return current(); }
+
+private:
+    MemoryPool(uint8_t *data, size_t capacity) noexcept : data_(data), capacity_(capacity) {}
+    static size_t alignSize(size_t size) noexcept;
+    static MemoryPool *&current() noexcept;
+
+private:
+    uint8_t *data_ = nullptr;
+    size_t capacity_ = 0;
+    size_t position_ = 0;
+};
+
+/**
+ * @brief A guard which makes a pool current on the thread, during its lifetime
+ */
+class MemoryPool::Scope {
+public:
+    explicit Scope(MemoryPool *pool) noexcept : previous_(current()) { current() = pool; }
+    ~Scope() noexcept { current() = previous_; }
+
+private:
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    MemoryPool *previous_ = nullptr;
+};
+
+/**
+ * @brief An allocator in the current pool, or on the heap if there is none
+ */
+template <class T, size_t Al = alignof(T)>
+class PoolAllocator {
+public:
+    typedef T value_type;
+    template <class U> struct rebind { typedef PoolAllocator<U, Al> other; };
+
+    PoolAllocator() noexcept : pool_(MemoryPool::getCurrent()) {}
+    template <class U> PoolAllocator(const PoolAllocator<U, Al> &other) noexcept : pool_(other.getPool()) {}
+
+    T *allocate(size_t count);
+    void deallocate(T *block, size_t count) noexcept;
+    MemoryPool *getPool() const noexcept { return pool_; }
+
+private:
+    // the heap functions, depending on whether the alignment is over the default
+    typedef std::integral_constant<bool, (Al > alignof(std::max_align_t))> IsOverAligned;
+    static void *allocateOnHeap(size_t size, std::false_type) { return ::operator new(size); }
+    static void *allocateOnHeap(size_t size, std::true_type) { return jsl::aligned_allocator_traits<Al>::allocate(size); }
+    static void deallocateOnHeap(void *block, std::false_type) noexcept { ::operator delete(block); }
+    static void deallocateOnHeap(void *block, std::true_type) noexcept { jsl::aligned_allocator_traits<Al>::deallocate(block); }
+
+private:
+    MemoryPool *pool_ = nullptr;
+};
+
+template <class T, size_t Al, class U>
+inline bool operator==(const PoolAllocator<T, Al> &a, const PoolAllocator<U, Al> &b) noexcept
+{
+    return a.getPool() == b.getPool();
+}
+
+template <class T, size_t Al, class U>
+inline bool operator!=(const PoolAllocator<T, Al> &a, const PoolAllocator<U, Al> &b) noexcept
+{
+    return a.getPool() != b.getPool();
+}
+
+template <class T>
+using PoolVector = std::vector<T, PoolAllocator<T>>;
+
+/**
+ * @brief Destroys an object which `poolNew` has made
+ */
+struct PoolDelete {
+    MemoryPool *pool = MemoryPool::getCurrent();
+    template <class T> void operator()(T *object) const noexcept;
+};
+
+// makes an object in the current pool, or on the heap if there is none
+template <class T, class... Args> T *poolNew(Args &&...args);
+
+//==============================================================================
+inline MemoryPool *MemoryPool::createIn(void *memory, size_t size) noexcept
+{
+    uintptr_t start = (uintptr_t)memory;
+    uintptr_t object = (start + (alignof(MemoryPool) - 1)) & ~(uintptr_t)(alignof(MemoryPool) - 1);
+    uintptr_t data = (object + sizeof(MemoryPool) + (kAlignment - 1)) & ~(uintptr_t)(kAlignment - 1);
+    if (data - start > size)
+        return nullptr;
+    return new ((void *)object) MemoryPool((uint8_t *)data, size - (size_t)(data - start));
+}
+
+inline size_t MemoryPool::getSizeToCreate(size_t sizeInUse) noexcept
+{
+    return (alignof(MemoryPool) - 1) + sizeof(MemoryPool) + (kAlignment - 1) + sizeInUse;
+}
+
+inline void *MemoryPool::allocate(size_t size, size_t alignment)
+{
+    if (alignment > kAlignment)
+        throw std::bad_alloc();
+
+    size_t start = position_;
+    size_t end = start + alignSize(size);
+    if (!data_) {
+        position_ = end;
+        return jsl::aligned_allocator_traits<kAlignment>::allocate(size);
+    }
+
+    if (end > capacity_)
+        throw std::bad_alloc();
+    position_ = end;
+    return data_ + start;
+}
+
+inline void MemoryPool::deallocate(void *block, size_t size) noexcept
+{
+    (void)size;
+    if (!data_)
+        jsl::aligned_allocator_traits<kAlignment>::deallocate(block);
+}
+
+inline size_t MemoryPool::alignSize(size_t size) noexcept
+{
+    return (size + (kAlignment - 1)) & ~(size_t)(kAlignment - 1);
+}
+
+inline MemoryPool *&MemoryPool::current() noexcept
+{
+    static thread_local MemoryPool *pool = nullptr;
+    return pool;
+}
+
+template <class T, size_t Al>
+inline T *PoolAllocator<T, Al>::allocate(size_t count)
+{
+    static_assert(Al >= alignof(T), "the alignment is insufficient");
+    size_t size = count * sizeof(T);
+    void *block = pool_ ? pool_->allocate(size, Al) : allocateOnHeap(size, IsOverAligned());
+    return static_cast<T *>(block);
+}
+
+template <class T, size_t Al>
+inline void PoolAllocator<T, Al>::deallocate(T *block, size_t count) noexcept
+{
+    if (pool_)
+        pool_->deallocate(block, count * sizeof(T));
+    else
+        deallocateOnHeap(block, IsOverAligned());
+}
+
+template <class T> inline void PoolDelete::operator()(T *object) const noexcept
+{
+    if (!pool)
+        delete object;
+    else {
+        object->~T();
+        pool->deallocate(object, sizeof(T));
+    }
+}
+
+template <class T, class... Args> inline T *poolNew(Args &&...args)
+{
+    MemoryPool *pool = MemoryPool::getCurrent();
+    if (!pool)
+        return new T(std::forward<Args>(args)...);
+    return new (pool->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
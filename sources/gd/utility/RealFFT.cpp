@@ -0,0 +1,177 @@
+/* Copyright (c) 2021, Jean Pierre Cimalando
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "RealFFT.h"
+#include <cmath>
+#include <cassert>
+
+void RealFFT::setSize(unsigned size)
+{
+    assert(size >= 4 && (size & (size - 1)) == 0);
+
+    if (size_ == size)
+        return;
+
+    size_ = size;
+
+    // the complex transform has half the size
+    unsigned half = size / 2;
+    unsigned numBits = 0;
+    while ((1u << numBits) < half)
+        ++numBits;
+
+    bitReversal_.resize(half);
+    for (unsigned i = 0; i < half; ++i) {
+        unsigned r = 0;
+        for (unsigned b = 0; b < numBits; ++b)
+            r |= ((i >> b) & 1) << (numBits - 1 - b);
+        bitReversal_[i] = r;
+    }
+
+    // the twiddles of the stage of span `2 * n` start at index `n - 1`
+    const double pi = 3.14159265358979323846;
+    twiddleCos_.resize(half);
+    twiddleSin_.resize(half);
+    for (unsigned n = 1; n < half; n *= 2) {
+        for (unsigned j = 0; j < n; ++j) {
+            twiddleCos_[n - 1 + j] = (float)std::cos(pi * j / n);
+            twiddleSin_[n - 1 + j] = (float)-std::sin(pi * j / n);
+        }
+    }
+
+    splitCos_.resize(half);
+    splitSin_.resize(half);
+    for (unsigned k = 0; k < half; ++k) {
+        splitCos_[k] = (float)std::cos(2 * pi * k / size);
+        splitSin_[k] = (float)-std::sin(2 * pi * k / size);
+    }
+
+    workReal_.resize(half);
+    workImag_.resize(half);
+}
+
+void RealFFT::forward(const float *input, float *real, float *imag) noexcept
+{
+    unsigned half = size_ / 2;
+    float *zr = workReal_.data();
+    float *zi = workImag_.data();
+
+    // the even and odd frames are the real and imaginary parts of a signal
+    // of half the size
+    const unsigned *bitReversal = bitReversal_.data();
+    for (unsigned i = 0; i < half; ++i) {
+        unsigned r = bitReversal[i];
+        zr[r] = input[2 * i];
+        zi[r] = input[2 * i + 1];
+    }
+
+    transform(zr, zi, 1.0f);
+
+    // separate the spectra of the even and odd frames, and combine them
+    real[0] = zr[0] + zi[0];
+    imag[0] = zr[0] - zi[0];
+
+    const float *wr = splitCos_.data();
+    const float *wi = splitSin_.data();
+    for (unsigned k = 1; k < half; ++k) {
+        float ar = zr[k], ai = zi[k];
+        float br = zr[half - k], bi = -zi[half - k];
+        float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        // (a - b) / 2i
+        float or_ = 0.5f * (ai - bi), oi = -0.5f * (ar - br);
+        real[k] = er + wr[k] * or_ - wi[k] * oi;
+        imag[k] = ei + wr[k] * oi + wi[k] * or_;
+    }
+}
+
+void RealFFT::inverse(const float *real, const float *imag, float *output) noexcept
+{
+    unsigned half = size_ / 2;
+    float *zr = workReal_.data();
+    float *zi = workImag_.data();
+
+    // recombine the spectra of the even and odd frames, into the signal of
+    // half the size which has them as its real and imaginary parts
+    const unsigned *bitReversal = bitReversal_.data();
+    {
+        float dc = real[0];
+        float nyquist = imag[0];
+        zr[0] = dc + nyquist;
+        zi[0] = dc - nyquist;
+    }
+
+    const float *wr = splitCos_.data();
+    const float *wi = splitSin_.data();
+    for (unsigned k = 1; k < half; ++k) {
+        float ar = real[k], ai = imag[k];
+        float br = real[half - k], bi = -imag[half - k];
+        float er = ar + br, ei = ai + bi;
+        // (a - b) * conj(w)
+        float dr = ar - br, di = ai - bi;
+        float or_ = dr * wr[k] + di * wi[k];
+        float oi = di * wr[k] - dr * wi[k];
+        // e + i * o
+        unsigned r = bitReversal[k];
+        zr[r] = er - oi;
+        zi[r] = ei + or_;
+    }
+
+    // the bin 0 stays in place by the reversal
+    transform(zr, zi, -1.0f);
+
+    for (unsigned i = 0; i < half; ++i) {
+        output[2 * i] = zr[i];
+        output[2 * i + 1] = zi[i];
+    }
+}
+
+void RealFFT::transform(float *real, float *imag, float sign) noexcept
+{
+    unsigned half = size_ / 2;
+    const float *twiddleCos = twiddleCos_.data();
+    const float *twiddleSin = twiddleSin_.data();
+
+    // radix-2 decimation in time, over the input in bit-reversed order
+    for (unsigned n = 1; n < half; n *= 2) {
+        const float *wr = &twiddleCos[n - 1];
+        const float *wi = &twiddleSin[n - 1];
+        for (unsigned start = 0; start < half; start += 2 * n) {
+            float *ar = &real[start], *ai = &imag[start];
+            float *br = &real[start + n], *bi = &imag[start + n];
+            for (unsigned j = 0; j < n; ++j) {
+                float ti = sign * wi[j];
+                float tr = br[j] * wr[j] - bi[j] * ti;
+                float tk = br[j] * ti + bi[j] * wr[j];
+                br[j] = ar[j] - tr;
+                bi[j] = ai[j] - tk;
+                ar[j] += tr;
+                ai[j] += tk;
+            }
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/* Copyright (c) 2021, Jean Pierre Cimalando
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+#include <vector>
+
+/**
+ * @brief A FFT of real signals, of which the size is a power of 2
+ *
+ * The spectrum is in split form, with the real and the imaginary parts in
+ * separate arrays of `size / 2` elements. Since the bins at the DC and at the
+ * Nyquist frequency are real, the first bin holds the DC in its real part,
+ * and the Nyquist frequency in its imaginary part.
+ *
+ * The transforms are unnormalized, so that a forward transform followed by
+ * an inverse transform scales the signal by the size.
+ */
+class RealFFT {
+public:
+    void setSize(unsigned size);
+    unsigned getSize() const noexcept { return size_; }
+    void forward(const float *input, float *real, float *imag) noexcept;
+    void inverse(const float *real, const float *imag, float *output) noexcept;
+
+private:
+    void transform(float *real, float *imag, float sign) noexcept;
+
+private:
+    unsigned size_ = 0;
+    // the complex transform of half the size, and its twiddles stage by stage
+    std::vector<unsigned> bitReversal_;
+    std::vector<float> twiddleCos_;
+    std::vector<float> twiddleSin_;
+    // the twiddles which split the complex spectrum into the real one
+    std::vector<float> splitCos_;
+    std::vector<float> splitSin_;
+    // work area
+    std::vector<float> workReal_;
+    std::vector<float> workImag_;
+};
@@ -27,6 +27,7 @@
  */
 
 #pragma once
+#include <simde/x86/sse.h>
 #include <cmath>
 
 #if 0
@@ -36,9 +37,14 @@ inline Real rsqrtNL(Real x)
     return x / std::sqrt(1 + x * x);
 }
 
-#else
-#include <simde/x86/sse.h>
+// the same in the lanes of a vector
+inline simde__m128 rsqrtNL4(simde__m128 x)
+{
+    simde__m128 one = simde_mm_set1_ps(1.0f);
+    return simde_mm_div_ps(x, simde_mm_sqrt_ps(simde_mm_add_ps(one, simde_mm_mul_ps(x, x))));
+}
 
+#else
 template <class Real>
 Real rsqrtNL(Real x);
 
@@ -54,4 +60,11 @@ inline Real rsqrtNL(Real x)
     return (Real)rsqrtNL((float)x);
 }
 
+// the same in the lanes of a vector, where each lane is exact to the above
+inline simde__m128 rsqrtNL4(simde__m128 x)
+{
+    simde__m128 one = simde_mm_set1_ps(1.0f);
+    return simde_mm_mul_ps(x, simde_mm_rsqrt_ps(simde_mm_add_ps(one, simde_mm_mul_ps(x, x))));
+}
+
 #endif
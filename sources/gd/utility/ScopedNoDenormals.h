@@ -0,0 +1,106 @@
+/* Copyright (c) 2021, Jean Pierre Cimalando
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#   define GD_NO_DENORMALS_SSE 1
+#   include <simde/x86/sse.h>
+#elif defined(__aarch64__) && defined(__GNUC__)
+#   define GD_NO_DENORMALS_FPCR 1
+#elif defined(__arm__) && defined(__ARM_FP) && defined(__GNUC__)
+#   define GD_NO_DENORMALS_FPSCR 1
+#endif
+#include <cstdint>
+
+// flushes to zero the results and the operands under the normal range, in the
+// scope of the object, and restores the previous mode after it; the mode is
+// that of the SSE control register on x86, and the FZ bit of the floating
+// point control register on ARM, and the guard has no effect elsewhere
+class ScopedNoDenormals {
+public:
+    ScopedNoDenormals() noexcept
+        : mode_(getMode())
+    {
+        Mode mode = mode_ | kFlushMask;
+        changed_ = mode != mode_;
+        if (changed_)
+            setMode(mode);
+    }
+
+    ~ScopedNoDenormals() noexcept
+    {
+        if (changed_)
+            setMode(mode_);
+    }
+
+    ScopedNoDenormals(const ScopedNoDenormals &) = delete;
+    ScopedNoDenormals &operator=(const ScopedNoDenormals &) = delete;
+
+private:
+#if defined(GD_NO_DENORMALS_SSE)
+    typedef unsigned Mode;
+    enum : Mode {
+        kFlushToZero = SIMDE_MM_FLUSH_ZERO_ON,
+        // the mode of SSE3, which simde does not name
+        kDenormalsAreZero = 0x0040,
+        kFlushMask = kFlushToZero | kDenormalsAreZero,
+    };
+    static Mode getMode() noexcept { return simde_mm_getcsr(); }
+    static void setMode(Mode mode) noexcept { simde_mm_setcsr(mode); }
+#elif defined(GD_NO_DENORMALS_FPCR)
+    // FZ flushes the operands as well as the results
+    typedef uint64_t Mode;
+    enum : Mode { kFlushMask = Mode(1) << 24 };
+    static Mode getMode() noexcept
+    {
+        Mode mode;
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(mode));
+        return mode;
+    }
+    // the clobber of memory keeps the loads and the stores of the scope inside
+    static void setMode(Mode mode) noexcept { __asm__ __volatile__("msr fpcr, %0" : : "r"(mode) : "memory"); }
+#elif defined(GD_NO_DENORMALS_FPSCR)
+    typedef uint32_t Mode;
+    enum : Mode { kFlushMask = Mode(1) << 24 };
+    static Mode getMode() noexcept
+    {
+        Mode mode;
+        __asm__ __volatile__("vmrs %0, fpscr" : "=r"(mode));
+        return mode;
+    }
+    static void setMode(Mode mode) noexcept { __asm__ __volatile__("vmsr fpscr, %0" : : "r"(mode) : "memory"); }
+#else
+    typedef unsigned Mode;
+    enum : Mode { kFlushMask = 0 };
+    static Mode getMode() noexcept { return 0; }
+    static void setMode(Mode) noexcept {}
+#endif
+
+    Mode mode_ = 0;
+    bool changed_ = false;
+};
@@ -0,0 +1,133 @@
+/* Copyright (c) 2021, Jean Pierre Cimalando
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+#include "MemoryPool.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+
+/**
+ * @brief A contiguous memory area for scratch buffers
+ *
+ * Buffers are handed out by bumping a pointer forward, every one of them
+ * starting at a boundary of `kAlignment` bytes. A `Scope` saves the position
+ * and releases everything which was allocated during its lifetime.
+ *
+ * The arena never grows by itself, it must be reserved ahead of use in a
+ * non-realtime context. A `Layout` can be used to find out the size to
+ * reserve, by running the same sequence of allocations against it.
+ * The storage is in the current `MemoryPool`, if there is one.
+ */
+class ScratchArena {
+public:
+    enum { kAlignment = 64 };
+
+    class Layout;
+    class Scope;
+
+    void reserve(size_t size);
+    size_t getCapacity() const noexcept;
+    size_t getSizeInUse() const noexcept;
+    template <class T> T *allocate(size_t count) noexcept;
+
+private:
+    static size_t alignSize(size_t size) noexcept;
+
+private:
+    std::vector<uint8_t, PoolAllocator<uint8_t, kAlignment>> storage_;
+    size_t position_ = 0;
+};
+
+/**
+ * @brief A stand-in for the arena which only computes the size required
+ */
+class ScratchArena::Layout {
+public:
+    size_t getSize() const noexcept { return size_; }
+    template <class T> T *allocate(size_t count) noexcept;
+
+private:
+    size_t size_ = 0;
+};
+
+/**
+ * @brief A guard which releases the allocations of the arena on exit
+ */
+class ScratchArena::Scope {
+public:
+    explicit Scope(ScratchArena &arena) noexcept : arena_(arena), position_(arena.position_) {}
+    ~Scope() noexcept { arena_.position_ = position_; }
+
+private:
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    ScratchArena &arena_;
+    size_t position_ = 0;
+};
+
+//==============================================================================
+inline void ScratchArena::reserve(size_t size)
+{
+    assert(position_ == 0);
+    storage_.resize(alignSize(size));
+}
+
+inline size_t ScratchArena::getCapacity() const noexcept
+{
+    return storage_.size();
+}
+
+inline size_t ScratchArena::getSizeInUse() const noexcept
+{
+    return position_;
+}
+
+template <class T> inline T *ScratchArena::allocate(size_t count) noexcept
+{
+    static_assert(kAlignment % alignof(T) == 0, "the alignment is unsupported");
+    size_t start = position_;
+    size_t end = start + alignSize(count * sizeof(T));
+    assert(end <= storage_.size());
+    position_ = end;
+    return reinterpret_cast<T *>(storage_.data() + start);
+}
+
+inline size_t ScratchArena::alignSize(size_t size) noexcept
+{
+    return (size + (kAlignment - 1)) & ~(size_t)(kAlignment - 1);
+}
+
+template <class T> inline T *ScratchArena::Layout::allocate(size_t count) noexcept
+{
+    size_ += alignSize(count * sizeof(T));
+    return nullptr;
+}
@@ -36,10 +36,12 @@
 
 struct Processor::Impl : public juce::AudioProcessorListener {
     explicit Impl(Processor *self);
+    static BusesProperties makeBusesProperties();
     void setupParameters();
 
     //==========================================================================
     void updateBPM(double newBpm);
+    static bool getMultichannelOrder(const juce::AudioChannelSet &channels, int order[], unsigned &numPairs, unsigned &numSingles);
 
     //==========================================================================
     void audioProcessorParameterChanged(AudioProcessor *processor, int parameterIndex, float newValue) override;
@@ -50,6 +52,15 @@ struct Processor::Impl : public juce::AudioProcessorListener {
     GdPtr gd_;
     double lastKnownBpm_ = -1.0;
 
+    // the channels of a multichannel bus, in the order the network takes them
+    int channelOrder_[GdMaxChannels] {};
+    unsigned numOrderedChannels_ = 0;
+
+    // the first channel of the direct output of each tap, or -1 if its bus
+    // is disabled
+    int tapOutputChannels_[GdMaxLines] {};
+    bool hasTapOutputs_ = false;
+
     //==========================================================================
     using NameBuffer = PresetFile::NameBuffer;
     NameBuffer presetNameBuf_{};
@@ -68,9 +79,7 @@ struct Processor::Impl : public juce::AudioProcessorListener {
 
 //==============================================================================
 Processor::Processor()
-    : juce::AudioProcessor(BusesProperties()
-                           .withInput("Input", juce::AudioChannelSet::stereo(), true)
-                           .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
+    : juce::AudioProcessor(Impl::makeBusesProperties()),
       impl_(new Impl(this))
 {
     Impl &impl = *impl_;
@@ -117,11 +126,33 @@ void Processor::prepareToPlay(double sampleRate, int samplesPerBlock)
     if (!gd) {
         BusesLayout layouts = getBusesLayout();
         juce::AudioChannelSet inputs = layouts.getMainInputChannelSet();
-        int numInputs = (inputs == juce::AudioChannelSet::stereo()) ? 2 : 1;
-        int numOutputs = 2;
-        gd = GdNew((unsigned)numInputs, (unsigned)numOutputs);
+        juce::AudioChannelSet outputs = layouts.getMainOutputChannelSet();
+        if (outputs == juce::AudioChannelSet::stereo()) {
+            int numInputs = (inputs == juce::AudioChannelSet::stereo()) ? 2 : 1;
+            int numOutputs = 2;
+            gd = GdNew((unsigned)numInputs, (unsigned)numOutputs);
+            impl.numOrderedChannels_ = 0;
+        }
+        else {
+            unsigned numPairs = 0;
+            unsigned numSingles = 0;
+            bool valid = Impl::getMultichannelOrder(outputs, impl.channelOrder_, numPairs, numSingles);
+            jassert(valid);
+            (void)valid;
+            gd = GdNewMultichannel(numPairs, numSingles);
+            impl.numOrderedChannels_ = 2 * numPairs + numSingles;
+        }
         jassert(gd);
         impl.gd_.reset(gd);
+
+        // the taps which go to their own buses, after the main bus
+        impl.hasTapOutputs_ = false;
+        for (int tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+            int busIndex = 1 + tapIndex;
+            bool isEnabled = busIndex < getBusCount(false) && getBus(false, busIndex)->isEnabled();
+            impl.tapOutputChannels_[tapIndex] = isEnabled ? getChannelIndexInProcessBlockBuffer(false, busIndex, 0) : -1;
+            impl.hasTapOutputs_ = impl.hasTapOutputs_ || isEnabled;
+        }
     }
 
     GdSetSampleRate(gd, (float)sampleRate);
@@ -135,6 +166,7 @@ void Processor::prepareToPlay(double sampleRate, int samplesPerBlock)
     }
 
     GdClear(gd);
+    setLatencySamples((int)GdGetLatency(gd));
 
     impl.lastKnownBpm_ = -1.0;
 }
@@ -150,9 +182,22 @@ bool Processor::isBusesLayoutSupported(const BusesLayout &layouts) const
     juce::AudioChannelSet inputs = layouts.getMainInputChannelSet();
     juce::AudioChannelSet outputs = layouts.getMainOutputChannelSet();
 
-    return (inputs == juce::AudioChannelSet::mono() ||
-            inputs == juce::AudioChannelSet::stereo()) &&
-        outputs == juce::AudioChannelSet::stereo();
+    // the direct outputs of the taps have the layout of the main output
+    for (int busIndex = 1; busIndex < layouts.outputBuses.size(); ++busIndex) {
+        const juce::AudioChannelSet &tapOutputs = layouts.outputBuses.getReference(busIndex);
+        if (!tapOutputs.isDisabled() && tapOutputs != outputs)
+            return false;
+    }
+
+    if (outputs == juce::AudioChannelSet::stereo())
+        return inputs == juce::AudioChannelSet::mono() ||
+            inputs == juce::AudioChannelSet::stereo();
+
+    // a surround bus goes through with its own layout
+    return inputs == outputs &&
+        (outputs == juce::AudioChannelSet::create5point1() ||
+         outputs == juce::AudioChannelSet::create7point1() ||
+         outputs == juce::AudioChannelSet::create7point1point4());
 }
 
 bool Processor::applyBusLayouts(const BusesLayout& layouts)
@@ -190,7 +235,48 @@ void Processor::processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer
     Gd *gd = impl.gd_.get();
     const float **inputs = buffer.getArrayOfReadPointers();
     float **outputs = buffer.getArrayOfWritePointers();
-    GdProcess(gd, inputs, outputs, (unsigned)buffer.getNumSamples());
+
+    float **writePointers = outputs;
+
+    const float *orderedInputs[GdMaxChannels];
+    float *orderedOutputs[GdMaxChannels];
+    if (unsigned numChannels = impl.numOrderedChannels_) {
+        for (unsigned i = 0; i < numChannels; ++i) {
+            orderedInputs[i] = inputs[impl.channelOrder_[i]];
+            orderedOutputs[i] = outputs[impl.channelOrder_[i]];
+        }
+        inputs = orderedInputs;
+        outputs = orderedOutputs;
+    }
+
+    // the direct outputs point into the buffer, in the order of the main output
+    float *tapChannels[GdMaxLines][GdMaxChannels];
+    float **tapOutputs[GdMaxLines] {};
+    if (impl.hasTapOutputs_) {
+        unsigned numChannels = impl.numOrderedChannels_ ? impl.numOrderedChannels_ : 2;
+        for (unsigned tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+            int firstChannel = impl.tapOutputChannels_[tapIndex];
+            if (firstChannel == -1)
+                continue;
+            for (unsigned i = 0; i < numChannels; ++i) {
+                int channel = (int)i;
+                if (impl.numOrderedChannels_)
+                    channel = impl.channelOrder_[i];
+                tapChannels[tapIndex][i] = writePointers[firstChannel + channel];
+            }
+            tapOutputs[tapIndex] = tapChannels[tapIndex];
+        }
+    }
+
+    ///
+    int latency = (int)GdGetLatency(gd);
+    if (latency != getLatencySamples())
+        setLatencySamples(latency);
+
+    if (impl.hasTapOutputs_)
+        GdProcessWithTapOutputs(gd, inputs, outputs, tapOutputs, (unsigned)buffer.getNumSamples());
+    else
+        GdProcess(gd, inputs, outputs, (unsigned)buffer.getNumSamples());
 }
 
 void Processor::processBlock(juce::AudioBuffer<double> &buffer, juce::MidiBuffer &midiMessages)
@@ -313,6 +399,21 @@ Processor::Impl::Impl(Processor *self)
 {
 }
 
+auto Processor::Impl::makeBusesProperties() -> BusesProperties
+{
+    BusesProperties buses = BusesProperties()
+        .withInput("Input", juce::AudioChannelSet::stereo(), true)
+        .withOutput("Output", juce::AudioChannelSet::stereo(), true);
+
+    // an optional bus for each tap, which takes it out of the main output
+    for (int tapIndex = 0; tapIndex < GdMaxLines; ++tapIndex) {
+        GdParameter enableId = GdRecomposeParameter(GDP_TAP_A_ENABLE, tapIndex);
+        buses = buses.withOutput(GdGroupLabel(enableId), juce::AudioChannelSet::stereo(), false);
+    }
+
+    return buses;
+}
+
 void Processor::Impl::setupParameters()
 {
     Processor *self = self_;
@@ -422,6 +523,51 @@ void Processor::Impl::updateBPM(double newBpm)
     }
 }
 
+bool Processor::Impl::getMultichannelOrder(const juce::AudioChannelSet &channels, int order[], unsigned &numPairs, unsigned &numSingles)
+{
+    using ChannelSet = juce::AudioChannelSet;
+
+    // the pairs which pan and widen together, the others are single
+    static const ChannelSet::ChannelType pairTypes[][2] = {
+        {ChannelSet::left, ChannelSet::right},
+        {ChannelSet::leftSurround, ChannelSet::rightSurround},
+        {ChannelSet::leftSurroundSide, ChannelSet::rightSurroundSide},
+        {ChannelSet::leftSurroundRear, ChannelSet::rightSurroundRear},
+        {ChannelSet::topFrontLeft, ChannelSet::topFrontRight},
+        {ChannelSet::topRearLeft, ChannelSet::topRearRight},
+    };
+
+    int numChannels = channels.size();
+    if (numChannels > GdMaxChannels)
+        return false;
+
+    bool isPaired[GdMaxChannels] {};
+    int numOrdered = 0;
+
+    numPairs = 0;
+    for (const ChannelSet::ChannelType *pairType : pairTypes) {
+        int left = channels.getChannelIndexForType(pairType[0]);
+        int right = channels.getChannelIndexForType(pairType[1]);
+        if (left != -1 && right != -1) {
+            order[numOrdered++] = left;
+            order[numOrdered++] = right;
+            isPaired[left] = true;
+            isPaired[right] = true;
+            ++numPairs;
+        }
+    }
+
+    numSingles = 0;
+    for (int channel = 0; channel < numChannels; ++channel) {
+        if (!isPaired[channel]) {
+            order[numOrdered++] = channel;
+            ++numSingles;
+        }
+    }
+
+    return true;
+}
+
 //==============================================================================
 void Processor::Impl::audioProcessorParameterChanged(AudioProcessor *processor, int parameterIndex, float newValue)
 {